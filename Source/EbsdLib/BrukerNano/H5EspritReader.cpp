@@ -411,6 +411,22 @@ int H5EspritReader::readScanNames(QStringList& names)
   return err;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5EbsdPatternReader::Pointer H5EspritReader::openPatternData()
+{
+  QString path = m_HDF5Path + "/" + Ebsd::H5Esprit::EBSD + "/" + Ebsd::H5Esprit::Data + "/" + Ebsd::H5Esprit::RawPatterns;
+  H5EbsdPatternReader::Pointer patternReader = H5EbsdPatternReader::New();
+  if(patternReader->open(getFileName(), path) < 0)
+  {
+    setErrorCode(patternReader->getErrorCode());
+    setErrorMessage(patternReader->getErrorMessage());
+    return H5EbsdPatternReader::NullPointer();
+  }
+  return patternReader;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -41,6 +41,7 @@
 #include "EbsdLib/EbsdLib.h"
 #include "EbsdLib/EbsdReader.h"
 #include "EbsdLib/EbsdSetGetMacros.h"
+#include "EbsdLib/H5EbsdPatternReader.h"
 #include "EbsdLib/TSL/AngHeaderEntry.h"
 
 /**
@@ -154,6 +155,14 @@ public:
    */
   int readScanNames(QStringList& names);
 
+  /**
+   * @brief Opens the pattern data of the scan at HDF5Path so the patterns can be read in batches
+   * instead of all at once, which is what ReadPatternData does. This does not need readFile().
+   * @return The open pattern reader or a null pointer, with the error code and message set, if the
+   * pattern data could not be opened
+   */
+  H5EbsdPatternReader::Pointer openPatternData();
+
   /**
    * @brief Reads the header section of the file
    * @param Valid HDF5 Group ID
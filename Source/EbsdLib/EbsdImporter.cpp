@@ -0,0 +1,108 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "EbsdImporter.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+// About 1MB of 32 bit values which is what the HDF5 documentation suggests as a good chunk size
+const hsize_t k_DefaultChunkSize = 256 * 1024;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+herr_t EbsdImporter::writeDataArray(hid_t gid, const QString& name, hid_t dataType, int32_t rank, const hsize_t* dims, const void* data) const
+{
+  hid_t dcpl = H5Pcreate(H5P_DATASET_CREATE);
+  if(dcpl < 0)
+  {
+    return -1;
+  }
+
+  herr_t err = 0;
+  bool compress = m_CompressionLevel > 0 && H5Zfilter_avail(H5Z_FILTER_DEFLATE) > 0;
+  bool chunked = (m_ChunkSize > 0 || compress) && rank > 0 && std::all_of(dims, dims + rank, [](hsize_t d) { return d > 0; });
+  if(chunked)
+  {
+    // Chunk along the slowest dimension only; the other dimensions are kept whole.
+    hsize_t valuesPerRow = 1;
+    for(int32_t i = 1; i < rank; i++)
+    {
+      valuesPerRow *= dims[i];
+    }
+    hsize_t chunkSize = m_ChunkSize > 0 ? m_ChunkSize : k_DefaultChunkSize;
+    std::vector<hsize_t> chunkDims(dims, dims + rank);
+    chunkDims[0] = std::max<hsize_t>(1, std::min<hsize_t>(dims[0], (chunkSize + valuesPerRow - 1) / valuesPerRow));
+    err = H5Pset_chunk(dcpl, rank, chunkDims.data());
+    if(err >= 0 && compress && m_Shuffle)
+    {
+      err = H5Pset_shuffle(dcpl);
+    }
+    if(err >= 0 && compress)
+    {
+      err = H5Pset_deflate(dcpl, static_cast<unsigned>(std::min(m_CompressionLevel, 9)));
+    }
+    if(err < 0)
+    {
+      H5Pclose(dcpl);
+      return err;
+    }
+  }
+
+  hid_t dataspaceId = H5Screate_simple(rank, dims, nullptr);
+  if(dataspaceId < 0)
+  {
+    H5Pclose(dcpl);
+    return -1;
+  }
+
+  hid_t datasetId = H5Dcreate2(gid, name.toLatin1().constData(), dataType, dataspaceId, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+  if(datasetId >= 0)
+  {
+    err = H5Dwrite(datasetId, dataType, H5S_ALL, H5S_ALL, H5P_DEFAULT, data);
+    H5Dclose(datasetId);
+  }
+  else
+  {
+    err = -1;
+  }
+  H5Sclose(dataspaceId);
+  H5Pclose(dcpl);
+  return err;
+}
@@ -42,6 +42,7 @@
 #include <QtCore/QtDebug>
 
 #include "EbsdLib/EbsdLib.h"
+#include "EbsdLib/EbsdReader.h"
 #include "EbsdLib/EbsdSetGetMacros.h"
 
 /**
@@ -75,6 +76,28 @@ class EbsdLib_EXPORT EbsdImporter
      */
     EBSD_VIRTUAL_INSTANCE_PROPERTY(bool, Cancel)
 
+    /**
+     * @brief The number of values in each chunk of the data arrays. 0 writes contiguous
+     * data arrays unless compression is turned on, in which case a default chunk size is used.
+     */
+    EBSD_INSTANCE_PROPERTY(hsize_t, ChunkSize)
+
+    /**
+     * @brief The deflate (gzip) level, 1 - 9, of the data arrays. 0 turns compression off.
+     */
+    EBSD_INSTANCE_PROPERTY(int, CompressionLevel)
+
+    /**
+     * @brief Apply the byte shuffle filter ahead of deflate which usually helps floating point data.
+     */
+    EBSD_INSTANCE_PROPERTY(bool, Shuffle)
+
+    /**
+     * @brief The number of threads the readers returned by readEbsdFile() parse a text file with.
+     * 0 uses the number of cores. Use 1 when several files are read at once.
+     */
+    EBSD_INSTANCE_PROPERTY(int, NumberOfParserThreads)
+
     /**
      * @brief Either prints a message or sends the message to the User Interface
      * @param message The message to print
@@ -105,6 +128,25 @@ class EbsdLib_EXPORT EbsdImporter
      */
     virtual int importFile(hid_t fileId, int64_t index, const QString& ebsd) = 0;
 
+    /**
+     * @brief Reads the EBSD file into memory without writing anything. This does not change
+     * the state of the importer so several files can be read at once on different threads.
+     * @param ebsdFile The raw data file from the manufacturere (.ang, .ctf)
+     * @param err The error code (out)
+     * @param message The error message (out)
+     * @return The reader holding the data, or a null pointer if the file could not be read
+     */
+    virtual EbsdReader::Pointer readEbsdFile(const QString& ebsdFile, int& err, QString& message) const = 0;
+
+    /**
+     * @brief Writes the data of a reader returned by readEbsdFile() into the HDF5 file. The
+     * HDF5 library is not thread safe so only one thread may call this at a time.
+     * @param fildId HDF5 fileId of an open HDF5 file that the data will be stored into
+     * @param index The integer index value of this EBSD data file
+     * @param reader The reader returned by readEbsdFile()
+     */
+    virtual int writeEbsdData(hid_t fileId, int64_t index, const EbsdReader::Pointer& reader) = 0;
+
     /**
      * @brief Returns the dimensions for the EBSD Data set
      * @param x Number of X Voxels (out)
@@ -136,10 +178,27 @@ class EbsdLib_EXPORT EbsdImporter
     EbsdImporter()
     : m_ErrorCode(0)
     , m_Cancel(false)
+    , m_ChunkSize(0)
+    , m_CompressionLevel(0)
+    , m_Shuffle(false)
+    , m_NumberOfParserThreads(0)
     {
       m_PipelineMessage = "";
     }
 
+    /**
+     * @brief Writes a data array into the group using the chunk size and compression
+     * settings of this importer.
+     * @param gid The HDF5 group to write into
+     * @param name The name of the data set
+     * @param dataType The HDF5 native type of the data
+     * @param rank The rank of the data set
+     * @param dims The dimensions of the data set
+     * @param data The data to write
+     * @return Negative value on error
+     */
+    herr_t writeDataArray(hid_t gid, const QString& name, hid_t dataType, int32_t rank, const hsize_t* dims, const void* data) const;
+
   public:
     EbsdImporter(const EbsdImporter&) = delete;   // Copy Constructor Not Implemented
     EbsdImporter(EbsdImporter&&) = delete;        // Move Constructor Not Implemented
@@ -50,7 +50,9 @@ EbsdReader::EbsdReader() :
   m_OriginalHeader(""),
   m_ManageMemory(true),
   m_HeaderIsComplete(false),
-  m_NumberOfElements(0)
+  m_NumberOfElements(0),
+  m_NumberOfParserThreads(0),
+  m_ParserMinimumChunkSize(0)
 {
 }
 
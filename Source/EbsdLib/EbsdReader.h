@@ -59,6 +59,7 @@ class EbsdLib_EXPORT EbsdReader
 {
   public:
     EbsdReader();
+    EBSD_SHARED_POINTERS(EbsdReader)
     EBSD_TYPE_MACRO(EbsdReader)
 
     virtual ~EbsdReader();
@@ -102,6 +103,10 @@ class EbsdLib_EXPORT EbsdReader
     EBSD_INSTANCE_PROPERTY(bool, HeaderIsComplete)
     /** @brief The number of elements in a column of data. This should be rows * columns */
     EBSD_INSTANCE_PROPERTY(size_t, NumberOfElements)
+    /** @brief The number of threads that parse the data section of text files. 0 (the default) uses the number of cores */
+    EBSD_INSTANCE_PROPERTY(int, NumberOfParserThreads)
+    /** @brief The smallest part of the data section one parser thread works on. 0 (the default) uses the parser's default of 1 MB */
+    EBSD_INSTANCE_PROPERTY(size_t, ParserMinimumChunkSize)
 
     /*
      * Different manufacturers call this value different thingsl. TSL = NumRows | NumCols,
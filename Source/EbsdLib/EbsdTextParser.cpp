@@ -0,0 +1,560 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "EbsdTextParser.h"
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <thread>
+
+namespace
+{
+// Chunks smaller than this are not worth a thread of their own
+const size_t k_DefaultMinimumChunkSize = 1024 * 1024;
+
+// Every power of ten that a double holds exactly
+const double k_PowersOfTen[] = {1.0e0,  1.0e1,  1.0e2,  1.0e3,  1.0e4,  1.0e5,  1.0e6,  1.0e7,  1.0e8,  1.0e9,  1.0e10, 1.0e11,
+                                 1.0e12, 1.0e13, 1.0e14, 1.0e15, 1.0e16, 1.0e17, 1.0e18, 1.0e19, 1.0e20, 1.0e21, 1.0e22};
+
+inline bool isSpace(char c)
+{
+  return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+inline bool isDigit(char c)
+{
+  return c >= '0' && c <= '9';
+}
+
+inline const char* findLineEnd(const char* pos, const char* end)
+{
+  const char* lineEnd = static_cast<const char*>(::memchr(pos, '\n', static_cast<size_t>(end - pos)));
+  return (nullptr == lineEnd) ? end : lineEnd;
+}
+
+inline const char* skipSpace(const char* pos, const char* end)
+{
+  while(pos != end && isSpace(*pos))
+  {
+    ++pos;
+  }
+  return pos;
+}
+
+inline const char* skipToken(const char* pos, const char* end)
+{
+  while(pos != end && !isSpace(*pos))
+  {
+    ++pos;
+  }
+  return pos;
+}
+
+// Without a delimiter a token ends at the next white space, with one at the next delimiter
+inline const char* findTokenEnd(const char* token, const char* lineEnd, char delimiter)
+{
+  if(delimiter == '\0')
+  {
+    return skipToken(token, lineEnd);
+  }
+  const char* tokenEnd = static_cast<const char*>(::memchr(token, delimiter, static_cast<size_t>(lineEnd - token)));
+  return (nullptr == tokenEnd) ? lineEnd : tokenEnd;
+}
+
+// Returns nullptr once the line holds no more tokens
+inline const char* findNextToken(const char* tokenEnd, const char* lineEnd, char delimiter)
+{
+  if(delimiter == '\0')
+  {
+    const char* token = skipSpace(tokenEnd, lineEnd);
+    return (token == lineEnd) ? nullptr : token;
+  }
+  return (tokenEnd == lineEnd) ? nullptr : tokenEnd + 1;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+EbsdTextParser::EbsdTextParser()
+: m_NumberOfThreads(0)
+, m_MinimumChunkSize(k_DefaultMinimumChunkSize)
+, m_Delimiter('\0')
+, m_DecimalComma(false)
+, m_RequireAllColumns(false)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+EbsdTextParser::~EbsdTextParser()
+{
+  close();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int EbsdTextParser::open(const QString& filePath)
+{
+  close();
+  m_File.setFileName(filePath);
+  if(!m_File.open(QIODevice::ReadOnly))
+  {
+    return -1;
+  }
+  qint64 size = m_File.size();
+  if(size > 0)
+  {
+    m_Map = m_File.map(0, size);
+  }
+  if(nullptr != m_Map)
+  {
+    m_Begin = reinterpret_cast<const char*>(m_Map);
+    m_End = m_Begin + size;
+    return 0;
+  }
+  // Not a regular file (or mapping failed); fall back to a single read
+  m_Contents = m_File.readAll();
+  m_Begin = m_Contents.constData();
+  m_End = m_Begin + m_Contents.size();
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void EbsdTextParser::close()
+{
+  if(nullptr != m_Map)
+  {
+    m_File.unmap(m_Map);
+    m_Map = nullptr;
+  }
+  if(m_File.isOpen())
+  {
+    m_File.close();
+  }
+  m_Contents.clear();
+  m_Begin = nullptr;
+  m_End = nullptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const char* EbsdTextParser::begin() const
+{
+  return m_Begin;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const char* EbsdTextParser::end() const
+{
+  return m_End;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const char* EbsdTextParser::nextLine(const char* pos, const char* end)
+{
+  const char* lineEnd = findLineEnd(pos, end);
+  return (lineEnd == end) ? end : lineEnd + 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const char* EbsdTextParser::skipLinesStartingWith(const char* pos, const char* end, char commentChar)
+{
+  while(pos != end && *pos == commentChar)
+  {
+    pos = nextLine(pos, end);
+  }
+  return pos;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool EbsdTextParser::parseFloat(const char* first, const char* last, float& value)
+{
+  const char* pos = first;
+  bool negative = false;
+  if(pos != last && (*pos == '-' || *pos == '+'))
+  {
+    negative = (*pos == '-');
+    ++pos;
+  }
+
+  uint64_t mantissa = 0;
+  int significantDigits = 0;
+  int exponent = 0;
+  bool hasDigits = false;
+  for(; pos != last && isDigit(*pos); ++pos)
+  {
+    hasDigits = true;
+    if(mantissa != 0 || *pos != '0')
+    {
+      mantissa = mantissa * 10 + static_cast<uint64_t>(*pos - '0');
+      significantDigits++;
+    }
+  }
+  if(pos != last && *pos == '.')
+  {
+    for(++pos; pos != last && isDigit(*pos); ++pos)
+    {
+      hasDigits = true;
+      if(mantissa != 0 || *pos != '0')
+      {
+        mantissa = mantissa * 10 + static_cast<uint64_t>(*pos - '0');
+        significantDigits++;
+      }
+      exponent--;
+    }
+  }
+  if(hasDigits && pos != last && (*pos == 'e' || *pos == 'E'))
+  {
+    ++pos;
+    bool negativeExponent = false;
+    if(pos != last && (*pos == '-' || *pos == '+'))
+    {
+      negativeExponent = (*pos == '-');
+      ++pos;
+    }
+    int exponentValue = 0;
+    bool hasExponentDigits = false;
+    for(; pos != last && isDigit(*pos) && exponentValue < 10000; ++pos)
+    {
+      exponentValue = exponentValue * 10 + (*pos - '0');
+      hasExponentDigits = true;
+    }
+    hasDigits = hasExponentDigits;
+    exponent += negativeExponent ? -exponentValue : exponentValue;
+  }
+
+  // The result is exact when the mantissa and the power of ten are both exact doubles
+  if(hasDigits && pos == last && significantDigits <= 15 && exponent >= -22 && exponent <= 22)
+  {
+    double result = static_cast<double>(mantissa);
+    if(mantissa != 0)
+    {
+      result = (exponent < 0) ? result / k_PowersOfTen[-exponent] : result * k_PowersOfTen[exponent];
+    }
+    value = static_cast<float>(negative ? -result : result);
+    return true;
+  }
+
+  // Anything else (nan, inf, very long or very large values) goes through Qt
+  bool ok = false;
+  value = QByteArray::fromRawData(first, static_cast<int>(last - first)).toFloat(&ok);
+  return ok;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool EbsdTextParser::parseInt32(const char* first, const char* last, int32_t& value)
+{
+  first = skipSpace(first, last);
+  while(last != first && isSpace(*(last - 1)))
+  {
+    --last;
+  }
+  const char* pos = first;
+  bool negative = false;
+  if(pos != last && (*pos == '-' || *pos == '+'))
+  {
+    negative = (*pos == '-');
+    ++pos;
+  }
+  if(pos == last)
+  {
+    return false;
+  }
+  int64_t result = 0;
+  for(; pos != last; ++pos)
+  {
+    if(!isDigit(*pos))
+    {
+      return false;
+    }
+    result = result * 10 + (*pos - '0');
+    if(result > 2147483648LL)
+    {
+      return false;
+    }
+  }
+  result = negative ? -result : result;
+  if(result > 2147483647LL)
+  {
+    return false;
+  }
+  value = static_cast<int32_t>(result);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t EbsdTextParser::countLines(const char* begin, const char* end)
+{
+  size_t numLines = 0;
+  const char* pos = begin;
+  while(pos != end)
+  {
+    const char* lineEnd = findLineEnd(pos, end);
+    if(skipSpace(pos, lineEnd) != lineEnd)
+    {
+      numLines++;
+    }
+    pos = (lineEnd == end) ? end : lineEnd + 1;
+  }
+  return numLines;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool EbsdTextParser::convertFloat(const char* first, const char* last, bool decimalComma, float& value)
+{
+  if(!decimalComma || nullptr == ::memchr(first, ',', static_cast<size_t>(last - first)))
+  {
+    return parseFloat(first, last, value);
+  }
+  char token[64];
+  size_t length = static_cast<size_t>(last - first);
+  if(length > sizeof(token))
+  {
+    return false;
+  }
+  std::replace_copy(first, last, token, ',', '.');
+  return parseFloat(token, token + length, value);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void EbsdTextParser::parseChunk(Chunk& chunk, const std::vector<Column>& columns, size_t firstRow, size_t endRow) const
+{
+  size_t row = chunk.firstRow;
+  const char* pos = chunk.begin;
+  while(pos != chunk.end && row < endRow)
+  {
+    const char* lineEnd = findLineEnd(pos, chunk.end);
+    const char* token = skipSpace(pos, lineEnd);
+    if(token == lineEnd || row < firstRow)
+    {
+      row += (token == lineEnd) ? 0 : 1;
+      pos = (lineEnd == chunk.end) ? chunk.end : lineEnd + 1;
+      continue;
+    }
+    // White space at the end of the line is not an empty last value
+    const char* valuesEnd = lineEnd;
+    while(isSpace(*(valuesEnd - 1)))
+    {
+      --valuesEnd;
+    }
+
+    size_t index = row - firstRow;
+    size_t c = 0;
+    for(; c < columns.size() && nullptr != token; c++)
+    {
+      const char* tokenEnd = findTokenEnd(token, valuesEnd, m_Delimiter);
+      const Column& column = columns[c];
+      bool ok = true;
+      switch(column.type)
+      {
+      case ColumnType::Float:
+      {
+        float value = 0.0f;
+        ok = convertFloat(token, tokenEnd, m_DecimalComma, value);
+        static_cast<float*>(column.ptr)[index] = ok ? value : 0.0f;
+        break;
+      }
+      case ColumnType::Int32:
+      case ColumnType::Int32OrFloat:
+      {
+        int32_t value = 0;
+        ok = parseInt32(token, tokenEnd, value);
+        if(!ok && column.type == ColumnType::Int32OrFloat)
+        {
+          float fValue = 0.0f;
+          ok = convertFloat(token, tokenEnd, m_DecimalComma, fValue);
+          value = static_cast<int32_t>(fValue);
+        }
+        static_cast<int32_t*>(column.ptr)[index] = ok ? value : 0;
+        break;
+      }
+      case ColumnType::Skip:
+        break;
+      }
+      if(!ok && !column.lenient)
+      {
+        chunk.errorRow = static_cast<int64_t>(row);
+        chunk.errorColumn = static_cast<int>(c);
+        chunk.errorLine = pos;
+        return;
+      }
+      token = findNextToken(tokenEnd, valuesEnd, m_Delimiter);
+    }
+
+    if(m_RequireAllColumns && (c != columns.size() || nullptr != token))
+    {
+      int tokenCount = static_cast<int>(c);
+      for(; nullptr != token; tokenCount++)
+      {
+        token = findNextToken(findTokenEnd(token, valuesEnd, m_Delimiter), valuesEnd, m_Delimiter);
+      }
+      chunk.errorRow = static_cast<int64_t>(row);
+      chunk.errorTokenCount = tokenCount;
+      chunk.errorLine = pos;
+      return;
+    }
+    row++;
+    pos = (lineEnd == chunk.end) ? chunk.end : lineEnd + 1;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int64_t EbsdTextParser::parse(const char* dataBegin, const char* dataEnd, const std::vector<Column>& columns, size_t numRows, size_t firstRow)
+{
+  m_ErrorRow = -1;
+  m_ErrorColumn = -1;
+  m_ErrorTokenCount = -1;
+  m_ErrorLine.clear();
+  if(nullptr == dataBegin || dataBegin >= dataEnd)
+  {
+    return 0;
+  }
+
+  size_t numBytes = static_cast<size_t>(dataEnd - dataBegin);
+  size_t numThreads = (m_NumberOfThreads > 0) ? static_cast<size_t>(m_NumberOfThreads) : std::thread::hardware_concurrency();
+  numThreads = std::max<size_t>(1, std::min(numThreads, numBytes / std::max<size_t>(1, m_MinimumChunkSize)));
+
+  // Split the data at line boundaries
+  std::vector<Chunk> chunks(numThreads);
+  const char* pos = dataBegin;
+  for(size_t i = 0; i < numThreads; i++)
+  {
+    chunks[i].begin = pos;
+    pos = (i + 1 == numThreads) ? dataEnd : nextLine(std::max(pos, dataBegin + numBytes * (i + 1) / numThreads), dataEnd);
+    chunks[i].end = pos;
+  }
+
+  auto runChunks = [&chunks, numThreads](const std::function<void(Chunk&)>& work) {
+    std::vector<std::thread> threads;
+    for(size_t i = 1; i < numThreads; i++)
+    {
+      threads.emplace_back(work, std::ref(chunks[i]));
+    }
+    work(chunks[0]);
+    for(std::thread& thread : threads)
+    {
+      thread.join();
+    }
+  };
+
+  // The first row of every chunk is only known once the lines before it are counted
+  if(numThreads > 1)
+  {
+    runChunks([](Chunk& chunk) { chunk.numLines = countLines(chunk.begin, chunk.end); });
+  }
+  size_t numLines = 0;
+  for(Chunk& chunk : chunks)
+  {
+    chunk.firstRow = numLines;
+    numLines += chunk.numLines;
+  }
+
+  size_t endRow = firstRow + numRows;
+  runChunks([this, &columns, firstRow, endRow](Chunk& chunk) { parseChunk(chunk, columns, firstRow, endRow); });
+
+  for(const Chunk& chunk : chunks)
+  {
+    if(chunk.errorRow >= 0)
+    {
+      m_ErrorRow = chunk.errorRow;
+      m_ErrorColumn = chunk.errorColumn;
+      m_ErrorTokenCount = chunk.errorTokenCount;
+      m_ErrorLine = QByteArray(chunk.errorLine, static_cast<int>(findLineEnd(chunk.errorLine, dataEnd) - chunk.errorLine));
+      return -1;
+    }
+  }
+  if(numThreads == 1)
+  {
+    numLines = countLines(chunks[0].begin, chunks[0].end);
+  }
+  return static_cast<int64_t>(std::min(numLines, endRow) - std::min(numLines, firstRow));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int64_t EbsdTextParser::getErrorRow() const
+{
+  return m_ErrorRow;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int EbsdTextParser::getErrorColumn() const
+{
+  return m_ErrorColumn;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int EbsdTextParser::getErrorTokenCount() const
+{
+  return m_ErrorTokenCount;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QByteArray EbsdTextParser::getErrorLine() const
+{
+  return m_ErrorLine;
+}
@@ -0,0 +1,206 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QFile>
+#include <QtCore/QString>
+
+#include "EbsdLib/EbsdLib.h"
+#include "EbsdLib/EbsdSetGetMacros.h"
+
+/**
+ * @class EbsdTextParser EbsdTextParser.h EbsdLib/EbsdTextParser.h
+ * @brief Parses the data section of an EBSD text file (.ang, .ctf) straight into the column
+ * arrays of a reader. Values are separated by white space or, if a Delimiter is set, by that
+ * character. The file is memory mapped, the data section is split into chunks at line
+ * boundaries and the chunks are parsed on several threads. No memory is allocated per line
+ * or per value.
+ *
+ * Lines that only hold white space are skipped. Unless RequireAllColumns is set, values past
+ * the last column are ignored and columns missing at the end of a line leave the array untouched.
+ */
+class EbsdLib_EXPORT EbsdTextParser
+{
+public:
+  EbsdTextParser();
+  ~EbsdTextParser();
+
+  enum class ColumnType
+  {
+    Float,
+    Int32,
+    Int32OrFloat, //!< An integer column where some files write floats; those values are truncated
+    Skip
+  };
+
+  struct Column
+  {
+    ColumnType type = ColumnType::Skip;
+    void* ptr = nullptr;
+    bool lenient = false; //!< Store 0 for values that do not convert instead of failing
+  };
+
+  /**
+   * @brief The number of threads to parse with. 0 (the default) uses the number of cores.
+   */
+  EBSD_INSTANCE_PROPERTY(int, NumberOfThreads)
+
+  /**
+   * @brief The smallest number of bytes one thread parses; smaller data sections use fewer
+   * threads. Defaults to 1 MB, since smaller chunks are not worth a thread of their own.
+   */
+  EBSD_INSTANCE_PROPERTY(size_t, MinimumChunkSize)
+
+  /**
+   * @brief The character between two values, such as '\t' for .ctf files. Every delimiter
+   * separates two values, so an empty field is a value that does not convert. '\0' (the
+   * default) separates values by any run of white space.
+   */
+  EBSD_INSTANCE_PROPERTY(char, Delimiter)
+
+  /**
+   * @brief Treat ',' in floating point values as the decimal point, as European HKL exports do.
+   */
+  EBSD_INSTANCE_PROPERTY(bool, DecimalComma)
+
+  /**
+   * @brief Fail on any line that does not have exactly one value per column.
+   */
+  EBSD_INSTANCE_PROPERTY(bool, RequireAllColumns)
+
+  /**
+   * @brief Memory maps the file, or reads it into memory if it can not be mapped.
+   * @param filePath
+   * @return Zero on success, a negative value if the file could not be opened
+   */
+  int open(const QString& filePath);
+
+  /**
+   * @brief Unmaps and closes the file. The destructor does this as well.
+   */
+  void close();
+
+  /**
+   * @brief The first byte of the file
+   */
+  const char* begin() const;
+
+  /**
+   * @brief One past the last byte of the file
+   */
+  const char* end() const;
+
+  /**
+   * @brief Returns the start of the first line at or after pos that does not start with
+   * commentChar, i.e. the start of the data section for files with a '#' header.
+   */
+  static const char* skipLinesStartingWith(const char* pos, const char* end, char commentChar);
+
+  /**
+   * @brief Returns the start of the line following the one pos is on.
+   */
+  static const char* nextLine(const char* pos, const char* end);
+
+  /**
+   * @brief Parses at most numRows lines of [dataBegin, dataEnd) into the columns, starting at
+   * data row firstRow. Row firstRow + i of the data is written to index i of every column array;
+   * the rows before firstRow are skipped without being converted.
+   * @return The number of rows parsed, or -1 on a value that did not convert or a line with the
+   * wrong number of values. In that case getErrorRow(), getErrorColumn(), getErrorTokenCount()
+   * and getErrorLine() describe the first bad line.
+   */
+  int64_t parse(const char* dataBegin, const char* dataEnd, const std::vector<Column>& columns, size_t numRows, size_t firstRow = 0);
+
+  int64_t getErrorRow() const;
+  /** @brief The column of the value that did not convert, -1 for a line with the wrong number of values */
+  int getErrorColumn() const;
+  /** @brief The number of values on a line with the wrong number of values, -1 otherwise */
+  int getErrorTokenCount() const;
+  QByteArray getErrorLine() const;
+
+  /**
+   * @brief Converts the token [first, last) to a float. Plain decimal values are converted
+   * without allocating and give the same result as QByteArray::toFloat(), which is used for
+   * anything else.
+   * @return false if the token is not a number
+   */
+  static bool parseFloat(const char* first, const char* last, float& value);
+
+  /**
+   * @brief Converts the token [first, last) to a 32 bit integer without allocating. Like
+   * QByteArray::toInt(), white space around the digits is ignored.
+   * @return false if the token is not an integer or does not fit
+   */
+  static bool parseInt32(const char* first, const char* last, int32_t& value);
+
+private:
+  struct Chunk
+  {
+    const char* begin = nullptr;
+    const char* end = nullptr;
+    size_t numLines = 0;
+    size_t firstRow = 0;
+    int64_t errorRow = -1;
+    int errorColumn = -1;
+    int errorTokenCount = -1;
+    const char* errorLine = nullptr;
+  };
+
+  static bool convertFloat(const char* first, const char* last, bool decimalComma, float& value);
+  static size_t countLines(const char* begin, const char* end);
+  void parseChunk(Chunk& chunk, const std::vector<Column>& columns, size_t firstRow, size_t endRow) const;
+
+  QFile m_File;
+  uchar* m_Map = nullptr;
+  QByteArray m_Contents;
+  const char* m_Begin = nullptr;
+  const char* m_End = nullptr;
+
+  int64_t m_ErrorRow = -1;
+  int m_ErrorColumn = -1;
+  int m_ErrorTokenCount = -1;
+  QByteArray m_ErrorLine;
+
+public:
+  EbsdTextParser(const EbsdTextParser&) = delete;            // Copy Constructor Not Implemented
+  EbsdTextParser(EbsdTextParser&&) = delete;                 // Move Constructor Not Implemented
+  EbsdTextParser& operator=(const EbsdTextParser&) = delete; // Copy Assignment Not Implemented
+  EbsdTextParser& operator=(EbsdTextParser&&) = delete;      // Move Assignment Not Implemented
+};
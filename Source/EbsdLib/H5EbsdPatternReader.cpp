@@ -0,0 +1,233 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "H5EbsdPatternReader.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "H5Support/QH5Utilities.h"
+
+#if defined (H5Support_NAMESPACE)
+using namespace H5Support_NAMESPACE;
+#endif
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5EbsdPatternReader::H5EbsdPatternReader()
+: m_ErrorCode(0)
+, m_ChunkCacheSize(64 * 1024 * 1024)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5EbsdPatternReader::~H5EbsdPatternReader()
+{
+  close();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int H5EbsdPatternReader::open(const QString& fileName, const QString& datasetPath)
+{
+  close();
+  m_FileId = QH5Utilities::openFile(fileName, true);
+  if(m_FileId < 0)
+  {
+    setErrorCode(-90600);
+    setErrorMessage(QString("Could not open HDF5 file '%1'").arg(fileName));
+    return getErrorCode();
+  }
+
+  // Reading a batch touches every chunk that holds one of its patterns, so give the cache room for
+  // several chunks. w0 = 1 evicts chunks that were read completely first.
+  hid_t dapl = H5Pcreate(H5P_DATASET_ACCESS);
+  H5Pset_chunk_cache(dapl, 12421, m_ChunkCacheSize, 1.0);
+  m_DatasetId = H5Dopen(m_FileId, datasetPath.toLatin1().data(), dapl);
+  H5Pclose(dapl);
+  if(m_DatasetId < 0)
+  {
+    close();
+    setErrorCode(-90601);
+    setErrorMessage(QString("Could not open the pattern data set '%1' in file '%2'").arg(datasetPath, fileName));
+    return getErrorCode();
+  }
+
+  hid_t fileSpace = H5Dget_space(m_DatasetId);
+  m_Rank = H5Sget_simple_extent_ndims(fileSpace);
+  std::vector<hsize_t> dims(static_cast<size_t>(std::max(m_Rank, 0)), 0);
+  if(m_Rank > 0)
+  {
+    H5Sget_simple_extent_dims(fileSpace, dims.data(), nullptr);
+  }
+  H5Sclose(fileSpace);
+  if(m_Rank != 2 && m_Rank != 3)
+  {
+    close();
+    setErrorCode(-90602);
+    setErrorMessage(QString("The pattern data set '%1' has rank %2. Patterns must be stored as a 2D or 3D data set").arg(datasetPath).arg(m_Rank));
+    return getErrorCode();
+  }
+  m_NumberOfPatterns = static_cast<size_t>(dims[0]);
+  m_PatternDims[0] = (m_Rank == 3) ? static_cast<size_t>(dims[1]) : 1;
+  m_PatternDims[1] = static_cast<size_t>(dims[m_Rank - 1]);
+
+  m_PatternsPerChunk = 0;
+  hid_t dcpl = H5Dget_create_plist(m_DatasetId);
+  if(dcpl >= 0)
+  {
+    if(H5Pget_layout(dcpl) == H5D_CHUNKED)
+    {
+      std::vector<hsize_t> chunkDims(static_cast<size_t>(m_Rank), 0);
+      if(H5Pget_chunk(dcpl, m_Rank, chunkDims.data()) == m_Rank)
+      {
+        m_PatternsPerChunk = static_cast<size_t>(chunkDims[0]);
+      }
+    }
+    H5Pclose(dcpl);
+  }
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void H5EbsdPatternReader::close()
+{
+  if(m_DatasetId >= 0)
+  {
+    H5Dclose(m_DatasetId);
+    m_DatasetId = -1;
+  }
+  if(m_FileId >= 0)
+  {
+    QH5Utilities::closeFile(m_FileId);
+    m_FileId = -1;
+  }
+  m_Rank = 0;
+  m_NumberOfPatterns = 0;
+  m_PatternDims = {{0, 0}};
+  m_PatternsPerChunk = 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool H5EbsdPatternReader::isOpen() const
+{
+  return m_DatasetId >= 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t H5EbsdPatternReader::getNumberOfPatterns() const
+{
+  return m_NumberOfPatterns;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::array<size_t, 2> H5EbsdPatternReader::getPatternDims() const
+{
+  return m_PatternDims;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t H5EbsdPatternReader::getPatternSize() const
+{
+  return m_PatternDims[0] * m_PatternDims[1];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t H5EbsdPatternReader::getPatternsPerChunk() const
+{
+  return m_PatternsPerChunk;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int H5EbsdPatternReader::readPatterns(size_t firstPattern, size_t numPatterns, uint8_t* buffer)
+{
+  if(!isOpen())
+  {
+    setErrorCode(-90603);
+    setErrorMessage("No pattern data set is open");
+    return getErrorCode();
+  }
+  if(firstPattern > m_NumberOfPatterns || numPatterns > m_NumberOfPatterns - firstPattern)
+  {
+    setErrorCode(-90604);
+    setErrorMessage(QString("Patterns %1 to %2 were requested but the data set only holds %3 patterns").arg(firstPattern).arg(firstPattern + numPatterns).arg(m_NumberOfPatterns));
+    return getErrorCode();
+  }
+  if(numPatterns == 0)
+  {
+    return 0;
+  }
+
+  hsize_t start[3] = {static_cast<hsize_t>(firstPattern), 0, 0};
+  hsize_t count[3] = {static_cast<hsize_t>(numPatterns), static_cast<hsize_t>(m_PatternDims[0]), static_cast<hsize_t>(m_PatternDims[1])};
+  if(m_Rank == 2)
+  {
+    count[1] = static_cast<hsize_t>(m_PatternDims[1]);
+  }
+  hid_t fileSpace = H5Dget_space(m_DatasetId);
+  hid_t memSpace = H5Screate_simple(m_Rank, count, nullptr);
+  herr_t err = H5Sselect_hyperslab(fileSpace, H5S_SELECT_SET, start, nullptr, count, nullptr);
+  if(err >= 0)
+  {
+    err = H5Dread(m_DatasetId, H5T_NATIVE_UINT8, memSpace, fileSpace, H5P_DEFAULT, buffer);
+  }
+  H5Sclose(memSpace);
+  H5Sclose(fileSpace);
+  if(err < 0)
+  {
+    setErrorCode(-90605);
+    setErrorMessage(QString("Error reading patterns %1 to %2").arg(firstPattern).arg(firstPattern + numPatterns));
+    return getErrorCode();
+  }
+  return 0;
+}
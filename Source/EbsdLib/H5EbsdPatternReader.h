@@ -0,0 +1,142 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <array>
+
+#include <hdf5.h>
+
+#include <QtCore/QString>
+
+#include "EbsdLib/EbsdLib.h"
+#include "EbsdLib/EbsdSetGetMacros.h"
+
+/**
+ * @class H5EbsdPatternReader H5EbsdPatternReader.h EbsdLib/H5EbsdPatternReader.h
+ * @brief Gives access to the EBSD patterns of a scan that is stored in an HDF5 file
+ * (H5Esprit 'RawPatterns', H5OIM 'Pattern') without loading all of them into memory.
+ * Patterns are read in batches of consecutive scan points with hyperslab selections.
+ * Chunked pattern data sets are read through a chunk cache of ChunkCacheSize bytes.
+ *
+ * The data set is expected to be laid out as [scan point][row][column] or as
+ * [scan point][value]. The values are converted to uint8_t when read.
+ */
+class EbsdLib_EXPORT H5EbsdPatternReader
+{
+  public:
+    EBSD_SHARED_POINTERS(H5EbsdPatternReader)
+    EBSD_STATIC_NEW_MACRO(H5EbsdPatternReader)
+    EBSD_TYPE_MACRO(H5EbsdPatternReader)
+
+    virtual ~H5EbsdPatternReader();
+
+    EBSD_INSTANCE_PROPERTY(int, ErrorCode)
+
+    EBSD_INSTANCE_STRING_PROPERTY(ErrorMessage)
+
+    /**
+     * @brief The size of the HDF5 chunk cache for chunked pattern data sets in bytes. This
+     * must be set before open(). The default is 64MB.
+     */
+    EBSD_INSTANCE_PROPERTY(size_t, ChunkCacheSize)
+
+    /**
+     * @brief Opens the pattern data set. Any data set that is already open is closed first.
+     * @param fileName The HDF5 file
+     * @param datasetPath The path of the pattern data set in the file
+     * @return Zero on success, a negative value on error
+     */
+    int open(const QString& fileName, const QString& datasetPath);
+
+    /**
+     * @brief Closes the pattern data set and the file
+     */
+    void close();
+
+    /**
+     * @brief Returns true if a pattern data set is open
+     */
+    bool isOpen() const;
+
+    /**
+     * @brief Returns the number of patterns (scan points) in the data set
+     */
+    size_t getNumberOfPatterns() const;
+
+    /**
+     * @brief Returns the number of rows and columns of each pattern as stored in the data set
+     */
+    std::array<size_t, 2> getPatternDims() const;
+
+    /**
+     * @brief Returns the number of values in each pattern
+     */
+    size_t getPatternSize() const;
+
+    /**
+     * @brief Returns the number of patterns in each chunk of a chunked data set or zero if the data
+     * set is contiguous. Batches that are a multiple of this size read every chunk only once.
+     */
+    size_t getPatternsPerChunk() const;
+
+    /**
+     * @brief Reads numPatterns consecutive patterns starting at firstPattern into buffer which must
+     * hold numPatterns * getPatternSize() values.
+     * @param firstPattern The index of the first pattern to read
+     * @param numPatterns The number of patterns to read
+     * @param buffer The destination of the patterns
+     * @return Zero on success, a negative value on error
+     */
+    int readPatterns(size_t firstPattern, size_t numPatterns, uint8_t* buffer);
+
+  protected:
+    H5EbsdPatternReader();
+
+  private:
+    hid_t m_FileId = -1;
+    hid_t m_DatasetId = -1;
+    int m_Rank = 0;
+    size_t m_NumberOfPatterns = 0;
+    std::array<size_t, 2> m_PatternDims = {{0, 0}};
+    size_t m_PatternsPerChunk = 0;
+
+  public:
+    H5EbsdPatternReader(const H5EbsdPatternReader&) = delete; // Copy Constructor Not Implemented
+    H5EbsdPatternReader(H5EbsdPatternReader&&) = delete;      // Move Constructor Not Implemented
+    H5EbsdPatternReader& operator=(const H5EbsdPatternReader&) = delete; // Copy Assignment Not Implemented
+    H5EbsdPatternReader& operator=(H5EbsdPatternReader&&) = delete;      // Move Assignment Not Implemented
+};
+
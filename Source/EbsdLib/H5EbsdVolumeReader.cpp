@@ -36,12 +36,72 @@
 
 #include "H5EbsdVolumeReader.h"
 
+#include <algorithm>
+#include <cstring>
+
+#include "H5Support/H5ScopedSentinel.h"
+#include "H5Support/QH5Utilities.h"
 
 
 #if defined (H5Support_NAMESPACE)
 using namespace H5Support_NAMESPACE;
 #endif
 
+namespace
+{
+const size_t k_MinChunkCacheBytes = 1024 * 1024;
+const size_t k_MaxChunkCacheBytes = 64 * 1024 * 1024;
+
+/**
+ * @brief Opens a slice data set. Data sets written with a chunked (and possibly compressed)
+ * layout are opened with a chunk cache large enough to hold every chunk of the slice so that
+ * each chunk is read and decompressed only once, up to a limit of 64MB.
+ */
+hid_t openSliceDataset(hid_t dataGid, const QString& arrayName)
+{
+  QByteArray name = arrayName.toLatin1();
+  hid_t did = H5Dopen(dataGid, name.data(), H5P_DEFAULT);
+  if(did < 0)
+  {
+    return did;
+  }
+  hid_t dcpl = H5Dget_create_plist(did);
+  bool chunked = dcpl >= 0 && H5Pget_layout(dcpl) == H5D_CHUNKED;
+  if(dcpl >= 0)
+  {
+    H5Pclose(dcpl);
+  }
+  if(!chunked)
+  {
+    return did;
+  }
+
+  hid_t typeId = H5Dget_type(did);
+  hid_t spaceId = H5Dget_space(did);
+  hssize_t numPoints = H5Sget_simple_extent_npoints(spaceId);
+  size_t typeSize = H5Tget_size(typeId);
+  H5Sclose(spaceId);
+  H5Tclose(typeId);
+  size_t cacheBytes = numPoints > 0 ? static_cast<size_t>(numPoints) * typeSize : 0;
+  cacheBytes = std::min(std::max(cacheBytes, k_MinChunkCacheBytes), k_MaxChunkCacheBytes);
+
+  hid_t dapl = H5Pcreate(H5P_DATASET_ACCESS);
+  // Each chunk is read exactly once so fully read chunks are the first to be evicted
+  if(dapl < 0 || H5Pset_chunk_cache(dapl, 12421, cacheBytes, 1.0) < 0)
+  {
+    if(dapl >= 0)
+    {
+      H5Pclose(dapl);
+    }
+    return did;
+  }
+  H5Dclose(did);
+  did = H5Dopen(dataGid, name.data(), dapl);
+  H5Pclose(dapl);
+  return did;
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -51,7 +111,11 @@ H5EbsdVolumeReader::H5EbsdVolumeReader() :
   m_SliceEnd(0),
   m_ManageMemory(true),
   m_NumberOfElements(0),
-  m_ReadAllArrays(true)
+  m_ReadAllArrays(true),
+  m_RoiXFull(0),
+  m_RoiYFull(0),
+  m_RoiXStart(0),
+  m_RoiYStart(0)
 {
 }
 
@@ -130,3 +194,304 @@ void H5EbsdVolumeReader::readAllArrays(bool b)
 {
   m_ReadAllArrays = b;
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void H5EbsdVolumeReader::setDestination(const QString& arrayName, void* ptr, int numComponents, int componentIndex)
+{
+  Destination destination;
+  destination.ptr = ptr;
+  destination.numComponents = numComponents;
+  destination.componentIndex = componentIndex;
+  m_Destinations[arrayName] = destination;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void H5EbsdVolumeReader::clearDestinations()
+{
+  // Let go of the arrays of the last load first so no destination is ever freed
+  deletePointers();
+  m_Destinations.clear();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5EbsdVolumeReader::Destination H5EbsdVolumeReader::getDestination(const QString& arrayName) const
+{
+  return m_Destinations.value(arrayName, Destination());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool H5EbsdVolumeReader::isDestinationPointer(const void* ptr) const
+{
+  if(nullptr == ptr)
+  {
+    return false;
+  }
+  for(const Destination& destination : m_Destinations)
+  {
+    if(destination.ptr == ptr)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void H5EbsdVolumeReader::setRegionOfInterest(int64_t xFull, int64_t yFull, int64_t xStart, int64_t yStart)
+{
+  m_RoiXFull = xFull;
+  m_RoiYFull = yFull;
+  m_RoiXStart = xStart;
+  m_RoiYStart = yStart;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void H5EbsdVolumeReader::clearRegionOfInterest()
+{
+  m_RoiXFull = 0;
+  m_RoiYFull = 0;
+  m_RoiXStart = 0;
+  m_RoiYStart = 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int H5EbsdVolumeReader::getSliceWindow(int64_t xpoints, int64_t ypoints, int64_t xSlice, int64_t ySlice, SliceWindow& window)
+{
+  // Without a region of interest the volume is the full plane
+  bool hasRoi = (m_RoiXFull > 0 && m_RoiYFull > 0);
+  int64_t xFull = hasRoi ? m_RoiXFull : xpoints;
+  int64_t yFull = hasRoi ? m_RoiYFull : ypoints;
+  int64_t xRoi = hasRoi ? m_RoiXStart : 0;
+  int64_t yRoi = hasRoi ? m_RoiYStart : 0;
+  if(xSlice > xFull || ySlice > yFull)
+  {
+    setErrorCode(-90021);
+    setErrorMessage(QString("The slice (%1 x %2) is larger than the volume (%3 x %4)").arg(xSlice).arg(ySlice).arg(xFull).arg(yFull));
+    return getErrorCode();
+  }
+
+  // Slices that are smaller than the full plane are centered in it
+  int64_t xOrigin = (xFull - xSlice) / 2;
+  int64_t yOrigin = (yFull - ySlice) / 2;
+  int64_t xBegin = std::max(xOrigin, xRoi);
+  int64_t yBegin = std::max(yOrigin, yRoi);
+  int64_t xEnd = std::min(xOrigin + xSlice, xRoi + xpoints);
+  int64_t yEnd = std::min(yOrigin + ySlice, yRoi + ypoints);
+
+  window.xSlice = xSlice;
+  window.ySlice = ySlice;
+  window.sliceX = xBegin - xOrigin;
+  window.sliceY = yBegin - yOrigin;
+  window.volumeX = xBegin - xRoi;
+  window.volumeY = yBegin - yRoi;
+  window.xCount = std::max<int64_t>(0, xEnd - xBegin);
+  window.yCount = std::max<int64_t>(0, yEnd - yBegin);
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+herr_t H5EbsdVolumeReader::selectSliceWindow(hid_t fileSpace, const SliceWindow& window)
+{
+  if(window.xCount == window.xSlice && window.yCount == window.ySlice)
+  {
+    return H5Sselect_all(fileSpace);
+  }
+  // The dataset holds the slice row by row: take xCount values out of each of yCount rows
+  hsize_t start = static_cast<hsize_t>(window.sliceY * window.xSlice + window.sliceX);
+  hsize_t stride = static_cast<hsize_t>(window.xSlice);
+  hsize_t count = static_cast<hsize_t>(window.yCount);
+  hsize_t block = static_cast<hsize_t>(window.xCount);
+  return H5Sselect_hyperslab(fileSpace, H5S_SELECT_SET, &start, &stride, &count, &block);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int H5EbsdVolumeReader::readSliceIntoVolume(hid_t dataGid, const QString& arrayName, hid_t memType, void* volume, int64_t xpoints, int64_t ypoints, int64_t zIndex, const SliceWindow& window,
+                                            int numComponents, int componentIndex)
+{
+  if(nullptr == volume)
+  {
+    return 0;
+  }
+
+  size_t typeSize = H5Tget_size(memType);
+  size_t tupleSize = typeSize * static_cast<size_t>(numComponents);
+  size_t planeTuples = static_cast<size_t>(xpoints * ypoints);
+  uint8_t* plane = static_cast<uint8_t*>(volume) + static_cast<size_t>(zIndex) * planeTuples * tupleSize;
+
+  // The voxels of the plane outside of the window are not covered by the read
+  if(window.xCount != xpoints || window.yCount != ypoints)
+  {
+    uint8_t* value = plane + static_cast<size_t>(componentIndex) * typeSize;
+    for(size_t i = 0; i < planeTuples; i++)
+    {
+      ::memset(value, 0, typeSize);
+      value += tupleSize;
+    }
+  }
+  if(window.xCount == 0 || window.yCount == 0)
+  {
+    return 0;
+  }
+
+  hid_t did = openSliceDataset(dataGid, arrayName);
+  if(did < 0)
+  {
+    setErrorCode(-90020);
+    setErrorMessage(QString("Error reading dataset '%1' from the HDF5 file. This data set is required to be in the file because either "
+                            "the program is set to read ALL the Data arrays or the program was instructed to read this array.").arg(arrayName));
+    return getErrorCode();
+  }
+
+  herr_t err = 0;
+  hid_t fileSpace = H5Dget_space(did);
+  hssize_t numPoints = H5Sget_simple_extent_npoints(fileSpace);
+  if(numPoints != window.xSlice * window.ySlice)
+  {
+    H5Sclose(fileSpace);
+    H5Dclose(did);
+    setErrorCode(-90022);
+    setErrorMessage(QString("Dataset '%1' has %2 values but the slice has %3 x %4 voxels").arg(arrayName).arg(numPoints).arg(window.xSlice).arg(window.ySlice));
+    return getErrorCode();
+  }
+
+  // Describe the plane as [y][x][component] and select the block the window lands in
+  hsize_t memDims[3] = {static_cast<hsize_t>(ypoints), static_cast<hsize_t>(xpoints), static_cast<hsize_t>(numComponents)};
+  hsize_t start[3] = {static_cast<hsize_t>(window.volumeY), static_cast<hsize_t>(window.volumeX), static_cast<hsize_t>(componentIndex)};
+  hsize_t count[3] = {static_cast<hsize_t>(window.yCount), static_cast<hsize_t>(window.xCount), 1};
+  hid_t memSpace = H5Screate_simple(3, memDims, nullptr);
+  err = H5Sselect_hyperslab(memSpace, H5S_SELECT_SET, start, nullptr, count, nullptr);
+  if(err >= 0)
+  {
+    err = selectSliceWindow(fileSpace, window);
+  }
+  if(err >= 0)
+  {
+    err = H5Dread(did, memType, memSpace, fileSpace, H5P_DEFAULT, plane);
+  }
+  H5Sclose(memSpace);
+  H5Sclose(fileSpace);
+  H5Dclose(did);
+  if(err < 0)
+  {
+    setErrorCode(-90020);
+    setErrorMessage(QString("Error reading dataset '%1' from the HDF5 file.").arg(arrayName));
+    return getErrorCode();
+  }
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int H5EbsdVolumeReader::readSliceDimensions(hid_t sliceGid, const QString& hdf5Path, int64_t& xSlice, int64_t& ySlice)
+{
+  // This class should be subclassed and this method implemented.
+  return -1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void H5EbsdVolumeReader::sliceLoaded(int64_t xpoints, int64_t ypoints, int64_t zIndex, const SliceWindow& window)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int H5EbsdVolumeReader::loadSlices(const QVector<SliceArray>& arrays, int64_t xpoints, int64_t ypoints, int64_t zpoints, uint32_t ZDir)
+{
+  // If no stacking order preference was passed, read it from the file and use that value
+  if(ZDir == SIMPL::RefFrameZDir::UnknownRefFrameZDirection)
+  {
+    ZDir = getStackingOrder();
+  }
+
+  hid_t fileId = QH5Utilities::openFile(getFileName(), true);
+  if(fileId < 0)
+  {
+    setErrorMessage("Error: Could not open .h5ebsd file for reading.");
+    setErrorCode(-90000);
+    return getErrorCode();
+  }
+  H5ScopedFileSentinel sentinel(&fileId, false);
+
+  int err = 0;
+  for(int64_t slice = 0; slice < zpoints; ++slice)
+  {
+    if(getCancel())
+    {
+      break;
+    }
+    // Only the header of each slice is parsed; the data goes directly from the file into the volume
+    QString hdf5Path = QString::number(slice + getSliceStart());
+    hid_t gid = H5Gopen(fileId, hdf5Path.toLatin1().data(), H5P_DEFAULT);
+    if(gid < 0)
+    {
+      setErrorCode(-90011);
+      setErrorMessage(QString("Could not open slice group '%1'").arg(hdf5Path));
+      return getErrorCode();
+    }
+    int64_t xSlice = 0;
+    int64_t ySlice = 0;
+    err = readSliceDimensions(gid, hdf5Path, xSlice, ySlice);
+    SliceWindow window;
+    if(err >= 0)
+    {
+      err = getSliceWindow(xpoints, ypoints, xSlice, ySlice, window);
+    }
+    if(err < 0)
+    {
+      H5Gclose(gid);
+      return err;
+    }
+    hid_t dataGid = H5Gopen(gid, Ebsd::H5Ebsd::Data.toLatin1().data(), H5P_DEFAULT);
+    if(dataGid < 0)
+    {
+      setErrorCode(-90012);
+      setErrorMessage(QString("Could not open the 'Data' Group of slice '%1'").arg(hdf5Path));
+      H5Gclose(gid);
+      return getErrorCode();
+    }
+
+    int64_t zval = (ZDir == SIMPL::RefFrameZDir::HightoLow) ? (zpoints - 1) - slice : slice;
+    for(const SliceArray& array : arrays)
+    {
+      if(!array.required && H5Lexists(dataGid, array.name.toLatin1().data(), H5P_DEFAULT) <= 0)
+      {
+        continue;
+      }
+      err = readSliceIntoVolume(dataGid, array.name, array.memType, array.destination.ptr, xpoints, ypoints, zval, window, array.destination.numComponents, array.destination.componentIndex);
+      if(err < 0)
+      {
+        break;
+      }
+    }
+    H5Gclose(dataGid);
+    H5Gclose(gid);
+    if(err < 0)
+    {
+      return err;
+    }
+    sliceLoaded(xpoints, ypoints, zval, window);
+  }
+  return err;
+}
@@ -36,6 +36,9 @@
 
 #pragma once
 
+#include <hdf5.h>
+
+#include <QtCore/QMap>
 #include <QtCore/QString>
 #include <QtCore/QVector>
 #include <QtCore/QSet>
@@ -142,12 +145,173 @@ class EbsdLib_EXPORT H5EbsdVolumeReader : public H5EbsdVolumeInfo
     virtual void readAllArrays(bool b);
     virtual bool getReadAllArrays();
 
+    /**
+     * @brief Makes loadData() read the named array straight into memory owned by the caller (typically
+     * the DataArray the values end up in) instead of into memory allocated by the reader. The memory
+     * must hold xpoints * ypoints * zpoints tuples of numComponents values and the array is written
+     * into component componentIndex of every tuple. The reader never frees this memory. Single
+     * component destinations are also returned by getPointerByName().
+     * @param arrayName The name of the array in the file
+     * @param ptr Pointer to the destination memory
+     * @param numComponents The number of values per tuple in the destination
+     * @param componentIndex The component of each tuple that the array is written into
+     */
+    virtual void setDestination(const QString& arrayName, void* ptr, int numComponents = 1, int componentIndex = 0);
+
+    /**
+     * @brief Removes every destination that was set with setDestination(). The arrays of the last
+     * loadData() are released as well.
+     */
+    virtual void clearDestinations();
+
+    /**
+     * @brief Restricts loadData() to a region of interest in X and Y. The region starts at voxel
+     * (xStart, yStart) of the xFull x yFull plane that loadData() fills when no region is set, where
+     * slices smaller than the plane are centered, and it is as large as the xpoints x ypoints passed
+     * to loadData(). Only the rows and columns of each slice inside the region are read from the file.
+     * The Z range is set with SliceStart and SliceEnd.
+     * @param xFull The X dimension of the full plane
+     * @param yFull The Y dimension of the full plane
+     * @param xStart The first X voxel of the region
+     * @param yStart The first Y voxel of the region
+     */
+    void setRegionOfInterest(int64_t xFull, int64_t yFull, int64_t xStart, int64_t yStart);
+
+    /**
+     * @brief Makes loadData() read the full plane of every slice again
+     */
+    void clearRegionOfInterest();
+
   protected:
     H5EbsdVolumeReader();
 
+    /**
+     * @brief The part of a slice that is read into the volume: the block of xCount x yCount voxels that
+     * starts at (sliceX, sliceY) of the xSlice x ySlice slice lands at (volumeX, volumeY) of its z plane.
+     * The block is empty when the slice does not overlap the region of interest.
+     */
+    struct SliceWindow
+    {
+      int64_t xSlice = 0;
+      int64_t ySlice = 0;
+      int64_t sliceX = 0;
+      int64_t sliceY = 0;
+      int64_t volumeX = 0;
+      int64_t volumeY = 0;
+      int64_t xCount = 0;
+      int64_t yCount = 0;
+    };
+
+    /**
+     * @brief Works out which part of a slice lands where in a volume of xpoints x ypoints, taking the
+     * centering of smaller slices and the region of interest into account.
+     * @param xpoints The X dimension of the volume
+     * @param ypoints The Y dimension of the volume
+     * @param xSlice The X dimension of the slice
+     * @param ySlice The Y dimension of the slice
+     * @param window The part of the slice that is read (out)
+     * @return Zero on success, a negative value if the slice is larger than the full plane
+     */
+    int getSliceWindow(int64_t xpoints, int64_t ypoints, int64_t xSlice, int64_t ySlice, SliceWindow& window);
+
+    struct Destination
+    {
+      void* ptr = nullptr;
+      int numComponents = 1;
+      int componentIndex = 0;
+    };
+
+    /**
+     * @brief Returns the destination of an array, or a Destination with a nullptr if none was set
+     * @param arrayName
+     * @return
+     */
+    Destination getDestination(const QString& arrayName) const;
+
+    /**
+     * @brief Returns true if ptr is the memory of a destination, i.e. memory the reader must not free
+     * @param ptr
+     * @return
+     */
+    bool isDestinationPointer(const void* ptr) const;
+
+    /**
+     * @brief Reads the window of the one dimensional dataset of a single slice with HDF5 hyperslab
+     * selections straight into its final location in z plane zIndex of the volume. Only the rows and
+     * columns of the window are read from the file. Voxels of the plane that the window does not cover
+     * are zeroed.
+     * @param dataGid The 'Data' group of the slice
+     * @param arrayName The name of the dataset
+     * @param memType The HDF5 native type of the volume
+     * @param volume Pointer to the volume of xpoints * ypoints * zpoints tuples
+     * @param xpoints The X dimension of the volume
+     * @param ypoints The Y dimension of the volume
+     * @param zIndex The z plane of the volume that the slice is read into
+     * @param window The part of the slice to read, see getSliceWindow()
+     * @param numComponents The number of values per tuple in the volume
+     * @param componentIndex The component of each tuple that is written
+     * @return Zero on success, a negative value on error
+     */
+    int readSliceIntoVolume(hid_t dataGid, const QString& arrayName, hid_t memType, void* volume, int64_t xpoints, int64_t ypoints, int64_t zIndex, const SliceWindow& window,
+                            int numComponents = 1, int componentIndex = 0);
+
+    /**
+     * @brief Describes one array that loadSlices() reads from every slice
+     */
+    struct SliceArray
+    {
+      QString name;
+      hid_t memType = -1;
+      bool required = true; // Arrays that are not required are skipped in slices that do not have them
+      Destination destination;
+    };
+
+    /**
+     * @brief Reads every slice of the volume into the destinations of the given arrays, honoring the
+     * stacking order, the region of interest and centering slices that are smaller than the volume. Each slice is read
+     * straight into the volume.
+     * @param arrays The arrays to read
+     * @param xpoints The X dimension of the volume
+     * @param ypoints The Y dimension of the volume
+     * @param zpoints The Z dimension of the volume
+     * @param ZDir The stacking order, or UnknownRefFrameZDirection to use the one in the file
+     * @return Zero on success, a negative value on error
+     */
+    int loadSlices(const QVector<SliceArray>& arrays, int64_t xpoints, int64_t ypoints, int64_t zpoints, uint32_t ZDir);
+
+    /**
+     * @brief Reads the header of a slice and returns the dimensions of its scan. Called by loadSlices()
+     * for every slice; subclasses must implement this.
+     * @param sliceGid The group of the slice
+     * @param hdf5Path The path of the slice in the file
+     * @param xSlice The X dimension of the slice
+     * @param ySlice The Y dimension of the slice
+     * @return Zero on success, a negative value on error
+     */
+    virtual int readSliceDimensions(hid_t sliceGid, const QString& hdf5Path, int64_t& xSlice, int64_t& ySlice);
+
+    /**
+     * @brief Called by loadSlices() once every array of a slice is in the volume.
+     * @param xpoints The X dimension of the volume
+     * @param ypoints The Y dimension of the volume
+     * @param zIndex The z plane of the volume the slice was read into
+     * @param window The part of the plane that was read from the slice
+     */
+    virtual void sliceLoaded(int64_t xpoints, int64_t ypoints, int64_t zIndex, const SliceWindow& window);
+
   private:
+    /**
+     * @brief Selects the window of a slice in the dataspace of its one dimensional dataset
+     */
+    static herr_t selectSliceWindow(hid_t fileSpace, const SliceWindow& window);
+
     QSet<QString>         m_ArrayNames;
     bool                  m_ReadAllArrays;
+    QMap<QString, Destination> m_Destinations;
+    int64_t               m_RoiXFull;
+    int64_t               m_RoiYFull;
+    int64_t               m_RoiXStart;
+    int64_t               m_RoiYStart;
 
   public:
     H5EbsdVolumeReader(const H5EbsdVolumeReader&) = delete; // Copy Constructor Not Implemented
@@ -47,6 +47,7 @@
 #include "CtfPhase.h"
 #include "EbsdLib/EbsdMacros.h"
 #include "EbsdLib/EbsdMath.h"
+#include "EbsdLib/EbsdTextParser.h"
 
 
 
@@ -279,7 +280,7 @@ int CtfReader::readFile()
     return -103;
   }
 
-  err = readData(in);
+  err = readData(in, headerLines.size());
 
   return err;
 }
@@ -295,7 +296,7 @@ void CtfReader::readOnlySliceIndex(int slice)
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-int CtfReader::readData(QFile& in)
+int CtfReader::readData(QFile& in, int numHeaderLines)
 {
   QString sBuf;
   QTextStream ss(&sBuf);
@@ -303,9 +304,7 @@ int CtfReader::readData(QFile& in)
   size_t yCells = getYCells();
   size_t xCells = getXCells();
   int zCells = getZCells();
-  int zStart = 0;
-  int zEnd = zCells;
-  if(zCells < 0 || m_SingleSliceRead >= 0)
+  if(zCells < 1 || m_SingleSliceRead >= 0)
   {
     zCells = 1;
   }
@@ -327,6 +326,7 @@ int CtfReader::readData(QFile& in)
   Ebsd::NumType pType = Ebsd::UnknownNumType;
   qint32 size = tokens.size();
   bool didAllocate = false;
+  std::vector<EbsdTextParser::Column> columns(size);
   for (qint32 i = 0; i < size; ++i)
   {
     QString name = QString::fromLatin1(tokens[i]);
@@ -340,6 +340,7 @@ int CtfReader::readData(QFile& in)
       {
         ::memset(dparser->getVoidPointer(), 0xAB, sizeof(int32_t) * totalScanPoints);
         m_NamePointerMap.insert(name, dparser);
+        columns[i] = {EbsdTextParser::ColumnType::Int32, dparser->getVoidPointer(), true};
       }
     }
     else if(Ebsd::Float == pType)
@@ -351,6 +352,7 @@ int CtfReader::readData(QFile& in)
       {
         ::memset(dparser->getVoidPointer(), 0xAB, sizeof(float) * totalScanPoints);
         m_NamePointerMap.insert(name, dparser);
+        columns[i] = {EbsdTextParser::ColumnType::Float, dparser->getVoidPointer(), true};
       }
     }
     else
@@ -377,46 +379,49 @@ int CtfReader::readData(QFile& in)
 
   }
 
-  // Now start reading the data line by line
-  int err = 0;
-  size_t counter = 0;
-  for (int slice = zStart; slice < zEnd; ++slice)
+  EbsdTextParser parser;
+  parser.setNumberOfThreads(getNumberOfParserThreads());
+  if(getParserMinimumChunkSize() > 0)
   {
-    for (size_t row = 0; row < yCells; ++row)
-    {
-      for (size_t col = 0; col < xCells; ++col)
-      {
-        buf = in.readLine(); // Read the line into a QByteArray including the newline
-        buf = buf.trimmed(); // Remove leading and trailing whitespace
-
-        if ( (m_SingleSliceRead < 0) || (m_SingleSliceRead >= 0 && slice == m_SingleSliceRead) )
-        {
+    parser.setMinimumChunkSize(getParserMinimumChunkSize());
+  }
+  if(parser.open(getFileName()) < 0)
+  {
+    setErrorMessage(QString("Ctf file could not be opened: ") + getFileName());
+    setErrorCode(-100);
+    return -100;
+  }
+  // Values that do not convert, including empty fields between two tabs, are stored as 0
+  parser.setDelimiter('\t');
+  parser.setDecimalComma(true);
+  parser.setRequireAllColumns(true);
+
+  // The data starts after the header lines and the line of column names
+  const char* dataBegin = parser.begin();
+  for(int i = 0; i <= numHeaderLines; i++)
+  {
+    dataBegin = EbsdTextParser::nextLine(dataBegin, parser.end());
+  }
 
-          if(in.atEnd() && buf.isEmpty()) // We have to have read to the end of the file AND the buffer is empty
-                                          // otherwise we read EXACTLY the last line and we still need to parse the line.
-          {
-            //  ++counter; // We need to make sure this gets incremented before leaving
-            break;
-          }
-          err = parseDataLine(buf, row, col, counter, xCells, yCells);
-          if (err < 0) { return err; }
-          ++counter;
-        }
+  // A 3D file holds zCells slices of xCells * yCells points one after the other
+  size_t firstRow = (m_SingleSliceRead >= 0) ? static_cast<size_t>(m_SingleSliceRead) * xCells * yCells : 0;
+  int64_t counter = parser.parse(dataBegin, parser.end(), columns, totalScanPoints, firstRow);
+  if(counter < 0)
+  {
+    setErrorCode(-107);
+    QString msg;
+    QTextStream ss(&msg);
+    ss << "The number of tab delimited data columns (" << parser.getErrorTokenCount() << ") does not match the number of tab delimited header columns (";
+    ss << m_NamePointerMap.size() << "). Please check the CTF file for mistakes.";
+    ss << "The error occurred at data row " << parser.getErrorRow() << " which is " << parser.getErrorRow() << " past ";
+    ss << "the column header row.";
+    ss << "\nThe CTF Reader will now abort reading any further in the file.";
 
-      }
-      if(in.atEnd())
-      {
-        break;
-      }
-    }
-    //   std::cout << ".ctf Z Slice " << slice << " Reading complete." << std::endl;
-    if(m_SingleSliceRead >= 0 && slice == m_SingleSliceRead)
-    {
-      break;
-    }
+    setErrorMessage(msg);
+    return -106;
   }
 
-  if(counter != getNumberOfElements() && in.atEnd())
+  if(static_cast<size_t>(counter) != getNumberOfElements())
   {
     ss.string()->clear();
     ss << "Premature End Of File reached.\n" << getFileName() << "\nNumRows=" << getNumberOfElements() << "\ncounter=" << counter
@@ -549,54 +554,6 @@ int CtfReader::parseHeaderLines(QList<QByteArray>& headerLines)
 
 
 
-// -----------------------------------------------------------------------------
-//  Read the data part of the .ctf file
-// -----------------------------------------------------------------------------
-int CtfReader::parseDataLine(QByteArray& line, size_t row, size_t col, size_t offset, size_t xCells, size_t yCells )
-{
-  /* When reading the data there should be at least 11 cols of data.
-   */
-  //  float x, y,  p1, p, p2, mad;
-  //  int phase, bCount, error, bc, bs;
-  //  size_t offset = i;
-
-  // Filter the line to convert European command style decimals to US/UK style points
-  //  QVector<char> cLine(line.size()+1);
-  //  ::memcpy( &(cLine.front()), line.c_str(), line.size() + 1);
-  for (int c = 0; c < line.size(); ++c)
-  {
-    if(line.at(c) == ',')
-    {
-      line[c] = '.';
-    }
-  }
-
-  QList<QByteArray> tokens = line.split('\t');
-  if(tokens.size() != m_NamePointerMap.size())
-  {
-    setErrorCode(-107);
-    QString msg;
-    QTextStream ss(&msg);
-    ss << "The number of tab delimited data columns (" << tokens.size() << ") does not match the number of tab delimited header columns (";
-    ss << m_NamePointerMap.size() << "). Please check the CTF file for mistakes.";
-    ss << "The error occurred at data row " << row << " which is " << row << " past ";
-    ss << "the column header row.";
-    ss << "\nThe CTF Reader will now abort reading any further in the file.";
-
-    setErrorMessage(msg);
-    return -106; // Could not allocate the memory
-  }
-  QMapIterator<QString, DataParser::Pointer> iter(m_NamePointerMap);
-  while (iter.hasNext())
-  {
-    iter.next();
-
-    DataParser::Pointer dparser = iter.value();
-    dparser->parse(tokens[dparser->getColumnIndex()], offset);
-  }
-  return 0;
-}
-
 #if 0
 // -----------------------------------------------------------------------------
 //
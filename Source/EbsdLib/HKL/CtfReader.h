@@ -188,21 +188,12 @@ private:
   int parseHeaderLines(QList<QByteArray>& headerLines);
 
   /**
-   * @brief
+   * @brief Reads the line of column names from in and then parses the data section of the
+   * file on several threads. 2D files and the multi slice 3D variant are both handled.
    * @param in The input file stream to read from
+   * @param numHeaderLines The number of lines before the line of column names
    */
-  int readData(QFile& in);
-
-  /**
-   * @brief Reads a line of Data from the ASCII based file
-   * @param line The current line of data
-   * @param row Current Row of Data
-   * @param i The current index into a flat array
-   * @param xCells Number of X Data Points
-   * @param yCells Number of Y Data Points
-   * @param col The current Column of Data
-   */
-  int parseDataLine(QByteArray& line, size_t row, size_t col, size_t i, size_t xCells, size_t yCells);
+  int readData(QFile& in, int numHeaderLines);
 
 public:
   CtfReader(const CtfReader&) = delete;            // Copy Constructor Not Implemented
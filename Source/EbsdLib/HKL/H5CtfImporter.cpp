@@ -85,7 +85,7 @@ using namespace H5Support_NAMESPACE;
   {                                                                                                                                                                                                    \
     if(nullptr != dataPtr)                                                                                                                                                                             \
     {                                                                                                                                                                                                  \
-      err = QH5Lite::writePointerDataset(gid, key, rank, dims, dataPtr);                                                                                                                               \
+      err = writeDataArray(gid, key, H5Lite::HDFTypeForPrimitive(m_msgType(0)), rank, dims, dataPtr);                                                                                                  \
       if(err < 0)                                                                                                                                                                                      \
       {                                                                                                                                                                                                \
         QString ss = QObject::tr("H5CtfImporter Error: Could not write Ctf Data array for '%1' to the HDF5 file with data set name '%2'\n").arg(key, key);                                             \
@@ -138,50 +138,81 @@ int H5CtfImporter::numberOfSlicesImported()
 // -----------------------------------------------------------------------------
 int H5CtfImporter::importFile(hid_t fileId, int64_t z, const QString& ctfFile)
 {
-  herr_t err = -1;
   setCancel(false);
   setErrorCode(0);
   setPipelineMessage("");
 
+  int err = 0;
+  QString message;
+  EbsdReader::Pointer reader = readEbsdFile(ctfFile, err, message);
+  if(nullptr == reader)
+  {
+    setPipelineMessage(message);
+    setErrorCode(err);
+    progressMessage(message, 100);
+    return -1;
+  }
+  return writeEbsdData(fileId, z, reader);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+EbsdReader::Pointer H5CtfImporter::readEbsdFile(const QString& ctfFile, int& err, QString& message) const
+{
   //  std::cout << "H5CtfImporter: Importing " << ctfFile << std::endl;
-  CtfReader reader;
-  reader.setFileName(ctfFile);
+  std::shared_ptr<CtfReader> reader(new CtfReader);
+  reader->setFileName(ctfFile);
+  reader->setNumberOfParserThreads(getNumberOfParserThreads());
 
   // Now actually read the file
-  err = reader.readFile();
+  err = reader->readFile();
 
   // Check for errors
   if (err < 0)
   {
-
-    QString ss;
     if (err == -200)
     {
-      ss = "H5CtfImporter Error: There was no data in the file.";
+      message = "H5CtfImporter Error: There was no data in the file.";
     }
     else if (err == -100)
     {
-      ss = "H5CtfImporter Error: The Ctf file could not be opened.";
+      message = "H5CtfImporter Error: The Ctf file could not be opened.";
     }
-    else if (reader.getXStep() == 0.0f)
+    else if (reader->getXStep() == 0.0f)
     {
-      ss = "H5CtfImporter Error: X Step value equals 0.0. This is bad. Please check the validity of the CTF file.";
+      message = "H5CtfImporter Error: X Step value equals 0.0. This is bad. Please check the validity of the CTF file.";
     }
-    else if(reader.getYStep() == 0.0f)
+    else if(reader->getYStep() == 0.0f)
     {
-      ss = "H5CtfImporter Error: Y Step value equals 0.0. This is bad. Please check the validity of the CTF file.";
+      message = "H5CtfImporter Error: Y Step value equals 0.0. This is bad. Please check the validity of the CTF file.";
     }
     else
     {
-      ss = reader.getErrorMessage();
+      message = reader->getErrorMessage();
     }
-    setPipelineMessage(ss);
-    setErrorCode(err);
-    progressMessage(ss, 100);
+    return EbsdReader::NullPointer();
+  }
+  return reader;
+}
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int H5CtfImporter::writeEbsdData(hid_t fileId, int64_t z, const EbsdReader::Pointer& ebsdReader)
+{
+  herr_t err = -1;
+  setErrorCode(0);
+  setPipelineMessage("");
 
+  CtfReader* ctfReader = dynamic_cast<CtfReader*>(ebsdReader.get());
+  if(nullptr == ctfReader)
+  {
+    setPipelineMessage(QObject::tr("H5CtfImporter Error: The data for Z index %1 was not read from a .ctf file.").arg(z));
+    setErrorCode(-1);
     return -1;
   }
+  CtfReader& reader = *ctfReader;
 
   // Write the fileversion attribute if it does not exist
   {
@@ -73,6 +73,23 @@ class EbsdLib_EXPORT H5CtfImporter : public EbsdImporter
      */
     int importFile(hid_t fileId, int64_t index, const QString& angFile) override;
 
+    /**
+     * @brief Reads the .ctf file into a CtfReader. Safe to call from several threads at once.
+     * @param ebsdFile The absolute path to the input .ctf file
+     * @param err The error code (out)
+     * @param message The error message (out)
+     * @return The CtfReader, or a null pointer on error
+     */
+    EbsdReader::Pointer readEbsdFile(const QString& ebsdFile, int& err, QString& message) const override;
+
+    /**
+     * @brief Writes the data of a CtfReader into the HDF5 file
+     * @param fileId The valid HDF5 file Id for an already open HDF5 file
+     * @param index The slice index for the file
+     * @param reader The reader returned by readEbsdFile()
+     */
+    int writeEbsdData(hid_t fileId, int64_t index, const EbsdReader::Pointer& reader) override;
+
     /**
      * @brief Writes the phase data into the HDF5 file
      * @param reader Valid AngReader instance
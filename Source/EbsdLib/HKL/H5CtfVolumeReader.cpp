@@ -63,12 +63,31 @@ H5CtfVolumeReader::~H5CtfVolumeReader()
 #define H5CTFREADER_ALLOCATE_ARRAY(name, type)                                                                                                                                                         \
   if(readAllArrays == true || arrayNames.find(Ebsd::Ctf::name) != arrayNames.end())                                                                                                                    \
   {                                                                                                                                                                                                    \
-    auto _##name = allocateArray<type>(numElements);                                                                                                                                                   \
-    if(nullptr != _##name)                                                                                                                                                                             \
+    Destination destination = getDestination(Ebsd::Ctf::name);                                                                                                                                         \
+    if(nullptr != destination.ptr)                                                                                                                                                                     \
     {                                                                                                                                                                                                  \
-      ::memset(_##name, 0, numBytes);                                                                                                                                                                  \
+      /* Caller owned memory; interleaved destinations are only ever written through readSliceIntoVolume() */                                                                                         \
+      set##name##Pointer(destination.numComponents == 1 ? static_cast<type*>(destination.ptr) : nullptr);                                                                                              \
     }                                                                                                                                                                                                  \
-    set##name##Pointer(_##name);                                                                                                                                                                       \
+    else                                                                                                                                                                                               \
+    {                                                                                                                                                                                                  \
+      auto _##name = allocateArray<type>(numElements);                                                                                                                                                 \
+      if(nullptr != _##name)                                                                                                                                                                           \
+      {                                                                                                                                                                                                \
+        ::memset(_##name, 0, numBytes);                                                                                                                                                                \
+      }                                                                                                                                                                                                \
+      set##name##Pointer(_##name);                                                                                                                                                                     \
+    }                                                                                                                                                                                                  \
+  }
+
+#define H5CTFREADER_DELETE_ARRAY(var, type)                                                                                                                                                            \
+  if(isDestinationPointer(var))                                                                                                                                                                        \
+  {                                                                                                                                                                                                    \
+    var = nullptr;                                                                                                                                                                                     \
+  }                                                                                                                                                                                                    \
+  else                                                                                                                                                                                                 \
+  {                                                                                                                                                                                                    \
+    this->deallocateArrayData<type>(var);                                                                                                                                                              \
   }
 
 // -----------------------------------------------------------------------------
@@ -76,6 +95,8 @@ H5CtfVolumeReader::~H5CtfVolumeReader()
 // -----------------------------------------------------------------------------
 void H5CtfVolumeReader::initPointers(size_t numElements)
 {
+  // Release the arrays of a previous load; destination memory is only let go of, never freed
+  deletePointers();
   setNumberOfElements(numElements);
   size_t numBytes = numElements * sizeof(float);
   bool readAllArrays = getReadAllArrays();
@@ -100,17 +121,18 @@ void H5CtfVolumeReader::initPointers(size_t numElements)
 // -----------------------------------------------------------------------------
 void H5CtfVolumeReader::deletePointers()
 {
-  this->deallocateArrayData<int > (m_Phase);
-  this->deallocateArrayData<float > (m_X);
-  this->deallocateArrayData<float > (m_Y);
-  this->deallocateArrayData<int > (m_Bands);
-  this->deallocateArrayData<int > (m_Error);
-  this->deallocateArrayData<float > (m_Euler1);
-  this->deallocateArrayData<float > (m_Euler2);
-  this->deallocateArrayData<float > (m_Euler3);
-  this->deallocateArrayData<float > (m_MAD);
-  this->deallocateArrayData<int > (m_BC);
-  this->deallocateArrayData<int > (m_BS);
+  H5CTFREADER_DELETE_ARRAY(m_Phase, int)
+  H5CTFREADER_DELETE_ARRAY(m_X, float)
+  H5CTFREADER_DELETE_ARRAY(m_Y, float)
+  H5CTFREADER_DELETE_ARRAY(m_Z, float)
+  H5CTFREADER_DELETE_ARRAY(m_Bands, int)
+  H5CTFREADER_DELETE_ARRAY(m_Error, int)
+  H5CTFREADER_DELETE_ARRAY(m_Euler1, float)
+  H5CTFREADER_DELETE_ARRAY(m_Euler2, float)
+  H5CTFREADER_DELETE_ARRAY(m_Euler3, float)
+  H5CTFREADER_DELETE_ARRAY(m_MAD, float)
+  H5CTFREADER_DELETE_ARRAY(m_BC, int)
+  H5CTFREADER_DELETE_ARRAY(m_BS, int)
 }
 
 // -----------------------------------------------------------------------------
@@ -187,6 +209,23 @@ QVector<CtfPhase::Pointer> H5CtfVolumeReader::getPhases()
   return m_Phases;
 }
 
+/* The X, Y and Z columns are not required to be in the file; when they are missing the
+ * volume keeps its zeros, as it always did */
+#define H5CTFREADER_ADD_SLICE_ARRAY(column, var, type, isRequired)                                                                                                                                     \
+  if(readAllArrays == true || arrayNames.find(Ebsd::Ctf::column) != arrayNames.end())                                                                                                                  \
+  {                                                                                                                                                                                                    \
+    SliceArray array;                                                                                                                                                                                  \
+    array.name = Ebsd::Ctf::column;                                                                                                                                                                    \
+    array.memType = type;                                                                                                                                                                              \
+    array.required = isRequired;                                                                                                                                                                       \
+    array.destination = getDestination(Ebsd::Ctf::column);                                                                                                                                             \
+    if(nullptr == array.destination.ptr)                                                                                                                                                               \
+    {                                                                                                                                                                                                  \
+      array.destination.ptr = var;                                                                                                                                                                     \
+    }                                                                                                                                                                                                  \
+    arrays.push_back(array);                                                                                                                                                                           \
+  }
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -195,108 +234,52 @@ int H5CtfVolumeReader::loadData(int64_t xpoints,
                                 int64_t zpoints,
                                 uint32_t ZDir)
 {
-  int index = 0;
   int err = -1;
-// Initialize all the pointers
+  // Initialize all the pointers. Arrays with a destination are read straight into it.
   initPointers(xpoints * ypoints * zpoints);
 
-  int readerIndex = 0;
-  int64_t xpointsslice = 0;
-  int64_t ypointsslice = 0;
-  int64_t xpointstemp = 0;
-  int64_t ypointstemp = 0;
-  int zval = 0;
-
-
-  int xstartspot = 0;
-  int ystartspot = 0;
-
+  bool readAllArrays = getReadAllArrays();
+  QSet<QString> arrayNames = getArraysToRead();
   err = readVolumeInfo();
 
-  for (int slice = 0; slice < zpoints; ++slice)
-  {
-    H5CtfReader::Pointer reader = H5CtfReader::New();
-    reader->setFileName(getFileName());
-    reader->setHDF5Path(QString::number(slice + getSliceStart()));
-    reader->setUserZDir(getStackingOrder());
-    reader->setSampleTransformationAngle(getSampleTransformationAngle());
-    reader->setSampleTransformationAxis(getSampleTransformationAxis());
-    reader->setEulerTransformationAngle(getEulerTransformationAngle());
-    reader->setEulerTransformationAxis(getEulerTransformationAxis());
-    reader->readAllArrays(getReadAllArrays());
-    reader->setArraysToRead(getArraysToRead());
-
-    err = reader->readFile();
-    if (err < 0)
-    {
-      std::cout << "H5CtfVolumeReader Error: There was an issue loading the data from the hdf5 file." << std::endl;
-      return -77000;
-    }
-    readerIndex = 0;
-    xpointsslice = reader->getXCells();
-    ypointsslice = reader->getYCells();
-    int* phasePtr = reader->getPhasePointer();
-    float* xPtr = reader->getXPointer();
-    float* yPtr = reader->getYPointer();
-    int* bandPtr = reader->getBandCountPointer();
-    int* errorPtr = reader->getErrorPointer();
-    float* euler1Ptr = reader->getEuler1Pointer();
-    float* euler2Ptr = reader->getEuler2Pointer();
-    float* euler3Ptr = reader->getEuler3Pointer();
-    float* madPtr = reader->getMeanAngularDeviationPointer();
-    int* bcPtr = reader->getBandContrastPointer();
-    int* bsPtr = reader->getBandSlopePointer();
-
-    xpointstemp = xpoints;
-    ypointstemp = ypoints;
-    xstartspot = static_cast<int>( (xpointstemp - xpointsslice) / 2 );
-    ystartspot = static_cast<int>( (ypointstemp - ypointsslice) / 2 );
+  /* For HKL OIM Files if there is a single phase then the value of the phase
+   * data is one (1). If there are 2 or more phases then the lowest value
+   * of phase is also one (1). However, if there are "zero solutions" in the data
+   * then those points are assigned a phase of zero. Those points are identified
+   * by other methods, so the phase values are kept as they are in the file.
+   */
+  QVector<SliceArray> arrays;
+  H5CTFREADER_ADD_SLICE_ARRAY(Phase, m_Phase, H5T_NATIVE_INT32, true)
+  H5CTFREADER_ADD_SLICE_ARRAY(X, m_X, H5T_NATIVE_FLOAT, false)
+  H5CTFREADER_ADD_SLICE_ARRAY(Y, m_Y, H5T_NATIVE_FLOAT, false)
+  H5CTFREADER_ADD_SLICE_ARRAY(Z, m_Z, H5T_NATIVE_FLOAT, false)
+  H5CTFREADER_ADD_SLICE_ARRAY(Bands, m_Bands, H5T_NATIVE_INT32, true)
+  H5CTFREADER_ADD_SLICE_ARRAY(Error, m_Error, H5T_NATIVE_INT32, true)
+  H5CTFREADER_ADD_SLICE_ARRAY(Euler1, m_Euler1, H5T_NATIVE_FLOAT, true)
+  H5CTFREADER_ADD_SLICE_ARRAY(Euler2, m_Euler2, H5T_NATIVE_FLOAT, true)
+  H5CTFREADER_ADD_SLICE_ARRAY(Euler3, m_Euler3, H5T_NATIVE_FLOAT, true)
+  H5CTFREADER_ADD_SLICE_ARRAY(MAD, m_MAD, H5T_NATIVE_FLOAT, true)
+  H5CTFREADER_ADD_SLICE_ARRAY(BC, m_BC, H5T_NATIVE_INT32, true)
+  H5CTFREADER_ADD_SLICE_ARRAY(BS, m_BS, H5T_NATIVE_INT32, true)
 
-    // If no stacking order preference was passed, read it from the file and use that value
-    if(ZDir == SIMPL::RefFrameZDir::UnknownRefFrameZDirection)
-    {
-      ZDir = getStackingOrder();
-    }
-    if (ZDir == 0) { zval = slice; }
-    if (ZDir == 1) { zval = static_cast<int>( (zpoints - 1) - slice ); }
-
-    // Copy the data from the current storage into the Storage Location
-    for (int j = 0; j < ypointsslice; j++)
-    {
-      for (int i = 0; i < xpointsslice; i++)
-      {
-        index = static_cast<int>( (zval * xpointstemp * ypointstemp) + ((j + ystartspot) * xpointstemp) + (i + xstartspot) );
-        if (nullptr != phasePtr) {m_Phase[index] = phasePtr[readerIndex];}
-        if (nullptr != xPtr) {m_X[index] = xPtr[readerIndex];}
-        if (nullptr != yPtr) {m_Y[index] = yPtr[readerIndex];}
-        if (nullptr != bandPtr) {m_Bands[index] = bandPtr[readerIndex];}
-        if (nullptr != errorPtr) {m_Error[index] = errorPtr[readerIndex];}
-        if (nullptr != euler1Ptr) {m_Euler1[index] = euler1Ptr[readerIndex];}
-        if (nullptr != euler2Ptr) {m_Euler2[index] = euler2Ptr[readerIndex];}
-        if (nullptr != euler3Ptr) {m_Euler3[index] = euler3Ptr[readerIndex];}
-        if (nullptr != madPtr) {m_MAD[index] = madPtr[readerIndex];}
-        if (nullptr != bcPtr) {m_BC[index] = bcPtr[readerIndex];}
-        if (nullptr != bsPtr) {m_BS[index] = bsPtr[readerIndex];}
-
-        /* For HKL OIM Files if there is a single phase then the value of the phase
-         * data is one (1). If there are 2 or more phases then the lowest value
-         * of phase is also one (1). However, if there are "zero solutions" in the data
-         * then those points are assigned a phase of zero.  Since those points can be identified
-         * by other methods, the phase of these points should be changed to one since in the rest
-         * of the reconstruction code we follow the convention that the lowest value is One (1)
-         * even if there is only a single phase. The next if statement converts all zeros to ones
-         * if there is a single phase in the OIM data.
-         */
-//        if(nullptr != phasePtr && m_Phase[index] < 1)
-//        {
-//          m_Phase[index] = 1;
-//        }
+  return loadSlices(arrays, xpoints, ypoints, zpoints, ZDir);
+}
 
-        ++readerIndex;
-      }
-    }
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int H5CtfVolumeReader::readSliceDimensions(hid_t sliceGid, const QString& hdf5Path, int64_t& xSlice, int64_t& ySlice)
+{
+  H5CtfReader::Pointer reader = H5CtfReader::New();
+  reader->setHDF5Path(hdf5Path);
+  int err = reader->readHeader(sliceGid);
+  if(err < 0)
+  {
+    setErrorCode(-77000);
+    setErrorMessage("H5CtfVolumeReader Error: There was an issue loading the data from the hdf5 file.");
+    return getErrorCode();
   }
-  return err;
-
+  xSlice = reader->getXCells();
+  ySlice = reader->getYCells();
+  return 0;
 }
-
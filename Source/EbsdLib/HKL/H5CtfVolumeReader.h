@@ -123,6 +123,8 @@ class EbsdLib_EXPORT H5CtfVolumeReader : public H5EbsdVolumeReader
   protected:
     H5CtfVolumeReader();
 
+    int readSliceDimensions(hid_t sliceGid, const QString& hdf5Path, int64_t& xSlice, int64_t& ySlice) override;
+
   private:
     QVector<CtfPhase::Pointer> m_Phases;
 
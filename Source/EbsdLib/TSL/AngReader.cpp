@@ -44,6 +44,7 @@
 #include "AngConstants.h"
 #include "EbsdLib/EbsdMacros.h"
 #include "EbsdLib/EbsdMath.h"
+#include "EbsdLib/EbsdTextParser.h"
 
 // -----------------------------------------------------------------------------
 //
@@ -337,8 +338,8 @@ int AngReader::readFile()
     setErrorMessage("No phase was parsed in the header portion of the file. This possibly means that part of the header is missing.");
     return -150;
   }
-  // We need to pass in the buffer because it has the first line of data
-  readData(in, buf);
+  in.close();
+  readData();
   if(getErrorCode() < 0)
   {
     return getErrorCode();
@@ -350,7 +351,7 @@ int AngReader::readFile()
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void AngReader::readData(QFile& in, QByteArray& buf)
+void AngReader::readData()
 {
   QString streamBuf;
   QTextStream ss(&streamBuf);
@@ -449,68 +450,36 @@ void AngReader::readData(QFile& in, QByteArray& buf)
     return;
   }
 
-  size_t counter = 1; // Because we are on the first line now.
-
-  bool onEvenRow = false;
-  int col = 0;
-
-  int yChange = 0;
-  float oldY = m_Y[0];
-  int nxOdd = 0;
-  int nxEven = 0;
-  // int nRows = 0;
-
-  for(size_t i = 0; i < totalDataPoints; ++i)
+  EbsdTextParser parser;
+  parser.setNumberOfThreads(getNumberOfParserThreads());
+  if(getParserMinimumChunkSize() > 0)
   {
-    if(i > 0)
-    {
-      //  ::memset(buf, 0, bufSize); // Clear the buffer
-      buf = in.readLine();
-      ++counter;
-    }
-    parseDataLine(buf, i);
-    if(getErrorCode() < 0)
-    {
-      ss.string()->clear();
-
-      ss << "Error parsing the data line (Numeric conversion). Error code is " << getErrorCode() << " and occurred at data column " << m_ErrorColumn << " (Zero Based)\n"
-         << buf << "\n*** Header information ***\nRows=" << numRows << " EvenCols=" << nEvenCols << " OddCols=" << nOddCols << "  Calculated Data Points: " << totalDataPoints
-         << "\n***Parsing Position ***\nCurrent Row: " << yChange << "  Current Column Index: " << col << "  Current Data Point Count: " << counter << "\n";
-      setErrorMessage(*(ss.string()));
-      break;
-    }
-
-    if(fabs(m_Y[i] - oldY) > 1e-6)
-    {
-      ++yChange;
-      oldY = m_Y[i];
-      onEvenRow = !onEvenRow;
-      col = 0;
-    }
-    else
-    {
-      col++;
-    }
-    if(yChange == 0)
-    {
-      ++nxOdd;
-    }
-    if(yChange == 1)
-    {
-      ++nxEven;
-    }
-    if(in.atEnd())
-    {
-      break;
-    }
+    parser.setMinimumChunkSize(getParserMinimumChunkSize());
+  }
+  if(parser.open(getFileName()) < 0)
+  {
+    setErrorCode(-100);
+    setErrorMessage(QObject::tr("Ang file could not be opened: %1").arg(getFileName()));
+    return;
   }
 
-#if 0
-  nRows = yChange + 1;
-
-  std::cout << "Header: nRows: " << numRows << " Odd Cols: " << nOddCols << "  Even Cols: " << nEvenCols << std::endl;
-  std::cout << "File:   nRows: " << nRows << " Odd Cols: " << nxOdd << "  Even Cols: " << nxEven << std::endl;
-#endif
+  // The column order of the data section: phi1, phi, phi2, x, y, IQ, CI, phase, SEM Signal, Fit.
+  // Some TSL ang files do NOT have the last 2 columns. Some write the phase as a float.
+  using ColumnType = EbsdTextParser::ColumnType;
+  std::vector<EbsdTextParser::Column> columns = {
+      {ColumnType::Float, m_Phi1},
+      {ColumnType::Float, m_Phi},
+      {ColumnType::Float, m_Phi2},
+      {ColumnType::Float, m_X},
+      {ColumnType::Float, m_Y},
+      {ColumnType::Float, m_Iq},
+      {ColumnType::Float, m_Ci},
+      {ColumnType::Int32OrFloat, m_PhaseData},
+      {ColumnType::Float, m_SEMSignal},
+      {ColumnType::Float, m_Fit}};
+
+  const char* dataBegin = EbsdTextParser::skipLinesStartingWith(parser.begin(), parser.end(), '#');
+  int64_t rowsRead = parser.parse(dataBegin, parser.end(), columns, totalDataPoints);
 
   if(getNumFeatures() < 10)
   {
@@ -520,18 +489,23 @@ void AngReader::readData(QFile& in, QByteArray& buf)
   {
     deallocateArrayData<float>(m_SEMSignal);
   }
-  if(getErrorCode() < 0)
+
+  if(rowsRead < 0)
   {
+    m_ErrorColumn = parser.getErrorColumn();
+    setErrorCode(m_ErrorColumn == 7 ? -2588 : -2501 - m_ErrorColumn);
+    ss << "Error parsing the data line (Numeric conversion). Error code is " << getErrorCode() << " and occurred at data column " << m_ErrorColumn << " (Zero Based)\n"
+       << parser.getErrorLine() << "\n*** Header information ***\nRows=" << numRows << " EvenCols=" << nEvenCols << " OddCols=" << nOddCols << "  Calculated Data Points: " << totalDataPoints
+       << "\n***Parsing Position ***\nCurrent Data Point Count: " << parser.getErrorRow() + 1 << "\n";
+    setErrorMessage(*(ss.string()));
     return;
   }
 
-  if(counter != totalDataPoints && in.atEnd())
+  if(static_cast<size_t>(rowsRead) != totalDataPoints)
   {
-    ss.string()->clear();
-
     ss << "End of ANG file reached before all data was parsed.\n"
        << getFileName() << "\n*** Header information ***\nRows=" << numRows << " EvenCols=" << nEvenCols << " OddCols=" << nOddCols << "  Calculated Data Points: " << totalDataPoints
-       << "\n***Parsing Position ***\nCurrent Row: " << yChange << "  Current Column Index: " << col << "  Current Data Point Count: " << counter << "\n";
+       << "\n***Parsing Position ***\nCurrent Data Point Count: " << rowsRead << "\n";
     setErrorMessage(*(ss.string()));
     setErrorCode(-600);
   }
@@ -664,149 +638,6 @@ std::cout << "m_HeaderMap[Ebsd::Ang::" << word << "] = AngHeaderEntry<float>::Ne
   }
 }
 
-// -----------------------------------------------------------------------------
-//  Read the data part of the ANG file
-// -----------------------------------------------------------------------------
-void AngReader::parseDataLine(QByteArray& line, size_t i)
-{
-  /* When reading the data there should be at least 8 cols of data. There may even
-   * be 10 columns of data. The column names should be the following:
-   * phi1
-   * phi
-   * phi2
-   * x pos
-   * y pos
-   * image quality
-   * confidence index
-   * phase
-   * SEM Signal
-   * Fit of Solution
-   *
-   * Some TSL ang files do NOT have all 10 columns. Assume these are lacking the last
-   * 2 columns and all the other columns are the same as above.
-   */
-  m_ErrorColumn = 0;
-  float p1 = 0.0f, p = 0.0f, p2 = 0.0f, x = -1.0f, y = -1.0f, iqual = -1.0f, conf = -1.0f, semSignal = -1.0f, fit = -1.0f;
-  int ph = 0;
-  size_t offset = 0;
-  QList<QByteArray> tokens = line.trimmed().simplified().split(' ');
-  bool ok = true;
-  offset = i;
-  if(!tokens.empty())
-  {
-    p1 = tokens[0].toFloat(&ok);
-    if(!ok)
-    {
-      setErrorCode(-2501);
-      m_ErrorColumn = 0;
-    }
-    m_Phi1[offset] = p1;
-  }
-  if(tokens.size() >= 2)
-  {
-    p = tokens[1].toFloat(&ok);
-    if(!ok)
-    {
-      setErrorCode(-2502);
-      m_ErrorColumn = 1;
-    }
-    m_Phi[offset] = p;
-  }
-  if(tokens.size() >= 3)
-  {
-    p2 = tokens[2].toFloat(&ok);
-    if(!ok)
-    {
-      setErrorCode(-2503);
-      m_ErrorColumn = 2;
-    }
-    m_Phi2[offset] = p2;
-  }
-  if(tokens.size() >= 4)
-  {
-    x = tokens[3].toFloat(&ok);
-    if(!ok)
-    {
-      setErrorCode(-2504);
-      m_ErrorColumn = 3;
-    }
-    m_X[offset] = x;
-  }
-  if(tokens.size() >= 5)
-  {
-    y = tokens[4].toFloat(&ok);
-    if(!ok)
-    {
-      setErrorCode(-2505);
-      m_ErrorColumn = 4;
-    }
-    m_Y[offset] = y;
-  }
-  if(tokens.size() >= 6)
-  {
-    iqual = tokens[5].toFloat(&ok);
-    if(!ok)
-    {
-      setErrorCode(-2506);
-      m_ErrorColumn = 5;
-    }
-    m_Iq[offset] = iqual;
-  }
-  if(tokens.size() >= 7)
-  {
-    conf = tokens[6].toFloat(&ok);
-    if(!ok)
-    {
-      setErrorCode(-2507);
-      m_ErrorColumn = 6;
-    }
-    m_Ci[offset] = conf;
-  }
-  if(tokens.size() >= 8)
-  {
-    ph = tokens[7].toInt(&ok);
-    if(!ok)
-    { 
-      setErrorCode(-2508);
-      m_ErrorColumn = 7;
-      // Some have floats instead of integers so lets try that.
-      float f = tokens[7].toFloat(&ok);
-      if(!ok)
-      {
-        setErrorCode(-2588);
-        m_ErrorColumn = 7;
-      }
-      else
-      {
-        setErrorCode(0);
-        ph = static_cast<int32_t>(f);
-      }
-    }
-    m_PhaseData[offset] = ph;
-  }
-
-  if(tokens.size() >= 9)
-  {
-    semSignal = tokens[8].toFloat(&ok);
-    if(!ok)
-    {
-      setErrorCode(-2509);
-      m_ErrorColumn = 8;
-    }
-    m_SEMSignal[offset] = semSignal;
-  }
-  if(tokens.size() >= 10)
-  {
-    fit = tokens[9].toFloat(&ok);
-    if(!ok)
-    {
-      setErrorCode(-2510);
-      m_ErrorColumn = 9;
-    }
-    m_Fit[offset] = fit;
-  }
-}
-
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -165,18 +165,13 @@ private:
   AngPhase::Pointer m_CurrentPhase;
   int m_ErrorColumn = 0;
 
-  void readData(QFile& in, QByteArray& buf);
+  void readData();
 
   /** @brief Parses the value from a single line of the header section of the TSL .ang file
    * @param line The line to parse
    */
   void parseHeaderLine(QByteArray& buf);
 
-  /** @brief Parses the data from a line of data from the TSL .ang file
-   * @param line The line of data to parse
-   */
-  void parseDataLine(QByteArray& line, size_t i);
-
 public:
   AngReader(const AngReader&) = delete;            // Copy Constructor Not Implemented
   AngReader(AngReader&&) = delete;                 // Move Constructor Not Implemented
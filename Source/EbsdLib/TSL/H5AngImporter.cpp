@@ -100,7 +100,7 @@ H5AngImporter::~H5AngImporter() = default;
   {\
     m_msgType* dataPtr = reader.get##prpty##Pointer();\
     if (nullptr != dataPtr) {\
-      err = QH5Lite::writePointerDataset(gid, key, rank, dims, dataPtr);\
+      err = writeDataArray(gid, key, H5Lite::HDFTypeForPrimitive(m_msgType(0)), rank, dims, dataPtr);\
       if (err < 0) {\
         ss.string()->clear();\
         ss << "H5AngImporter Error: Could not write Ang Data array for '" << key\
@@ -143,19 +143,38 @@ int H5AngImporter::numberOfSlicesImported()
 // -----------------------------------------------------------------------------
 int H5AngImporter::importFile(hid_t fileId, int64_t z, const QString& angFile)
 {
-  herr_t err = -1;
   setCancel(false);
   setErrorCode(0);
   setPipelineMessage("");
+
+  int err = 0;
+  QString message;
+  EbsdReader::Pointer reader = readEbsdFile(angFile, err, message);
+  if(nullptr == reader)
+  {
+    setPipelineMessage(message);
+    setErrorCode(err);
+    progressMessage(message, 100);
+    return -1;
+  }
+  return writeEbsdData(fileId, z, reader);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+EbsdReader::Pointer H5AngImporter::readEbsdFile(const QString& angFile, int& err, QString& message) const
+{
   QString streamBuf;
   QTextStream ss(&streamBuf);
 
   //  std::cout << "H5AngImporter: Importing " << angFile;
-  AngReader reader;
-  reader.setFileName(angFile);
+  std::shared_ptr<AngReader> reader(new AngReader);
+  reader->setFileName(angFile);
+  reader->setNumberOfParserThreads(getNumberOfParserThreads());
 
   // Now actually read the file
-  err = reader.readFile();
+  err = reader->readFile();
 
   // Check for errors
   if (err < 0)
@@ -176,11 +195,11 @@ int H5AngImporter::importFile(hid_t fileId, int64_t z, const QString& angFile)
     {
       ss << "H5AngImporter Error: The Ang file could not be opened.'" << angFile << "'";
     }
-    else if (reader.getXStep() == 0.0f)
+    else if (reader->getXStep() == 0.0f)
     {
       ss << "H5AngImporter Error: X Step value equals 0.0. This is bad. Please check the validity of the ANG file.";
     }
-    else if(reader.getYStep() == 0.0f)
+    else if(reader->getYStep() == 0.0f)
     {
       ss << "H5AngImporter Error: Y Step value equals 0.0. This is bad. Please check the validity of the ANG file.";
     }
@@ -188,12 +207,32 @@ int H5AngImporter::importFile(hid_t fileId, int64_t z, const QString& angFile)
     {
       ss << "H5AngImporter Error: Unknown error [" << err << "]";
     }
-    setPipelineMessage( *(ss.string()));
+    message = *(ss.string());
+    return EbsdReader::NullPointer();
+  }
+  return reader;
+}
 
-    setErrorCode(err);
-    progressMessage(*(ss.string()), 100);
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int H5AngImporter::writeEbsdData(hid_t fileId, int64_t z, const EbsdReader::Pointer& ebsdReader)
+{
+  herr_t err = -1;
+  setErrorCode(0);
+  setPipelineMessage("");
+  QString streamBuf;
+  QTextStream ss(&streamBuf);
+
+  AngReader* angReader = dynamic_cast<AngReader*>(ebsdReader.get());
+  if(nullptr == angReader)
+  {
+    ss << "H5AngImporter Error: The data for Z index " << z << " was not read from a .ang file.";
+    setPipelineMessage(*(ss.string()));
+    setErrorCode(-1);
     return -1;
   }
+  AngReader& reader = *angReader;
 
   // Write the file Version number to the file
   {
@@ -277,7 +316,7 @@ int H5AngImporter::importFile(hid_t fileId, int64_t z, const QString& angFile)
 
   QString angCompleteHeader = reader.getOriginalHeader();
   err = QH5Lite::writeStringDataset(gid, Ebsd::H5OIM::OriginalHeader, angCompleteHeader);
-  err = QH5Lite::writeStringDataset(gid, Ebsd::H5OIM::OriginalFile, angFile);
+  err = QH5Lite::writeStringDataset(gid, Ebsd::H5OIM::OriginalFile, reader.getFileName());
 
   // Close the "Header" group
   err = H5Gclose(gid);
@@ -79,12 +79,31 @@ H5AngVolumeReader::~H5AngVolumeReader()
 #define H5ANGREADER_ALLOCATE_ARRAY(name, type)                                                                                                                                                         \
   if(readAllArrays == true || arrayNames.find(Ebsd::Ang::name) != arrayNames.end())                                                                                                                    \
   {                                                                                                                                                                                                    \
-    auto _##name = allocateArray<type>(numElements);                                                                                                                                                   \
-    if(nullptr != _##name)                                                                                                                                                                             \
+    Destination destination = getDestination(Ebsd::Ang::name);                                                                                                                                         \
+    if(nullptr != destination.ptr)                                                                                                                                                                     \
     {                                                                                                                                                                                                  \
-      ::memset(_##name, 0, numBytes);                                                                                                                                                                  \
+      /* Caller owned memory; interleaved destinations are only ever written through readSliceIntoVolume() */                                                                                         \
+      set##name##Pointer(destination.numComponents == 1 ? static_cast<type*>(destination.ptr) : nullptr);                                                                                              \
     }                                                                                                                                                                                                  \
-    set##name##Pointer(_##name);                                                                                                                                                                       \
+    else                                                                                                                                                                                               \
+    {                                                                                                                                                                                                  \
+      auto _##name = allocateArray<type>(numElements);                                                                                                                                                 \
+      if(nullptr != _##name)                                                                                                                                                                           \
+      {                                                                                                                                                                                                \
+        ::memset(_##name, 0, numBytes);                                                                                                                                                                \
+      }                                                                                                                                                                                                \
+      set##name##Pointer(_##name);                                                                                                                                                                     \
+    }                                                                                                                                                                                                  \
+  }
+
+#define H5ANGREADER_DELETE_ARRAY(var, type)                                                                                                                                                            \
+  if(isDestinationPointer(var))                                                                                                                                                                        \
+  {                                                                                                                                                                                                    \
+    var = nullptr;                                                                                                                                                                                     \
+  }                                                                                                                                                                                                    \
+  else                                                                                                                                                                                                 \
+  {                                                                                                                                                                                                    \
+    this->deallocateArrayData<type>(var);                                                                                                                                                              \
   }
 
 // -----------------------------------------------------------------------------
@@ -92,6 +111,8 @@ H5AngVolumeReader::~H5AngVolumeReader()
 // -----------------------------------------------------------------------------
 void H5AngVolumeReader::initPointers(size_t numElements)
 {
+  // Release the arrays of a previous load; destination memory is only let go of, never freed
+  deletePointers();
   setNumberOfElements(numElements);
   size_t numBytes = numElements * sizeof(float);
   bool readAllArrays = getReadAllArrays();
@@ -114,16 +135,16 @@ void H5AngVolumeReader::initPointers(size_t numElements)
 // -----------------------------------------------------------------------------
 void H5AngVolumeReader::deletePointers()
 {
-  this->deallocateArrayData<float > (m_Phi1);
-  this->deallocateArrayData<float > (m_Phi);
-  this->deallocateArrayData<float > (m_Phi2);
-  this->deallocateArrayData<float > (m_Iq);
-  this->deallocateArrayData<float > (m_Ci);
-  this->deallocateArrayData<int > (m_PhaseData);
-  this->deallocateArrayData<float > (m_X);
-  this->deallocateArrayData<float > (m_Y);
-  this->deallocateArrayData<float > (m_SEMSignal);
-  this->deallocateArrayData<float > (m_Fit);
+  H5ANGREADER_DELETE_ARRAY(m_Phi1, float)
+  H5ANGREADER_DELETE_ARRAY(m_Phi, float)
+  H5ANGREADER_DELETE_ARRAY(m_Phi2, float)
+  H5ANGREADER_DELETE_ARRAY(m_Iq, float)
+  H5ANGREADER_DELETE_ARRAY(m_Ci, float)
+  H5ANGREADER_DELETE_ARRAY(m_PhaseData, int)
+  H5ANGREADER_DELETE_ARRAY(m_X, float)
+  H5ANGREADER_DELETE_ARRAY(m_Y, float)
+  H5ANGREADER_DELETE_ARRAY(m_SEMSignal, float)
+  H5ANGREADER_DELETE_ARRAY(m_Fit, float)
 }
 
 // -----------------------------------------------------------------------------
@@ -203,6 +224,20 @@ QVector<AngPhase::Pointer> H5AngVolumeReader::getPhases()
 
 
 
+#define H5ANGREADER_ADD_SLICE_ARRAY(column, var, type)                                                                                                                                                \
+  if(readAllArrays == true || arrayNames.find(Ebsd::Ang::column) != arrayNames.end())                                                                                                                  \
+  {                                                                                                                                                                                                    \
+    SliceArray array;                                                                                                                                                                                  \
+    array.name = Ebsd::Ang::column;                                                                                                                                                                    \
+    array.memType = type;                                                                                                                                                                              \
+    array.destination = getDestination(Ebsd::Ang::column);                                                                                                                                             \
+    if(nullptr == array.destination.ptr)                                                                                                                                                               \
+    {                                                                                                                                                                                                  \
+      array.destination.ptr = var;                                                                                                                                                                     \
+    }                                                                                                                                                                                                  \
+    arrays.push_back(array);                                                                                                                                                                           \
+  }
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -211,108 +246,88 @@ int H5AngVolumeReader::loadData(int64_t xpoints,
                                 int64_t zpoints,
                                 uint32_t ZDir )
 {
-  int index = 0;
   int err = -1;
-  // Initialize all the pointers
+  // Initialize all the pointers. Arrays with a destination are read straight into it.
   initPointers(xpoints * ypoints * zpoints);
 
-
-  int readerIndex = 0;
-  int xpointsslice = 0;
-  int ypointsslice = 0;
-  int xpointstemp = 0;
-  int ypointstemp = 0;
-  int xstop = 0;
-  int ystop = 0;
-  int zval = 0;
-
-  int xstartspot = 0;
-  int ystartspot = 0;
-  int numPhases = getNumPhases();
+  bool readAllArrays = getReadAllArrays();
+  QSet<QString> arrayNames = getArraysToRead();
   err = readVolumeInfo();
-  for (int slice = 0; slice < zpoints; ++slice)
+  m_SinglePhase = (getNumPhases() == 1);
+
+  QVector<SliceArray> arrays;
+  H5ANGREADER_ADD_SLICE_ARRAY(Phi1, m_Phi1, H5T_NATIVE_FLOAT)
+  H5ANGREADER_ADD_SLICE_ARRAY(Phi, m_Phi, H5T_NATIVE_FLOAT)
+  H5ANGREADER_ADD_SLICE_ARRAY(Phi2, m_Phi2, H5T_NATIVE_FLOAT)
+  H5ANGREADER_ADD_SLICE_ARRAY(ImageQuality, m_Iq, H5T_NATIVE_FLOAT)
+  H5ANGREADER_ADD_SLICE_ARRAY(ConfidenceIndex, m_Ci, H5T_NATIVE_FLOAT)
+  H5ANGREADER_ADD_SLICE_ARRAY(PhaseData, m_PhaseData, H5T_NATIVE_INT32)
+  H5ANGREADER_ADD_SLICE_ARRAY(XPosition, m_X, H5T_NATIVE_FLOAT)
+  H5ANGREADER_ADD_SLICE_ARRAY(YPosition, m_Y, H5T_NATIVE_FLOAT)
+  H5ANGREADER_ADD_SLICE_ARRAY(Fit, m_Fit, H5T_NATIVE_FLOAT)
+  H5ANGREADER_ADD_SLICE_ARRAY(SEMSignal, m_SEMSignal, H5T_NATIVE_FLOAT)
+
+  return loadSlices(arrays, xpoints, ypoints, zpoints, ZDir);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int H5AngVolumeReader::readSliceDimensions(hid_t sliceGid, const QString& hdf5Path, int64_t& xSlice, int64_t& ySlice)
+{
+  H5AngReader::Pointer reader = H5AngReader::New();
+  reader->setHDF5Path(hdf5Path);
+  int err = reader->readHeader(sliceGid);
+  if(err < 0)
+  {
+    setErrorCode(reader->getErrorCode());
+    setErrorMessage(reader->getErrorMessage());
+    return getErrorCode();
+  }
+  if(!reader->getGrid().startsWith(Ebsd::Ang::SquareGrid))
   {
-    H5AngReader::Pointer reader = H5AngReader::New();
-    reader->setFileName(getFileName());
-    reader->setHDF5Path(QString::number(slice + getSliceStart()));
-    reader->setUserZDir(getStackingOrder());
-    reader->setSampleTransformationAngle(getSampleTransformationAngle());
-    reader->setSampleTransformationAxis(getSampleTransformationAxis());
-    reader->setEulerTransformationAngle(getEulerTransformationAngle());
-    reader->setEulerTransformationAxis(getEulerTransformationAxis());
-    reader->readAllArrays(getReadAllArrays());
-    reader->setArraysToRead(getArraysToRead());
-    err = reader->readFile();
-    if(err < 0)
+    if(reader->getGrid().startsWith(Ebsd::Ang::HexGrid))
     {
-      setErrorCode(reader->getErrorCode());
-      setErrorMessage(reader->getErrorMessage());
-      return getErrorCode();
+      setErrorCode(-90400);
+      setErrorMessage("Ang Files with Hex Grids Are NOT currently supported. Please convert them to Square Grid files first");
     }
-    readerIndex = 0;
-    xpointsslice = reader->getNumEvenCols();
-    ypointsslice = reader->getNumRows();
-    float* euler1Ptr = reader->getPhi1Pointer();
-    if (nullptr == euler1Ptr) { setErrorCode(-99090); setErrorMessage("Euler1 Pointer was nullptr from Reader"); return getErrorCode(); }
-    float* euler2Ptr = reader->getPhiPointer();
-    float* euler3Ptr = reader->getPhi2Pointer();
-    float* xPtr = reader->getXPositionPointer();
-    float* yPtr = reader->getYPositionPointer();
-    float* iqPtr = reader->getImageQualityPointer();
-    float* ciPtr = reader->getConfidenceIndexPointer();
-    int* phasePtr = reader->getPhaseDataPointer();
-    float* sigPtr = reader->getSEMSignalPointer();
-    float* fitPtr = reader->getFitPointer();
-
-    xpointstemp = static_cast<int>(xpoints);
-    ypointstemp = static_cast<int>(ypoints);
-    xstartspot = (xpointstemp - xpointsslice) / 2;
-    ystartspot = (ypointstemp - ypointsslice) / 2;
-    xstop = xpointsslice;
-    ystop = ypointsslice;
-
-    // If no stacking order preference was passed, read it from the file and use that value
-    if(ZDir == SIMPL::RefFrameZDir::UnknownRefFrameZDirection)
+    else
     {
-      ZDir = getStackingOrder();
+      setErrorCode(-90300);
+      setErrorMessage("The Grid Type was not set in the file.");
     }
-    if(ZDir == SIMPL::RefFrameZDir::LowtoHigh) { zval = slice; }
-    if(ZDir == SIMPL::RefFrameZDir::HightoLow) { zval = static_cast<int>( (zpoints - 1) - slice ); }
+    return getErrorCode();
+  }
+  xSlice = (reader->getNumOddCols() > 0) ? reader->getNumOddCols() : reader->getNumEvenCols();
+  ySlice = reader->getNumRows();
+  return 0;
+}
 
-    // Copy the data from the current storage into the new memory Location
-    for (int j = 0; j < ystop; j++)
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void H5AngVolumeReader::sliceLoaded(int64_t xpoints, int64_t ypoints, int64_t zIndex, const SliceWindow& window)
+{
+  /* For TSL OIM Files if there is a single phase then the value of the phase
+   * data is zero (0). If there are 2 or more phases then the lowest value
+   * of phase is one (1). In the rest of the reconstruction code we follow the
+   * convention that the lowest value is One (1) even if there is only a single
+   * phase. The next loop converts all zeros to ones if there is a single
+   * phase in the OIM data.
+   */
+  if(!m_SinglePhase || nullptr == m_PhaseData)
+  {
+    return;
+  }
+  for(int64_t j = 0; j < window.yCount; j++)
+  {
+    int* phases = m_PhaseData + (zIndex * xpoints * ypoints) + ((j + window.volumeY) * xpoints) + window.volumeX;
+    for(int64_t i = 0; i < window.xCount; i++)
     {
-      for (int i = 0; i < xstop; i++)
+      if(phases[i] < 1)
       {
-        index = (zval * xpointstemp * ypointstemp) + ((j + ystartspot) * xpointstemp) + (i + xstartspot);
-        if (nullptr != euler1Ptr) {m_Phi1[index] = euler1Ptr[readerIndex];}
-        if (nullptr != euler2Ptr) {m_Phi[index] = euler2Ptr[readerIndex];}
-        if (nullptr != euler3Ptr) {m_Phi2[index] = euler3Ptr[readerIndex];}
-        if (nullptr != xPtr) {m_X[index] = xPtr[readerIndex];}
-        if (nullptr != yPtr) {m_Y[index] = yPtr[readerIndex];}
-        if (nullptr != iqPtr) {m_Iq[index] = iqPtr[readerIndex];}
-        if (nullptr != ciPtr) {m_Ci[index] = ciPtr[readerIndex];}
-        if (nullptr != phasePtr) {m_PhaseData[index] = phasePtr[readerIndex];} // Phase
-        if (nullptr != sigPtr) {m_SEMSignal[index] = sigPtr[readerIndex];}
-        if (nullptr != fitPtr) {m_Fit[index] = fitPtr[readerIndex];}
-
-        /* For TSL OIM Files if there is a single phase then the value of the phase
-         * data is zero (0). If there are 2 or more phases then the lowest value
-         * of phase is one (1). In the rest of the reconstruction code we follow the
-         * convention that the lowest value is One (1) even if there is only a single
-         * phase. The next if statement converts all zeros to ones if there is a single
-         * phase in the OIM data.
-         */
-        if (numPhases == 1 && nullptr != phasePtr && m_PhaseData[index] < 1)
-        {
-          m_PhaseData[index] = 1;
-        }
-
-        ++readerIndex;
+        phases[i] = 1;
       }
     }
   }
-  return err;
 }
-
-
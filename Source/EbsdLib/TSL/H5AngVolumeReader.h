@@ -117,8 +117,16 @@ class EbsdLib_EXPORT H5AngVolumeReader : public H5EbsdVolumeReader
   protected:
     H5AngVolumeReader();
 
+    int readSliceDimensions(hid_t sliceGid, const QString& hdf5Path, int64_t& xSlice, int64_t& ySlice) override;
+
+    /**
+     * @brief Sets the phase of every unindexed voxel to one when the scan has a single phase
+     */
+    void sliceLoaded(int64_t xpoints, int64_t ypoints, int64_t zIndex, const SliceWindow& window) override;
+
   private:
     QVector<AngPhase::Pointer> m_Phases;
+    bool m_SinglePhase = false;
 
   public:
     H5AngVolumeReader(const H5AngVolumeReader&) = delete;            // Copy Constructor Not Implemented
@@ -158,7 +166,7 @@ class EbsdLib_EXPORT H5AngVolumeReader : public H5EbsdVolumeReader
 #if defined ( SIMPL_USE_SSE ) && defined ( __SSE2__ )
         _mm_free(ptr );
 #else
-        delete[] ptr;
+        free(ptr);
 #endif
         ptr = nullptr;
         //       m_NumberOfElements = 0;
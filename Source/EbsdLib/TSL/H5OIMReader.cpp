@@ -345,6 +345,22 @@ int H5OIMReader::readScanNames(QStringList& names)
 }
 
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5EbsdPatternReader::Pointer H5OIMReader::openPatternData()
+{
+  QString path = m_HDF5Path + "/" + Ebsd::H5OIM::EBSD + "/" + Ebsd::H5OIM::Data + "/" + Ebsd::Ang::PatternData;
+  H5EbsdPatternReader::Pointer patternReader = H5EbsdPatternReader::New();
+  if(patternReader->open(getFileName(), path) < 0)
+  {
+    setErrorCode(patternReader->getErrorCode());
+    setErrorMessage(patternReader->getErrorMessage());
+    return H5EbsdPatternReader::NullPointer();
+  }
+  return patternReader;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -38,6 +38,9 @@
 
 #include <cstring>
 
+#include <QtCore/QFile>
+#include <QtCore/QTextStream>
+
 #include "EbsdLib/HKL/CtfReader.h"
 
 #include "UnitTestSupport.hpp"
@@ -224,6 +227,194 @@ public:
     reader.writeFile(filePath);
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void WriteCtfHeader(QTextStream& out, int xCells, int yCells, int zCells)
+  {
+    out << "Channel Text File\n";
+    out << "Prj\tCtfReaderTest 3D\n";
+    out << "Author\t[Unknown User]\n";
+    out << "JobMode\tGrid\n";
+    out << "XCells\t" << xCells << "\n";
+    out << "YCells\t" << yCells << "\n";
+    out << "ZCells\t" << zCells << "\n";
+    out << "XStep\t0.5\n";
+    out << "YStep\t0.5\n";
+    out << "ZStep\t0.25\n";
+    out << "AcqE1\t0\n";
+    out << "AcqE2\t0\n";
+    out << "AcqE3\t0\n";
+    out << "Euler angles refer to Sample Coordinate system (CS0)!\tMag\t100\tCoverage\t100\tDevice\t0\tKV\t20\tTiltAngle\t70\tTiltAxis\t0\n";
+    out << "Phases\t1\n";
+    out << "3.231;3.231;5.148\t90.000;90.000;120.000\tTitanium\t9\t194\n";
+    out << "Phase\tX\tY\tZ\tBands\tError\tEuler1\tEuler2\tEuler3\tMAD\tBC\tBS\tGrainIndex\tGrainRandomColourR\tGrainRandomColourG\tGrainRandomColourB\n";
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void Write3DCtfFile(const QString& filePath, int xCells, int yCells, int zCells)
+  {
+    QFile file(filePath);
+    DREAM3D_REQUIRE(file.open(QIODevice::WriteOnly | QIODevice::Text))
+    QTextStream out(&file);
+    WriteCtfHeader(out, xCells, yCells, zCells);
+    for(int z = 0; z < zCells; z++)
+    {
+      for(int y = 0; y < yCells; y++)
+      {
+        for(int x = 0; x < xCells; x++)
+        {
+          int index = (z * yCells + y) * xCells + x;
+          // Every other slice uses European decimals
+          QString euler1 = QString::number(index + 0.5, 'f', 2);
+          if(z % 2 == 1)
+          {
+            euler1.replace('.', ',');
+          }
+          out << 1 << "\t" << x * 0.5 << "\t" << y * 0.5 << "\t" << z * 0.25 << "\t8\t0\t" << euler1 << "\t45.5\t12.25\t0.5\t" << index << "\t150\t" << index + 1 << "\t1\t2\t3\n";
+        }
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestRead3DCtfFile()
+  {
+    const int xCells = 7;
+    const int yCells = 5;
+    const int zCells = 3;
+    QString filePath = QString("%1/%2").arg(UnitTest::TestTempDir).arg("CTF_3D_test.ctf");
+    Write3DCtfFile(filePath, xCells, yCells, zCells);
+
+    {
+      CtfReader reader;
+      reader.setFileName(filePath);
+      int err = reader.readFile();
+      DREAM3D_REQUIRE(err == 0);
+      DREAM3D_REQUIRE(reader.getZCells() == zCells);
+      DREAM3D_REQUIRE(reader.getNumberOfElements() == xCells * yCells * zCells);
+
+      float* euler1 = reinterpret_cast<float*>(reader.getPointerByName(Ebsd::Ctf::Euler1));
+      float* z = reinterpret_cast<float*>(reader.getPointerByName(Ebsd::Ctf::Z));
+      int* bc = reinterpret_cast<int*>(reader.getPointerByName(Ebsd::Ctf::BC));
+      int* grainIndex = reinterpret_cast<int*>(reader.getPointerByName(Ebsd::Ctf::GrainIndex));
+      DREAM3D_REQUIRE(euler1 != nullptr && z != nullptr && bc != nullptr && grainIndex != nullptr)
+      for(int i = 0; i < xCells * yCells * zCells; i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(euler1[i], static_cast<float>(i + 0.5))
+        DREAM3D_REQUIRE_EQUAL(z[i], (i / (xCells * yCells)) * 0.25f)
+        DREAM3D_REQUIRE_EQUAL(bc[i], i)
+        DREAM3D_REQUIRE_EQUAL(grainIndex[i], i + 1)
+      }
+    }
+
+    {
+      CtfReader reader;
+      reader.setFileName(filePath);
+      reader.readOnlySliceIndex(1);
+      int err = reader.readFile();
+      DREAM3D_REQUIRE(err == 0);
+      DREAM3D_REQUIRE(reader.getNumberOfElements() == xCells * yCells);
+
+      int* bc = reinterpret_cast<int*>(reader.getPointerByName(Ebsd::Ctf::BC));
+      DREAM3D_REQUIRE(bc != nullptr)
+      for(int i = 0; i < xCells * yCells; i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(bc[i], xCells * yCells + i)
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  // The data section is split into far more chunks than the 1 MB default allows, so most
+  // chunk boundaries fall in the middle of the data. Every value must come out exactly as it
+  // does when a single thread parses the whole file.
+  // -----------------------------------------------------------------------------
+  void TestChunkedParse()
+  {
+    QString filePath = QString("%1/%2").arg(UnitTest::TestTempDir).arg("CTF_Chunked_test.ctf");
+    Write3DCtfFile(filePath, 23, 17, 4);
+    const QList<QString> files = {filePath, UnitTest::CtfReaderTest::USInputFile1, UnitTest::CtfReaderTest::EuropeanInputFile2};
+    for(const QString& file : files)
+    {
+      CtfReader reader;
+      reader.setFileName(file);
+      reader.setNumberOfParserThreads(1);
+      int err = reader.readFile();
+      DREAM3D_REQUIRE(err >= 0);
+
+      CtfReader chunkedReader;
+      chunkedReader.setFileName(file);
+      chunkedReader.setNumberOfParserThreads(32);
+      chunkedReader.setParserMinimumChunkSize(1);
+      err = chunkedReader.readFile();
+      DREAM3D_REQUIRE(err >= 0);
+
+      size_t numElements = reader.getNumberOfElements();
+      DREAM3D_REQUIRE_EQUAL(chunkedReader.getNumberOfElements(), numElements)
+      QList<QString> columnNames = reader.getColumnNames();
+      DREAM3D_REQUIRE(!columnNames.isEmpty())
+      for(const QString& name : columnNames)
+      {
+        // Every .ctf column is a 32 bit int or float; compared bit for bit
+        void* values = reader.getPointerByName(name);
+        void* chunkedValues = chunkedReader.getPointerByName(name);
+        DREAM3D_REQUIRE_VALID_POINTER(values)
+        DREAM3D_REQUIRE_VALID_POINTER(chunkedValues)
+        DREAM3D_REQUIRE(::memcmp(values, chunkedValues, numElements * 4) == 0)
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  // Values are tab delimited, so an empty field between two tabs is a value of its own and is
+  // stored as 0. White space around a line is not part of its values.
+  // -----------------------------------------------------------------------------
+  void TestEmptyTabField()
+  {
+    QString filePath = QString("%1/%2").arg(UnitTest::TestTempDir).arg("CTF_EmptyField_test.ctf");
+    {
+      QFile file(filePath);
+      DREAM3D_REQUIRE(file.open(QIODevice::WriteOnly | QIODevice::Text))
+      QTextStream out(&file);
+      WriteCtfHeader(out, 2, 2, 1);
+      out << "1\t0\t0\t0\t8\t0\t10.5\t45.5\t12.25\t0.5\t100\t150\t1\t1\t2\t3\n";
+      out << "1\t0.5\t0\t0\t8\t0\t\t45.5\t12.25\t0.5\t101\t150\t2\t1\t2\t3\n";
+      out << "  1\t0\t0.5\t0\t8\t0\t30.5\t45.5\t12.25\t0.5\t\t150\t3\t1\t2\t3  \n";
+      out << "1\t0.5\t0.5\t0\t8\t0\t40.5\t45.5\t12.25\t0.5\t103\t150\t4\t1\t2\t3\n";
+    }
+
+    CtfReader reader;
+    reader.setFileName(filePath);
+    int err = reader.readFile();
+    DREAM3D_REQUIRE(err == 0);
+    DREAM3D_REQUIRE(reader.getNumberOfElements() == 4);
+
+    float* euler1 = reinterpret_cast<float*>(reader.getPointerByName(Ebsd::Ctf::Euler1));
+    float* euler2 = reinterpret_cast<float*>(reader.getPointerByName(Ebsd::Ctf::Euler2));
+    int* bc = reinterpret_cast<int*>(reader.getPointerByName(Ebsd::Ctf::BC));
+    int* grainIndex = reinterpret_cast<int*>(reader.getPointerByName(Ebsd::Ctf::GrainIndex));
+    DREAM3D_REQUIRE(euler1 != nullptr && euler2 != nullptr && bc != nullptr && grainIndex != nullptr)
+    DREAM3D_REQUIRE_EQUAL(euler1[0], 10.5f)
+    DREAM3D_REQUIRE_EQUAL(euler1[1], 0.0f)
+    DREAM3D_REQUIRE_EQUAL(euler1[2], 30.5f)
+    DREAM3D_REQUIRE_EQUAL(euler1[3], 40.5f)
+    DREAM3D_REQUIRE_EQUAL(bc[0], 100)
+    DREAM3D_REQUIRE_EQUAL(bc[1], 101)
+    DREAM3D_REQUIRE_EQUAL(bc[2], 0)
+    DREAM3D_REQUIRE_EQUAL(bc[3], 103)
+    for(int i = 0; i < 4; i++)
+    {
+      // The fields after an empty one stay in their own columns
+      DREAM3D_REQUIRE_EQUAL(euler2[i], 45.5f)
+      DREAM3D_REQUIRE_EQUAL(grainIndex[i], i + 1)
+    }
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -239,6 +430,9 @@ public:
     DREAM3D_REGISTER_TEST(TestShortFile())
     DREAM3D_REGISTER_TEST(TestZeroXYCells())
     DREAM3D_REGISTER_TEST(TestWriteCtfFile());
+    DREAM3D_REGISTER_TEST(TestRead3DCtfFile());
+    DREAM3D_REGISTER_TEST(TestChunkedParse())
+    DREAM3D_REGISTER_TEST(TestEmptyTabField())
   }
 
 public:
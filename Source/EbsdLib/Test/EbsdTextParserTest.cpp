@@ -0,0 +1,198 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <cmath>
+#include <cstring>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QList>
+#include <QtCore/QtDebug>
+
+#include "EbsdLib/EbsdLib.h"
+#include "EbsdLib/EbsdTextParser.h"
+#include "EbsdLib/TSL/AngConstants.h"
+#include "EbsdLib/TSL/AngReader.h"
+
+#include "UnitTestSupport.hpp"
+
+#include "EbsdLib/Test/EbsdLibTestFileLocations.h"
+
+class EbsdTextParserTest
+{
+public:
+  EbsdTextParserTest() = default;
+  virtual ~EbsdTextParserTest() = default;
+
+  // -----------------------------------------------------------------------------
+  // Every token must convert exactly as QByteArray::toFloat() converts it, whether or not
+  // the parser takes its own fast path for it
+  // -----------------------------------------------------------------------------
+  void TestParseFloat()
+  {
+    // Plain decimal values, values with exponents, values the fast path hands to Qt, non-numbers
+    // and values with white space around them
+    const QList<QByteArray> tokens = {"0", "-0", "+0", "1", "-1", "+1.5", "3.14159", "0.000123", ".5", "-.5", "5.", "007.25",
+                                      "1e5", "1E+05", "1.5e-3", "-2.5E-10", "6.02e23", "1e-30", "1e22", "1e23", "1e39", "-1e39", "1e-50",
+                                      "123456789012345", "1234567890123456789", "0.1234567890123456789",
+                                      "nan", "NaN", "inf", "-inf", "+inf", "Infinity",
+                                      "1e", "1e+", "e5", ".", "-", "+", "", "1.2.3", "1,5", "12abc", "0x1p3", "--1", "1 2", "   ",
+                                      "1.0 ", " 1.0", "1.0\t", " -2.5e3 "};
+    for(const QByteArray& token : tokens)
+    {
+      bool qtOk = false;
+      float qtValue = token.toFloat(&qtOk);
+      float value = 0.0f;
+      bool ok = EbsdTextParser::parseFloat(token.constData(), token.constData() + token.size(), value);
+      if(ok != qtOk)
+      {
+        qDebug() << "parseFloat and QByteArray::toFloat disagree on whether" << token << "is a number";
+      }
+      DREAM3D_REQUIRE_EQUAL(ok, qtOk)
+      if(!ok)
+      {
+        continue;
+      }
+      if(std::isnan(qtValue))
+      {
+        DREAM3D_REQUIRE(std::isnan(value))
+      }
+      else
+      {
+        if(::memcmp(&value, &qtValue, sizeof(float)) != 0)
+        {
+          qDebug() << "parseFloat converted" << token << "to" << value << "instead of" << qtValue;
+        }
+        DREAM3D_REQUIRE(::memcmp(&value, &qtValue, sizeof(float)) == 0)
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestParseInt32()
+  {
+    const QList<QByteArray> tokens = {"0", "-0", "+7", "42", "007", "-15", "2147483647", "-2147483647", "2147483648", "-2147483648",
+                                      "-2147483649", "99999999999", "-99999999999",
+                                      "", "-", "+", "+-1", "- 1", "12a", "1.0", "1e3", "0x10", "1 2", "   ", "nan",
+                                      " 12", "12 ", "\t-3\t"};
+    for(const QByteArray& token : tokens)
+    {
+      bool qtOk = false;
+      int qtValue = token.toInt(&qtOk, 10);
+      int32_t value = 0;
+      bool ok = EbsdTextParser::parseInt32(token.constData(), token.constData() + token.size(), value);
+      if(ok != qtOk)
+      {
+        qDebug() << "parseInt32 and QByteArray::toInt disagree on whether" << token << "is an integer";
+      }
+      DREAM3D_REQUIRE_EQUAL(ok, qtOk)
+      if(ok)
+      {
+        DREAM3D_REQUIRE_EQUAL(value, qtValue)
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename T>
+  void CompareArray(AngReader& reader, AngReader& chunkedReader, const QString& name)
+  {
+    size_t numElements = reader.getNumberOfElements();
+    T* values = static_cast<T*>(reader.getPointerByName(name));
+    T* chunkedValues = static_cast<T*>(chunkedReader.getPointerByName(name));
+    DREAM3D_REQUIRE_VALID_POINTER(values)
+    DREAM3D_REQUIRE_VALID_POINTER(chunkedValues)
+    // Compared bit for bit so NaN values count as equal
+    DREAM3D_REQUIRE(::memcmp(values, chunkedValues, numElements * sizeof(T)) == 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  // The data section is split into far more chunks than the 1 MB default allows, so most
+  // chunk boundaries fall in the middle of the data. Every value must come out exactly as it
+  // does when a single thread parses the whole file.
+  // -----------------------------------------------------------------------------
+  void TestChunkedParse()
+  {
+    const QString file = UnitTest::AngImportTest::TestFile1;
+
+    AngReader reader;
+    reader.setFileName(file);
+    reader.setNumberOfParserThreads(1);
+    int err = reader.readFile();
+    DREAM3D_REQUIRED(err, ==, 0)
+
+    AngReader chunkedReader;
+    chunkedReader.setFileName(file);
+    chunkedReader.setNumberOfParserThreads(32);
+    chunkedReader.setParserMinimumChunkSize(1);
+    err = chunkedReader.readFile();
+    DREAM3D_REQUIRED(err, ==, 0)
+
+    DREAM3D_REQUIRE_EQUAL(chunkedReader.getNumberOfElements(), reader.getNumberOfElements())
+    CompareArray<float>(reader, chunkedReader, Ebsd::Ang::Phi1);
+    CompareArray<float>(reader, chunkedReader, Ebsd::Ang::Phi);
+    CompareArray<float>(reader, chunkedReader, Ebsd::Ang::Phi2);
+    CompareArray<float>(reader, chunkedReader, Ebsd::Ang::XPosition);
+    CompareArray<float>(reader, chunkedReader, Ebsd::Ang::YPosition);
+    CompareArray<float>(reader, chunkedReader, Ebsd::Ang::ImageQuality);
+    CompareArray<float>(reader, chunkedReader, Ebsd::Ang::ConfidenceIndex);
+    CompareArray<int32_t>(reader, chunkedReader, Ebsd::Ang::PhaseData);
+    CompareArray<float>(reader, chunkedReader, Ebsd::Ang::SEMSignal);
+    CompareArray<float>(reader, chunkedReader, Ebsd::Ang::Fit);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+
+    std::cout << "#-- EbsdTextParserTest Starting " << std::endl;
+
+    DREAM3D_REGISTER_TEST(TestParseFloat())
+    DREAM3D_REGISTER_TEST(TestParseInt32())
+    DREAM3D_REGISTER_TEST(TestChunkedParse())
+  }
+
+public:
+  EbsdTextParserTest(const EbsdTextParserTest&) = delete;            // Copy Constructor Not Implemented
+  EbsdTextParserTest(EbsdTextParserTest&&) = delete;                 // Move Constructor Not Implemented
+  EbsdTextParserTest& operator=(const EbsdTextParserTest&) = delete; // Copy Assignment Not Implemented
+  EbsdTextParserTest& operator=(EbsdTextParserTest&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,554 @@
+/* ============================================================================
+ * Copyright (c) 2015 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+/**
+ * @brief OrientationLibBenchmark measures the throughput of the OrientationLib kernels that
+ * dominate the run time of the orientation analysis filters: the per Laue class operations
+ * (misorientation, IPF coloring, ODF binning, pole figure coordinates) and every conversion in
+ * OrientationTransforms. All inputs are generated from a fixed seed so consecutive runs, and runs
+ * on different builds, time exactly the same work. The results are written as JSON.
+ *
+ * Usage: OrientationLibBenchmark [--size N] [--repetitions R] [--seed S] [--filter TEXT] [--output FILE]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <QtCore/QString>
+#include <QtCore/QVector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/Math/QuaternionMath.hpp"
+#include "SIMPLib/Math/SIMPLibMath.h"
+
+#include "OrientationLib/LaueOps/LaueOps.h"
+#include "OrientationLib/OrientationMath/OrientationArray.hpp"
+#include "OrientationLib/OrientationMath/OrientationTransforms.hpp"
+#include "OrientationLib/OrientationMath/OrientationTransformsBatch.hpp"
+
+namespace
+{
+/**
+ * @brief The Representation enum lists the orientation representations of OrientationTransforms
+ */
+enum class Representation : int
+{
+  eu = 0,
+  om,
+  ax,
+  ro,
+  qu,
+  ho,
+  cu,
+  Count
+};
+
+const size_t k_RepresentationSizes[] = {3, 9, 4, 4, 4, 3, 3};
+
+struct BenchmarkOptions
+{
+  size_t size = 100000;
+  size_t repetitions = 5;
+  uint32_t seed = 5489u;
+  std::string filter;
+  std::string output;
+};
+
+struct BenchmarkResult
+{
+  std::string name;
+  size_t items = 0;
+  size_t repetitions = 0;
+  double minTime = 0.0;    // ns per item
+  double medianTime = 0.0; // ns per item
+  double meanTime = 0.0;   // ns per item
+  double itemsPerSecond = 0.0;
+  double checksum = 0.0;
+};
+
+/**
+ * @brief The BenchmarkInputs struct holds the same random orientations in every representation
+ * plus a second set of quaternions to pair them with for the misorientation kernels.
+ */
+struct BenchmarkInputs
+{
+  size_t count = 0;
+  std::vector<float> reps[static_cast<int>(Representation::Count)];
+  std::vector<QuatF> quats1;
+  std::vector<QuatF> quats2;
+  std::vector<double> eulersD;
+  FloatArrayType::Pointer eulerArray;
+};
+
+/**
+ * @brief The BenchmarkRunner class times each kernel over the full input set a number of times
+ * and keeps the per item statistics of the repetitions.
+ */
+class BenchmarkRunner
+{
+  public:
+    BenchmarkRunner(const BenchmarkOptions& options)
+    : m_Options(options)
+    {
+    }
+
+    /**
+     * @brief run Times body, which must process items elements and return a checksum of its
+     * results so that the compiler cannot drop the work. The body is run once untimed to warm up
+     * the caches and let lazily sized outputs allocate.
+     * @param name
+     * @param items
+     * @param body
+     */
+    void run(const std::string& name, size_t items, const std::function<double()>& body)
+    {
+      if(!m_Options.filter.empty() && name.find(m_Options.filter) == std::string::npos)
+      {
+        return;
+      }
+
+      BenchmarkResult result;
+      result.name = name;
+      result.items = items;
+      result.repetitions = m_Options.repetitions;
+      result.checksum = body();
+
+      std::vector<double> times(m_Options.repetitions, 0.0);
+      for(size_t r = 0; r < m_Options.repetitions; r++)
+      {
+        auto start = std::chrono::steady_clock::now();
+        result.checksum = body();
+        auto end = std::chrono::steady_clock::now();
+        times[r] = std::chrono::duration<double, std::nano>(end - start).count() / static_cast<double>(items);
+      }
+      std::sort(times.begin(), times.end());
+      result.minTime = times.front();
+      result.medianTime = times[times.size() / 2];
+      for(double t : times)
+      {
+        result.meanTime += t;
+      }
+      result.meanTime /= static_cast<double>(times.size());
+      result.itemsPerSecond = (result.medianTime > 0.0) ? 1.0E9 / result.medianTime : 0.0;
+
+      std::cerr << std::left << std::setw(48) << name << std::right << std::setw(12) << std::fixed << std::setprecision(2) << result.medianTime << " ns/item" << std::endl;
+      m_Results.push_back(result);
+    }
+
+    const std::vector<BenchmarkResult>& getResults() const
+    {
+      return m_Results;
+    }
+
+  private:
+    BenchmarkOptions m_Options;
+    std::vector<BenchmarkResult> m_Results;
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BenchmarkInputs GenerateInputs(const BenchmarkOptions& options)
+{
+  BenchmarkInputs inputs;
+  inputs.count = options.size;
+  std::mt19937 generator(options.seed);
+  std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+
+  for(int r = 0; r < static_cast<int>(Representation::Count); r++)
+  {
+    inputs.reps[r].resize(inputs.count * k_RepresentationSizes[r]);
+  }
+  inputs.quats1.resize(inputs.count);
+  inputs.quats2.resize(inputs.count);
+  inputs.eulersD.resize(inputs.count * 3);
+  QVector<size_t> cDims(1, 3);
+  inputs.eulerArray = FloatArrayType::CreateArray(inputs.count, cDims, "Eulers");
+
+  for(size_t i = 0; i < inputs.count; i++)
+  {
+    // Uniform on SO(3) so that every part of the fundamental zones is exercised
+    float* eu = inputs.reps[static_cast<int>(Representation::eu)].data() + i * 3;
+    eu[0] = distribution(generator) * SIMPLib::Constants::k_2Pi;
+    eu[1] = std::acos(2.0f * distribution(generator) - 1.0f);
+    eu[2] = distribution(generator) * SIMPLib::Constants::k_2Pi;
+
+    FOrientArrayType euIn(eu, 3);
+    FOrientArrayType om(inputs.reps[static_cast<int>(Representation::om)].data() + i * 9, 9);
+    FOrientArrayType ax(inputs.reps[static_cast<int>(Representation::ax)].data() + i * 4, 4);
+    FOrientArrayType ro(inputs.reps[static_cast<int>(Representation::ro)].data() + i * 4, 4);
+    FOrientArrayType qu(inputs.reps[static_cast<int>(Representation::qu)].data() + i * 4, 4);
+    FOrientArrayType ho(inputs.reps[static_cast<int>(Representation::ho)].data() + i * 3, 3);
+    FOrientArrayType cu(inputs.reps[static_cast<int>(Representation::cu)].data() + i * 3, 3);
+    FOrientTransformsType::eu2om(euIn, om);
+    FOrientTransformsType::eu2ax(euIn, ax);
+    FOrientTransformsType::eu2ro(euIn, ro);
+    FOrientTransformsType::eu2qu(euIn, qu);
+    FOrientTransformsType::eu2ho(euIn, ho);
+    FOrientTransformsType::eu2cu(euIn, cu);
+
+    inputs.quats1[i] = qu.toQuaternion();
+    for(size_t c = 0; c < 3; c++)
+    {
+      inputs.eulersD[i * 3 + c] = eu[c];
+      inputs.eulerArray->setComponent(i, static_cast<int>(c), eu[c]);
+    }
+  }
+
+  // The second set of quaternions is an independent random set
+  FOrientArrayType eu(3, 0.0f);
+  FOrientArrayType qu(4, 0.0f);
+  for(size_t i = 0; i < inputs.count; i++)
+  {
+    eu[0] = distribution(generator) * SIMPLib::Constants::k_2Pi;
+    eu[1] = std::acos(2.0f * distribution(generator) - 1.0f);
+    eu[2] = distribution(generator) * SIMPLib::Constants::k_2Pi;
+    FOrientTransformsType::eu2qu(eu, qu);
+    inputs.quats2[i] = qu.toQuaternion();
+  }
+  return inputs;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double SumValues(const std::vector<float>& values)
+{
+  double sum = 0.0;
+  for(float v : values)
+  {
+    sum += std::isfinite(v) ? v : 0.0;
+  }
+  return sum;
+}
+
+typedef void (*ConversionFunc)(const FOrientArrayType&, FOrientArrayType&);
+
+struct Conversion
+{
+  const char* name;
+  Representation from;
+  Representation to;
+  ConversionFunc func;
+};
+
+#define ORIENTATION_CONVERSION(from, to)                                                                                                                                                             \
+  {                                                                                                                                                                                                    \
+    #from "2" #to, Representation::from, Representation::to, [](const FOrientArrayType& in, FOrientArrayType& out) { FOrientTransformsType::from##2##to(in, out); }                                  \
+  }
+
+const Conversion k_Conversions[] = {
+    ORIENTATION_CONVERSION(eu, om), ORIENTATION_CONVERSION(eu, ax), ORIENTATION_CONVERSION(eu, ro), ORIENTATION_CONVERSION(eu, qu), ORIENTATION_CONVERSION(eu, ho), ORIENTATION_CONVERSION(eu, cu),
+    ORIENTATION_CONVERSION(om, eu), ORIENTATION_CONVERSION(om, ax), ORIENTATION_CONVERSION(om, ro), ORIENTATION_CONVERSION(om, qu), ORIENTATION_CONVERSION(om, ho), ORIENTATION_CONVERSION(om, cu),
+    ORIENTATION_CONVERSION(ax, eu), ORIENTATION_CONVERSION(ax, om), ORIENTATION_CONVERSION(ax, ro), ORIENTATION_CONVERSION(ax, qu), ORIENTATION_CONVERSION(ax, ho), ORIENTATION_CONVERSION(ax, cu),
+    ORIENTATION_CONVERSION(ro, eu), ORIENTATION_CONVERSION(ro, om), ORIENTATION_CONVERSION(ro, ax), ORIENTATION_CONVERSION(ro, qu), ORIENTATION_CONVERSION(ro, ho), ORIENTATION_CONVERSION(ro, cu),
+    ORIENTATION_CONVERSION(qu, eu), ORIENTATION_CONVERSION(qu, om), ORIENTATION_CONVERSION(qu, ax), ORIENTATION_CONVERSION(qu, ro), ORIENTATION_CONVERSION(qu, ho), ORIENTATION_CONVERSION(qu, cu),
+    ORIENTATION_CONVERSION(ho, eu), ORIENTATION_CONVERSION(ho, om), ORIENTATION_CONVERSION(ho, ax), ORIENTATION_CONVERSION(ho, ro), ORIENTATION_CONVERSION(ho, qu), ORIENTATION_CONVERSION(ho, cu),
+    ORIENTATION_CONVERSION(cu, eu), ORIENTATION_CONVERSION(cu, om), ORIENTATION_CONVERSION(cu, ax), ORIENTATION_CONVERSION(cu, ro), ORIENTATION_CONVERSION(cu, qu), ORIENTATION_CONVERSION(cu, ho),
+};
+
+#undef ORIENTATION_CONVERSION
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void RunTransformBenchmarks(BenchmarkRunner& runner, BenchmarkInputs& inputs)
+{
+  const size_t count = inputs.count;
+  for(const Conversion& conversion : k_Conversions)
+  {
+    const size_t inSize = k_RepresentationSizes[static_cast<int>(conversion.from)];
+    const size_t outSize = k_RepresentationSizes[static_cast<int>(conversion.to)];
+    std::vector<float>& input = inputs.reps[static_cast<int>(conversion.from)];
+    std::vector<float> output(count * outSize, 0.0f);
+    ConversionFunc func = conversion.func;
+    runner.run(std::string("OrientationTransforms/") + conversion.name, count, [&]() {
+      for(size_t i = 0; i < count; i++)
+      {
+        FOrientArrayType in(input.data() + i * inSize, inSize);
+        FOrientArrayType out(output.data() + i * outSize, outSize);
+        func(in, out);
+      }
+      return SumValues(output);
+    });
+  }
+
+  // The array wide kernels, for comparison with the per tuple conversions above
+  typedef OrientationTransformsBatch<float> BatchType;
+  typedef void (*BatchFunc)(const float*, float*, size_t, size_t, size_t);
+  struct BatchConversion
+  {
+    const char* name;
+    Representation from;
+    Representation to;
+    BatchFunc func;
+  };
+  const BatchConversion batchConversions[] = {
+      {"eu2qu", Representation::eu, Representation::qu, &BatchType::eu2qu}, {"qu2eu", Representation::qu, Representation::eu, &BatchType::qu2eu},
+      {"qu2om", Representation::qu, Representation::om, &BatchType::qu2om}, {"om2qu", Representation::om, Representation::qu, &BatchType::om2qu},
+      {"ro2qu", Representation::ro, Representation::qu, &BatchType::ro2qu}, {"ho2cu", Representation::ho, Representation::cu, &BatchType::ho2cu},
+      {"cu2ho", Representation::cu, Representation::ho, &BatchType::cu2ho},
+  };
+  for(const BatchConversion& conversion : batchConversions)
+  {
+    const size_t inSize = k_RepresentationSizes[static_cast<int>(conversion.from)];
+    const size_t outSize = k_RepresentationSizes[static_cast<int>(conversion.to)];
+    const float* input = inputs.reps[static_cast<int>(conversion.from)].data();
+    std::vector<float> output(count * outSize, 0.0f);
+    BatchFunc func = conversion.func;
+    runner.run(std::string("OrientationTransformsBatch/") + conversion.name, count, [&]() {
+      func(input, output.data(), count, inSize, outSize);
+      return SumValues(output);
+    });
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void RunLaueOpsBenchmarks(BenchmarkRunner& runner, BenchmarkInputs& inputs)
+{
+  const size_t count = inputs.count;
+  float* rods = inputs.reps[static_cast<int>(Representation::ro)].data();
+
+  std::vector<LaueOps::Pointer> ops = LaueOps::getOrientationOpsVector();
+  for(const LaueOps::Pointer& op : ops)
+  {
+    const std::string prefix = op->getNameOfClass().toStdString() + "/";
+
+    runner.run(prefix + "getMisoQuat", count, [&]() {
+      double sum = 0.0;
+      float n1 = 0.0f, n2 = 0.0f, n3 = 0.0f;
+      for(size_t i = 0; i < count; i++)
+      {
+        QuatF q1 = inputs.quats1[i];
+        QuatF q2 = inputs.quats2[i];
+        sum += op->getMisoQuat(q1, q2, n1, n2, n3);
+      }
+      return sum;
+    });
+
+    std::vector<float> angles(count, 0.0f);
+    runner.run(prefix + "getMisoQuatBatch", count, [&]() {
+      op->getMisoQuatBatch(inputs.quats1.data(), inputs.quats2.data(), count, angles.data(), nullptr);
+      return SumValues(angles);
+    });
+
+    double refDir[3] = {0.0, 0.0, 1.0};
+    runner.run(prefix + "generateIPFColor", count, [&]() {
+      double sum = 0.0;
+      for(size_t i = 0; i < count; i++)
+      {
+        SIMPL::Rgb argb = op->generateIPFColor(inputs.eulersD.data() + i * 3, refDir, false);
+        sum += static_cast<double>(argb & 0x00FFFFFF);
+      }
+      return sum;
+    });
+
+    std::vector<float> fzRods(count * 4, 0.0f);
+    runner.run(prefix + "getODFFZRod", count, [&]() {
+      for(size_t i = 0; i < count; i++)
+      {
+        FOrientArrayType rod = op->getODFFZRod(FOrientArrayType(rods + i * 4, 4));
+        std::copy(rod.data(), rod.data() + 4, fzRods.data() + i * 4);
+      }
+      return SumValues(fzRods);
+    });
+
+    runner.run(prefix + "getOdfBin", count, [&]() {
+      double sum = 0.0;
+      for(size_t i = 0; i < count; i++)
+      {
+        sum += op->getOdfBin(FOrientArrayType(fzRods.data() + i * 4, 4));
+      }
+      return sum;
+    });
+
+    QVector<size_t> cDims(1, 3);
+    FloatArrayType::Pointer xyz0 = FloatArrayType::CreateArray(0, cDims, "xyz0");
+    FloatArrayType::Pointer xyz1 = FloatArrayType::CreateArray(0, cDims, "xyz1");
+    FloatArrayType::Pointer xyz2 = FloatArrayType::CreateArray(0, cDims, "xyz2");
+    runner.run(prefix + "generateSphereCoordsFromEulers", count, [&]() {
+      op->generateSphereCoordsFromEulers(inputs.eulerArray.get(), xyz0.get(), xyz1.get(), xyz2.get());
+      return static_cast<double>(xyz0->getValue(0) + xyz1->getValue(0) + xyz2->getValue(0));
+    });
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::string EscapeJson(const std::string& value)
+{
+  std::string escaped;
+  for(char c : value)
+  {
+    if(c == '"' || c == '\\')
+    {
+      escaped += '\\';
+    }
+    escaped += c;
+  }
+  return escaped;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void WriteJson(std::ostream& out, const BenchmarkOptions& options, const std::vector<BenchmarkResult>& results)
+{
+  char date[64] = {0};
+  std::time_t now = std::time(nullptr);
+  std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+  out << std::setprecision(6) << std::fixed;
+  out << "{\n";
+  out << "  \"context\": {\n";
+  out << "    \"date\": \"" << date << "\",\n";
+  out << "    \"size\": " << options.size << ",\n";
+  out << "    \"repetitions\": " << options.repetitions << ",\n";
+  out << "    \"seed\": " << options.seed << ",\n";
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  out << "    \"parallel_algorithms\": true\n";
+#else
+  out << "    \"parallel_algorithms\": false\n";
+#endif
+  out << "  },\n";
+  out << "  \"benchmarks\": [\n";
+  for(size_t i = 0; i < results.size(); i++)
+  {
+    const BenchmarkResult& r = results[i];
+    out << "    {\n";
+    out << "      \"name\": \"" << EscapeJson(r.name) << "\",\n";
+    out << "      \"items\": " << r.items << ",\n";
+    out << "      \"repetitions\": " << r.repetitions << ",\n";
+    out << "      \"time_unit\": \"ns\",\n";
+    out << "      \"min_time\": " << r.minTime << ",\n";
+    out << "      \"median_time\": " << r.medianTime << ",\n";
+    out << "      \"mean_time\": " << r.meanTime << ",\n";
+    out << "      \"items_per_second\": " << r.itemsPerSecond << ",\n";
+    out << "      \"checksum\": " << std::scientific << r.checksum << std::fixed << "\n";
+    out << "    }" << (i + 1 < results.size() ? "," : "") << "\n";
+  }
+  out << "  ]\n";
+  out << "}\n";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ParseArguments(int argc, char* argv[], BenchmarkOptions& options)
+{
+  for(int i = 1; i < argc; i++)
+  {
+    std::string arg = argv[i];
+    bool hasValue = (i + 1 < argc);
+    if(arg == "--size" && hasValue)
+    {
+      options.size = std::strtoull(argv[++i], nullptr, 10);
+    }
+    else if(arg == "--repetitions" && hasValue)
+    {
+      options.repetitions = std::strtoull(argv[++i], nullptr, 10);
+    }
+    else if(arg == "--seed" && hasValue)
+    {
+      options.seed = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+    }
+    else if(arg == "--filter" && hasValue)
+    {
+      options.filter = argv[++i];
+    }
+    else if(arg == "--output" && hasValue)
+    {
+      options.output = argv[++i];
+    }
+    else
+    {
+      std::cerr << "Usage: " << argv[0] << " [--size N] [--repetitions R] [--seed S] [--filter TEXT] [--output FILE]" << std::endl;
+      return false;
+    }
+  }
+  if(options.size == 0 || options.repetitions == 0)
+  {
+    std::cerr << "--size and --repetitions must be greater than zero" << std::endl;
+    return false;
+  }
+  return true;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  BenchmarkOptions options;
+  if(!ParseArguments(argc, argv, options))
+  {
+    return EXIT_FAILURE;
+  }
+
+  BenchmarkInputs inputs = GenerateInputs(options);
+  BenchmarkRunner runner(options);
+  RunTransformBenchmarks(runner, inputs);
+  RunLaueOpsBenchmarks(runner, inputs);
+
+  if(options.output.empty())
+  {
+    WriteJson(std::cout, options, runner.getResults());
+  }
+  else
+  {
+    std::ofstream out(options.output.c_str());
+    if(!out.is_open())
+    {
+      std::cerr << "Could not open " << options.output << " for writing" << std::endl;
+      return EXIT_FAILURE;
+    }
+    WriteJson(out, options, runner.getResults());
+  }
+  return EXIT_SUCCESS;
+}
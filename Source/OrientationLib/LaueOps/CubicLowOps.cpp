@@ -51,6 +51,7 @@
 #include "SIMPLib/Utilities/ColorTable.h"
 
 #include "OrientationLib/OrientationMath/OrientationArray.hpp"
+#include "OrientationLib/OrientationMath/OrientationFixedArray.hpp"
 #include "OrientationLib/OrientationMath/OrientationTransforms.hpp"
 #include "OrientationLib/Utilities/ModifiedLambertProjection.h"
 #include "OrientationLib/Utilities/ComputeStereographicProjection.h"
@@ -256,6 +257,16 @@ float CubicLowOps::getMisoQuat(QuatF& q1, QuatF& q2, float& n1, float& n2, float
   return _calcMisoQuat(CubicLowQuatSym, numsym, q1, q2, n1, n2, n3);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void CubicLowOps::getMisoQuatBatch(const QuatF* q1, const QuatF* q2, size_t n, float* angles, float* axes)
+{
+  int numsym = 12;
+
+  _calcMisoQuatBatch(CubicLowQuatSym, numsym, q1, q2, n, angles, axes);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -657,9 +668,10 @@ namespace Detail
 
           for(size_t i = start; i < end; ++i)
           {
-            FOrientArrayType eu(m_Eulers->getPointer(i * 3), 3);
-            FOrientArrayType om(9, 0.0);
-            OrientationTransforms<FOrientArrayType, float>::eu2om(eu, om);
+            float* euler = m_Eulers->getPointer(i * 3);
+            FOrientFixedArrayType eu(euler[0], euler[1], euler[2]);
+            FOrientFixedArrayType om(9, 0.0f);
+            FOrientFixedTransformsType::eu2om(eu, om);
             om.toGMatrix(g);
             MatrixMath::Transpose3x3(g, gTranpose);
 
@@ -973,10 +985,10 @@ SIMPL::Rgb CubicLowOps::generateIPFColor(double phi1, double phi, double phi2, d
   float _rgb[3] = { 0.0, 0.0, 0.0 };
 
   // 1) find rotation matrix from Euler angles
-  FOrientArrayType eu(phi1, phi, phi2);
-  FOrientArrayType qu(4);
-  FOrientArrayType om(9); // Reusable for the loop
-  OrientationTransforms<FOrientArrayType, float>::eu2qu(eu, qu);
+  FOrientFixedArrayType eu(phi1, phi, phi2);
+  FOrientFixedArrayType qu(4);
+  FOrientFixedArrayType om(9); // Reusable for the loop
+  FOrientFixedTransformsType::eu2qu(eu, qu);
   q1 = qu.toQuaternion();
 
   QuatF q2;
@@ -987,7 +999,7 @@ SIMPL::Rgb CubicLowOps::generateIPFColor(double phi1, double phi, double phi2, d
     QuaternionMathF::Multiply(q2, q1, qc);
 
     qu.fromQuaternion(qc);
-    OrientationTransforms<FOrientArrayType, float>::qu2om(qu, om);
+    FOrientFixedTransformsType::qu2om(qu, om);
     om.toGMatrix(g);
 
     refDirection[0] = refDir0;
@@ -1014,6 +1026,16 @@ SIMPL::Rgb CubicLowOps::generateIPFColor(double phi1, double phi, double phi2, d
       break;
   }
 
+  _calcIPFColor(eta, chi, _rgb);
+
+  return RgbColor::dRgb(_rgb[0] * 255, _rgb[1] * 255, _rgb[2] * 255, 255);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void CubicLowOps::_calcIPFColor(float eta, float chi, float _rgb[3])
+{
   float etaMin = 0.0;
   float etaMax = 90.0;
   float etaDeg = eta * SIMPLib::Constants::k_180OverPi;
@@ -1037,8 +1059,6 @@ SIMPL::Rgb CubicLowOps::generateIPFColor(double phi1, double phi, double phi2, d
   _rgb[0] = sqrt(_rgb[0]);
   _rgb[1] = sqrt(_rgb[1]);
   _rgb[2] = sqrt(_rgb[2]);
-
-  return RgbColor::dRgb(_rgb[0] * 255, _rgb[1] * 255, _rgb[2] * 255, 255);
 }
 
 // -----------------------------------------------------------------------------
@@ -53,7 +53,7 @@
  * @version 1.0
  */
 
-class OrientationLib_EXPORT CubicLowOps : public LaueOps
+class OrientationLib_EXPORT CubicLowOps final : public LaueOps
 {
   public:
     SIMPL_SHARED_POINTERS(CubicLowOps)
@@ -98,6 +98,7 @@ class OrientationLib_EXPORT CubicLowOps : public LaueOps
     QString getSymmetryName();
 
     virtual float getMisoQuat(QuatF& q1, QuatF& q2, float& n1, float& n2, float& n3);
+    virtual void getMisoQuatBatch(const QuatF* q1, const QuatF* q2, size_t n, float* angles, float* axes);
     virtual void getQuatSymOp(int i, QuatF& q);
     virtual void getRodSymOp(int i, float* r);
     virtual void getMatSymOp(int i, float g[3][3]);
@@ -178,6 +179,8 @@ class OrientationLib_EXPORT CubicLowOps : public LaueOps
 
 
   protected:
+    virtual void _calcIPFColor(float eta, float chi, float rgb[3]);
+
     float _calcMisoQuat(const QuatF quatsym[24], int numsym,
                         QuatF& q1, QuatF& q2,
                         float& n1, float& n2, float& n3);
@@ -51,6 +51,7 @@
 #include "SIMPLib/Utilities/ColorUtilities.h"
 
 #include "OrientationLib/OrientationMath/OrientationArray.hpp"
+#include "OrientationLib/OrientationMath/OrientationFixedArray.hpp"
 #include "OrientationLib/OrientationMath/OrientationTransforms.hpp"
 #include "OrientationLib/Utilities/ComputeStereographicProjection.h"
 
@@ -338,6 +339,32 @@ float CubicOps::getMisoQuat(QuatF& q1, QuatF& q2, float& n1, float& n2, float& n
   return _calcMisoQuat(CubicQuatSym, numsym, q1, q2, n1, n2, n3);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void CubicOps::getMisoQuatBatch(const QuatF* q1, const QuatF* q2, size_t n, float* angles, float* axes)
+{
+  // The cubic misorientation is found in closed form from the sorted components of
+  // the product, so there is no symmetry loop to amortize. Calling the non-virtual
+  // kernel directly still removes the per pair virtual dispatch.
+  int numsym = 24;
+  float n1 = 0.0f, n2 = 0.0f, n3 = 0.0f;
+  QuatF qa = QuaternionMathF::New();
+  QuatF qb = QuaternionMathF::New();
+  for(size_t i = 0; i < n; i++)
+  {
+    QuaternionMathF::Copy(q1[i], qa);
+    QuaternionMathF::Copy(q2[i], qb);
+    angles[i] = CubicOps::_calcMisoQuat(CubicQuatSym, numsym, qa, qb, n1, n2, n3);
+    if(nullptr != axes)
+    {
+      axes[i * 3] = n1;
+      axes[i * 3 + 1] = n2;
+      axes[i * 3 + 2] = n3;
+    }
+  }
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -1024,10 +1051,10 @@ void CubicOps::getmPrime(QuatF& q1, QuatF& q2, float LD[3], float& mPrime)
   float planeMisalignment = 0, directionMisalignment = 0;
   int ss1 = 0, ss2 = 0;
 
-  FOrientArrayType om(9);
-  FOrientTransformsType::qu2om(FOrientArrayType(q1), om);
+  FOrientFixedArrayType om(9);
+  FOrientFixedTransformsType::qu2om(FOrientFixedArrayType(q1), om);
   om.toGMatrix(g1);
-  FOrientTransformsType::qu2om(FOrientArrayType(q2), om);
+  FOrientFixedTransformsType::qu2om(FOrientFixedArrayType(q2), om);
   om.toGMatrix(g2);
   MatrixMath::Transpose3x3(g1, g1);
   MatrixMath::Transpose3x3(g2, g2);
@@ -1113,10 +1140,10 @@ void CubicOps::getF1(QuatF& q1, QuatF& q2, float LD[3], bool maxSF, float& F1)
   //float directionComponent2 = 0, planeComponent2 = 0;
   float maxF1 = 0;
 
-  FOrientArrayType om(9);
-  FOrientTransformsType::qu2om(FOrientArrayType(q1), om);
+  FOrientFixedArrayType om(9);
+  FOrientFixedTransformsType::qu2om(FOrientFixedArrayType(q1), om);
   om.toGMatrix(g1);
-  FOrientTransformsType::qu2om(FOrientArrayType(q2), om);
+  FOrientFixedTransformsType::qu2om(FOrientFixedArrayType(q2), om);
   om.toGMatrix(g2);
   MatrixMath::Transpose3x3(g1, g1);
   MatrixMath::Transpose3x3(g2, g2);
@@ -1197,10 +1224,10 @@ void CubicOps::getF1spt(QuatF& q1, QuatF& q2, float LD[3], bool maxSF, float& F1
   //s float directionComponent2 = 0, planeComponent2 = 0;
   float maxF1spt = 0;
 
-  FOrientArrayType om(9);
-  FOrientTransformsType::qu2om(FOrientArrayType(q1), om);
+  FOrientFixedArrayType om(9);
+  FOrientFixedTransformsType::qu2om(FOrientFixedArrayType(q1), om);
   om.toGMatrix(g1);
-  FOrientTransformsType::qu2om(FOrientArrayType(q2), om);
+  FOrientFixedTransformsType::qu2om(FOrientFixedArrayType(q2), om);
   om.toGMatrix(g2);
   MatrixMath::Transpose3x3(g1, g1);
   MatrixMath::Transpose3x3(g2, g2);
@@ -1283,10 +1310,10 @@ void CubicOps::getF7(QuatF& q1, QuatF& q2, float LD[3], bool maxSF, float& F7)
   // float directionComponent2 = 0, planeComponent2 = 0;
   float maxF7 = 0;
 
-  FOrientArrayType om(9);
-  FOrientTransformsType::qu2om(FOrientArrayType(q1), om);
+  FOrientFixedArrayType om(9);
+  FOrientFixedTransformsType::qu2om(FOrientFixedArrayType(q1), om);
   om.toGMatrix(g1);
-  FOrientTransformsType::qu2om(FOrientArrayType(q2), om);
+  FOrientFixedTransformsType::qu2om(FOrientFixedArrayType(q2), om);
   om.toGMatrix(g2);
   MatrixMath::Transpose3x3(g1, g1);
   MatrixMath::Transpose3x3(g2, g2);
@@ -1380,9 +1407,10 @@ namespace Detail
 
           for(size_t i = start; i < end; ++i)
           {
-            FOrientArrayType eu(m_Eulers->getPointer(i * 3), 3);
-            FOrientArrayType om(9, 0.0);
-            OrientationTransforms<FOrientArrayType, float>::eu2om(eu, om);
+            float* euler = m_Eulers->getPointer(i * 3);
+            FOrientFixedArrayType eu(euler[0], euler[1], euler[2]);
+            FOrientFixedArrayType om(9, 0.0f);
+            FOrientFixedTransformsType::eu2om(eu, om);
             om.toGMatrix(g);
             MatrixMath::Transpose3x3(g, gTranpose);
 
@@ -1695,10 +1723,10 @@ SIMPL::Rgb CubicOps::generateIPFColor(double phi1, double phi, double phi2, doub
   float chi = 0.0f, eta = 0.0f;
   float _rgb[3] = { 0.0, 0.0, 0.0 };
 
-  FOrientArrayType eu(phi1, phi, phi2);
-  FOrientArrayType qu(4);
-  FOrientArrayType om(9); // Reusable for the loop
-  OrientationTransforms<FOrientArrayType, float>::eu2qu(eu, qu);
+  FOrientFixedArrayType eu(phi1, phi, phi2);
+  FOrientFixedArrayType qu(4);
+  FOrientFixedArrayType om(9); // Reusable for the loop
+  FOrientFixedTransformsType::eu2qu(eu, qu);
   q1 = qu.toQuaternion();
 
   for (int j = 0; j < 24; j++)
@@ -1706,7 +1734,7 @@ SIMPL::Rgb CubicOps::generateIPFColor(double phi1, double phi, double phi2, doub
     QuaternionMathF::Multiply(CubicQuatSym[j], q1, qc);
 
     qu.fromQuaternion(qc);
-    OrientationTransforms<FOrientArrayType, float>::qu2om(qu, om);
+    FOrientFixedTransformsType::qu2om(qu, om);
     om.toGMatrix(g);
 
     refDirection[0] = refDir0;
@@ -1733,6 +1761,16 @@ SIMPL::Rgb CubicOps::generateIPFColor(double phi1, double phi, double phi2, doub
       break;
   }
 
+  _calcIPFColor(eta, chi, _rgb);
+
+  return RgbColor::dRgb(_rgb[0] * 255, _rgb[1] * 255, _rgb[2] * 255, 255);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void CubicOps::_calcIPFColor(float eta, float chi, float _rgb[3])
+{
   float etaMin = 0.0;
   float etaMax = 45.0;
   float etaDeg = eta * SIMPLib::Constants::k_180OverPi;
@@ -1770,9 +1808,6 @@ SIMPL::Rgb CubicOps::generateIPFColor(double phi1, double phi, double phi2, doub
   _rgb[0] = _rgb[0] / max;
   _rgb[1] = _rgb[1] / max;
   _rgb[2] = _rgb[2] / max;
-
-
-  return RgbColor::dRgb(_rgb[0] * 255, _rgb[1] * 255, _rgb[2] * 255, 255);
 }
 
 // -----------------------------------------------------------------------------
@@ -1808,22 +1843,16 @@ QVector<UInt8ArrayType::Pointer> CubicOps::generatePoleFigure(PoleFigureConfigur
   if(config.labels.size() > 1) { label1 = config.labels.at(1); }
   if(config.labels.size() > 2) { label2 = config.labels.at(2); }
 
-  int numOrientations = config.eulers->getNumberOfTuples();
-
-  // Create an Array to hold the XYZ Coordinates which are the coords on the sphere.
-  // this is size for CUBIC ONLY, <001> Family
-  QVector<size_t> dims(1, 3);
-  FloatArrayType::Pointer xyz001 = FloatArrayType::CreateArray(numOrientations * Detail::CubicHigh::symSize0, dims, label0 + QString("xyzCoords"));
-  // this is size for CUBIC ONLY, <011> Family
-  FloatArrayType::Pointer xyz011 = FloatArrayType::CreateArray(numOrientations * Detail::CubicHigh::symSize1, dims, label1 + QString("xyzCoords"));
-  // this is size for CUBIC ONLY, <111> Family
-  FloatArrayType::Pointer xyz111 = FloatArrayType::CreateArray(numOrientations * Detail::CubicHigh::symSize2, dims, label2 + QString("xyzCoords"));
+  // The crystal directions of each family, one per +/- pair. The Lambert squares are binned straight from the
+  // Euler angles so the (numOrientations * symSize) x 3 sphere coordinate arrays are never allocated.
+  const float r2 = SIMPLib::Constants::k_1OverRoot2;
+  const float r3 = SIMPLib::Constants::k_1OverRoot3;
+  std::vector<float> directions001 = {1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f};
+  std::vector<float> directions011 = {r2, r2, 0.0f, r2, 0.0f, r2, 0.0f, r2, r2, -r2, r2, 0.0f, -r2, 0.0f, r2, 0.0f, -r2, r2};
+  std::vector<float> directions111 = {r3, r3, r3, -r3, r3, r3, r3, -r3, r3, r3, r3, -r3};
 
   config.sphereRadius = 1.0f;
 
-  // Generate the coords on the sphere **** Parallelized
-  generateSphereCoordsFromEulers(config.eulers, xyz001.get(), xyz011.get(), xyz111.get());
-
   // These arrays hold the "intensity" images which eventually get converted to an actual Color RGB image
   // Generate the modified Lambert projection images (Squares, 2 of them, 1 for northern hemisphere, 1 for southern hemisphere
   DoubleArrayType::Pointer intensity001 = DoubleArrayType::CreateArray(config.imageDim * config.imageDim, label0 + "_Intensity_Image");
@@ -1837,19 +1866,19 @@ QVector<UInt8ArrayType::Pointer> CubicOps::generatePoleFigure(PoleFigureConfigur
   if(doParallel)
   {
     std::shared_ptr<tbb::task_group> g(new tbb::task_group);
-    g->run(ComputeStereographicProjection(xyz001.get(), &config, intensity001.get()));
-    g->run(ComputeStereographicProjection(xyz011.get(), &config, intensity011.get()));
-    g->run(ComputeStereographicProjection(xyz111.get(), &config, intensity111.get()));
+    g->run(ComputeStereographicProjection(config.eulers, directions001, &config, intensity001.get()));
+    g->run(ComputeStereographicProjection(config.eulers, directions011, &config, intensity011.get()));
+    g->run(ComputeStereographicProjection(config.eulers, directions111, &config, intensity111.get()));
     g->wait(); // Wait for all the threads to complete before moving on.
   }
   else
 #endif
   {
-    ComputeStereographicProjection m001(xyz001.get(), &config, intensity001.get());
+    ComputeStereographicProjection m001(config.eulers, directions001, &config, intensity001.get());
     m001();
-    ComputeStereographicProjection m011(xyz011.get(), &config, intensity011.get());
+    ComputeStereographicProjection m011(config.eulers, directions011, &config, intensity011.get());
     m011();
-    ComputeStereographicProjection m111(xyz111.get(), &config, intensity111.get());
+    ComputeStereographicProjection m111(config.eulers, directions111, &config, intensity111.get());
     m111();
   }
 
@@ -1903,7 +1932,7 @@ QVector<UInt8ArrayType::Pointer> CubicOps::generatePoleFigure(PoleFigureConfigur
   config.minScale = min;
   config.maxScale = max;
 
-  dims[0] = 4;
+  QVector<size_t> dims(1, 4);
   UInt8ArrayType::Pointer image001 = UInt8ArrayType::CreateArray(static_cast<size_t>(config.imageDim * config.imageDim), dims, label0);
   UInt8ArrayType::Pointer image011 = UInt8ArrayType::CreateArray(static_cast<size_t>(config.imageDim * config.imageDim), dims, label1);
   UInt8ArrayType::Pointer image111 = UInt8ArrayType::CreateArray(static_cast<size_t>(config.imageDim * config.imageDim), dims, label2);
@@ -50,6 +50,7 @@
 #include "SIMPLib/Utilities/ColorTable.h"
 
 #include "OrientationLib/OrientationMath/OrientationArray.hpp"
+#include "OrientationLib/OrientationMath/OrientationFixedArray.hpp"
 #include "OrientationLib/OrientationMath/OrientationTransforms.hpp"
 #include "OrientationLib/Utilities/PoleFigureUtilities.h"
 #include "OrientationLib/Utilities/ComputeStereographicProjection.h"
@@ -253,6 +254,16 @@ float HexagonalLowOps::getMisoQuat(QuatF& q1, QuatF& q2, float& n1, float& n2, f
   return _calcMisoQuat(HexQuatSym, numsym, q1, q2, n1, n2, n3);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void HexagonalLowOps::getMisoQuatBatch(const QuatF* q1, const QuatF* q2, size_t n, float* angles, float* axes)
+{
+  int numsym = 6;
+
+  _calcMisoQuatBatch(HexQuatSym, numsym, q1, q2, n, angles, axes);
+}
+
 void HexagonalLowOps::getQuatSymOp(int i, QuatF& q)
 {
   QuaternionMathF::Copy(HexQuatSym[i], q);
@@ -1134,9 +1145,10 @@ namespace Detail
 
           for(size_t i = start; i < end; ++i)
           {
-            FOrientArrayType eu(m_Eulers->getPointer(i * 3), 3);
-            FOrientArrayType om(9, 0.0);
-            OrientationTransforms<FOrientArrayType, float>::eu2om(eu, om);
+            float* euler = m_Eulers->getPointer(i * 3);
+            FOrientFixedArrayType eu(euler[0], euler[1], euler[2]);
+            FOrientFixedArrayType om(9, 0.0f);
+            FOrientFixedTransformsType::eu2om(eu, om);
             om.toGMatrix(g);
             MatrixMath::Transpose3x3(g, gTranpose);
 
@@ -1260,10 +1272,10 @@ SIMPL::Rgb HexagonalLowOps::generateIPFColor(double phi1, double phi, double phi
   float eta, chi;
   float _rgb[3] = { 0.0, 0.0, 0.0 };
 
-  FOrientArrayType eu(phi1, phi, phi2);
-  FOrientArrayType qu(4);
-  FOrientArrayType om(9); // Reusable for the loop
-  OrientationTransforms<FOrientArrayType, float>::eu2qu(eu, qu);
+  FOrientFixedArrayType eu(phi1, phi, phi2);
+  FOrientFixedArrayType qu(4);
+  FOrientFixedArrayType om(9); // Reusable for the loop
+  FOrientFixedTransformsType::eu2qu(eu, qu);
   q1 = qu.toQuaternion();
 
   for (int j = 0; j < 6; j++)
@@ -1271,7 +1283,7 @@ SIMPL::Rgb HexagonalLowOps::generateIPFColor(double phi1, double phi, double phi
     QuaternionMathF::Multiply(HexQuatSym[j], q1, qc);
 
     qu.fromQuaternion(qc);
-    OrientationTransforms<FOrientArrayType, float>::qu2om(qu, om);
+    FOrientFixedTransformsType::qu2om(qu, om);
     om.toGMatrix(g);
 
     refDirection[0] = refDir0;
@@ -1298,6 +1310,16 @@ SIMPL::Rgb HexagonalLowOps::generateIPFColor(double phi1, double phi, double phi
       break;
   }
 
+  _calcIPFColor(eta, chi, _rgb);
+
+  return RgbColor::dRgb(_rgb[0] * 255, _rgb[1] * 255, _rgb[2] * 255, 255);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void HexagonalLowOps::_calcIPFColor(float eta, float chi, float _rgb[3])
+{
   float etaMin = 0.0;
   float etaMax = 60.0;
   float chiMax = 90.0;
@@ -1326,8 +1348,6 @@ SIMPL::Rgb HexagonalLowOps::generateIPFColor(double phi1, double phi, double phi
   _rgb[0] = _rgb[0] / max;
   _rgb[1] = _rgb[1] / max;
   _rgb[2] = _rgb[2] / max;
-
-  return RgbColor::dRgb(_rgb[0] * 255, _rgb[1] * 255, _rgb[2] * 255, 255);
 }
 
 // -----------------------------------------------------------------------------
@@ -35,9 +35,12 @@
 
 #include "LaueOps.h"
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <limits>
 #include <random>
+#include <vector>
 
 #include <QtCore/QDateTime>
 
@@ -60,6 +63,8 @@
 
 namespace Detail
 {
+static const size_t MisoQuatBatchSize = 64;
+
 
 // const static float m_OnePointThree = 1.33333333333f;
 
@@ -123,8 +128,8 @@ float LaueOps::_calcMisoQuat(const QuatF quatsym[24], int numsym, QuatF& q1, Qua
       qc.w = 1;
     }
 
-    FOrientArrayType ax(4, 0.0f);
-    FOrientTransformsType::qu2ax(FOrientArrayType(qc.x, qc.y, qc.z, qc.w), ax);
+    FOrientFixedArrayType ax(4, 0.0f);
+    FOrientFixedTransformsType::qu2ax(FOrientFixedArrayType(qc.x, qc.y, qc.z, qc.w), ax);
     ax.toAxisAngle(n1, n2, n3, w);
 
     if(w > SIMPLib::Constants::k_Pi)
@@ -154,6 +159,236 @@ float LaueOps::_calcMisoQuat(const QuatF quatsym[24], int numsym, QuatF& q1, Qua
   return wmin;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void LaueOps::getMisoQuatBatch(const QuatF* q1, const QuatF* q2, size_t n, float* angles, float* axes)
+{
+  float n1 = 0.0f, n2 = 0.0f, n3 = 0.0f;
+  QuatF qa = QuaternionMathF::New();
+  QuatF qb = QuaternionMathF::New();
+  for(size_t i = 0; i < n; i++)
+  {
+    QuaternionMathF::Copy(q1[i], qa);
+    QuaternionMathF::Copy(q2[i], qb);
+    angles[i] = getMisoQuat(qa, qb, n1, n2, n3);
+    if(nullptr != axes)
+    {
+      axes[i * 3] = n1;
+      axes[i * 3 + 1] = n2;
+      axes[i * 3 + 2] = n3;
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void LaueOps::_calcMisoQuatBatch(const QuatF quatsym[24], int numsym, const QuatF* q1, const QuatF* q2, size_t n, float* angles, float* axes)
+{
+  // The rotation angle of quatsym[i] * qr only depends on the scalar part of the
+  // product, so the symmetry search is done on that dot product alone for a block
+  // of pairs held as a structure of arrays. The inner loop has no calls or
+  // branches so the compiler is free to vectorize it. The full product is only
+  // formed once per pair for the winning operator.
+  const size_t blockSize = Detail::MisoQuatBatchSize;
+  float qrx[Detail::MisoQuatBatchSize];
+  float qry[Detail::MisoQuatBatchSize];
+  float qrz[Detail::MisoQuatBatchSize];
+  float qrw[Detail::MisoQuatBatchSize];
+  float wmax[Detail::MisoQuatBatchSize];
+  int symIndex[Detail::MisoQuatBatchSize];
+
+  QuatF qr = QuaternionMathF::New();
+  QuatF qc = QuaternionMathF::New();
+  QuatF q2inv = QuaternionMathF::New();
+
+  for(size_t start = 0; start < n; start += blockSize)
+  {
+    size_t count = std::min(blockSize, n - start);
+    for(size_t j = 0; j < count; j++)
+    {
+      QuaternionMathF::Copy(q2[start + j], q2inv);
+      QuaternionMathF::Conjugate(q2inv);
+      QuaternionMathF::Multiply(q1[start + j], q2inv, qr);
+      qrx[j] = qr.x;
+      qry[j] = qr.y;
+      qrz[j] = qr.z;
+      qrw[j] = qr.w;
+      wmax[j] = -1.0f;
+      symIndex[j] = 0;
+    }
+
+    for(int i = 0; i < numsym; i++)
+    {
+      const float sx = quatsym[i].x;
+      const float sy = quatsym[i].y;
+      const float sz = quatsym[i].z;
+      const float sw = quatsym[i].w;
+      for(size_t j = 0; j < count; j++)
+      {
+        float w = std::fabs(sw * qrw[j] - sx * qrx[j] - sy * qry[j] - sz * qrz[j]);
+        bool larger = w > wmax[j];
+        wmax[j] = larger ? w : wmax[j];
+        symIndex[j] = larger ? i : symIndex[j];
+      }
+    }
+
+    for(size_t j = 0; j < count; j++)
+    {
+      qr = QuaternionMathF::New(qrx[j], qry[j], qrz[j], qrw[j]);
+      QuaternionMathF::Multiply(quatsym[symIndex[j]], qr, qc);
+      if(qc.w < -1)
+      {
+        qc.w = -1;
+      }
+      else if(qc.w > 1)
+      {
+        qc.w = 1;
+      }
+      float w = 2.0f * std::acos(std::fabs(qc.w));
+      angles[start + j] = w;
+      if(nullptr == axes)
+      {
+        continue;
+      }
+      float* axis = axes + (start + j) * 3;
+      float denom = std::sqrt(qc.x * qc.x + qc.y * qc.y + qc.z * qc.z);
+      if(denom == 0.0f || w == 0.0f)
+      {
+        axis[0] = 0.0f, axis[1] = 0.0f, axis[2] = 1.0f;
+      }
+      else
+      {
+        axis[0] = qc.x / denom;
+        axis[1] = qc.y / denom;
+        axis[2] = qc.z / denom;
+      }
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void LaueOps::generateIPFColors(const float* eulers, const int32_t* phases, int32_t phase, const bool* goodVoxels, size_t n, const double refDir[3], bool convertDegrees,
+                                uint8_t* rgbOut)
+{
+  _calcIPFColors(eulers, refDir, 0, phases, phase, goodVoxels, n, convertDegrees, rgbOut);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void LaueOps::generateIPFColors(const float* eulers, const double* refDirs, size_t n, bool convertDegrees, uint8_t* rgbOut)
+{
+  _calcIPFColors(eulers, refDirs, 3, nullptr, 0, nullptr, n, convertDegrees, rgbOut);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void LaueOps::_calcIPFColors(const float* eulers, const double* refDirs, size_t refDirStride, const int32_t* phases, int32_t phase, const bool* goodVoxels, size_t n,
+                             bool convertDegrees, uint8_t* rgbOut)
+{
+  // The color of an orientation only depends on where the reference direction
+  // lands in the crystal frame. Since om(sym * q) = om(sym) * om(q) the symmetry
+  // operators are converted to matrices once per call, the sample direction is
+  // rotated into the crystal frame once per element and the symmetric
+  // equivalents are then plain 3x3 products instead of a quaternion product and
+  // a full qu2om conversion per operator.
+  int numsym = getNumSymOps();
+  bool hasInversion = getHasInversion();
+  std::vector<float> symMats(static_cast<size_t>(numsym) * 9);
+  std::vector<float> px(numsym);
+  std::vector<float> py(numsym);
+  std::vector<float> pz(numsym);
+
+  QuatF qs = QuaternionMathF::New();
+  FOrientFixedArrayType qu(4);
+  FOrientFixedArrayType om(9);
+  for(int j = 0; j < numsym; j++)
+  {
+    getQuatSymOp(j, qs);
+    qu.fromQuaternion(qs);
+    FOrientFixedTransformsType::qu2om(qu, om);
+    std::copy(om.data(), om.data() + 9, symMats.begin() + j * 9);
+  }
+
+  float degToRad = convertDegrees ? static_cast<float>(SIMPLib::Constants::k_DegToRad) : 1.0f;
+  float r[3] = {0.0f, 0.0f, 0.0f};
+  float h[3] = {0.0f, 0.0f, 0.0f};
+  float _rgb[3] = {0.0f, 0.0f, 0.0f};
+  const float* sm = symMats.data();
+
+  for(size_t i = 0; i < n; i++)
+  {
+    if(nullptr != phases && phases[i] != phase)
+    {
+      continue;
+    }
+    if(nullptr != goodVoxels && !goodVoxels[i])
+    {
+      continue;
+    }
+
+    const double* refDir = refDirs + i * refDirStride;
+    r[0] = static_cast<float>(refDir[0]);
+    r[1] = static_cast<float>(refDir[1]);
+    r[2] = static_cast<float>(refDir[2]);
+    float mag = std::sqrt(r[0] * r[0] + r[1] * r[1] + r[2] * r[2]);
+    if(mag > 0.0f)
+    {
+      r[0] /= mag;
+      r[1] /= mag;
+      r[2] /= mag;
+    }
+
+    FOrientFixedArrayType eu(eulers[i * 3] * degToRad, eulers[i * 3 + 1] * degToRad, eulers[i * 3 + 2] * degToRad);
+    FOrientFixedTransformsType::eu2qu(eu, qu);
+    FOrientFixedTransformsType::qu2om(qu, om);
+    h[0] = om[0] * r[0] + om[1] * r[1] + om[2] * r[2];
+    h[1] = om[3] * r[0] + om[4] * r[1] + om[5] * r[2];
+    h[2] = om[6] * r[0] + om[7] * r[1] + om[8] * r[2];
+
+    // All of the symmetric equivalents at once; no calls or branches so this
+    // loop vectorizes.
+    for(int j = 0; j < numsym; j++)
+    {
+      const float* s = sm + j * 9;
+      float x = s[0] * h[0] + s[1] * h[1] + s[2] * h[2];
+      float y = s[3] * h[0] + s[4] * h[1] + s[5] * h[2];
+      float z = s[6] * h[0] + s[7] * h[1] + s[8] * h[2];
+      float flip = (hasInversion && z < 0.0f) ? -1.0f : 1.0f;
+      px[j] = x * flip;
+      py[j] = y * flip;
+      pz[j] = z * flip;
+    }
+
+    // First equivalent that lands in the standard triangle, in operator order,
+    // which is the same one generateIPFColor() picks.
+    float chi = 0.0f, eta = 0.0f;
+    for(int j = 0; j < numsym; j++)
+    {
+      if(pz[j] < 0.0f)
+      {
+        continue;
+      }
+      chi = std::acos(std::min(pz[j], 1.0f));
+      eta = std::atan2(py[j], px[j]);
+      if(inUnitTriangle(eta, chi))
+      {
+        break;
+      }
+    }
+
+    _calcIPFColor(eta, chi, _rgb);
+    rgbOut[i * 3] = static_cast<uint8_t>(static_cast<int32_t>(_rgb[0] * 255));
+    rgbOut[i * 3 + 1] = static_cast<uint8_t>(static_cast<int32_t>(_rgb[1] * 255));
+    rgbOut[i * 3 + 2] = static_cast<uint8_t>(static_cast<int32_t>(_rgb[2] * 255));
+  }
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
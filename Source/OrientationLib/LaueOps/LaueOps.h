@@ -126,6 +126,19 @@ class OrientationLib_EXPORT LaueOps
      */
     virtual float getMisoQuat(QuatF& q1, QuatF& q2, float& n1, float& n2, float& n3) = 0;
 
+    /**
+     * @brief getMisoQuatBatch Finds the misorientation between each pair of quaternions
+     * q1[i] and q2[i]. The symmetry operators are applied to the whole batch so the
+     * virtual dispatch and the symmetry loop setup are paid once per call instead
+     * of once per pair.
+     * @param q1 Pointer to n quaternions
+     * @param q2 Pointer to n quaternions
+     * @param n The number of quaternion pairs
+     * @param angles [output] The n misorientation angles in radians
+     * @param axes [output] The 3 * n misorientation axes. May be nullptr if only the angles are needed.
+     */
+    virtual void getMisoQuatBatch(const QuatF* q1, const QuatF* q2, size_t n, float* angles, float* axes);
+
     /**
      * @brief getQuatSymOp Copies the symmetry operator at index i into q
      * @param i The index into the Symmetry operators array
@@ -177,6 +190,33 @@ class OrientationLib_EXPORT LaueOps
      */
     virtual SIMPL::Rgb generateIPFColor(double e0, double e1, double e2, double dir0, double dir1, double dir2, bool convertDegrees) = 0;
 
+    /**
+     * @brief generateIPFColors Generates the IPF colors for a contiguous block of Euler angles. The
+     * symmetry operators are turned into matrices once per call so the per element cost is a single
+     * Euler conversion plus one small matrix product per symmetry operator.
+     * @param eulers Pointer to n 3 component Euler Angles
+     * @param phases Pointer to the n phase values. May be nullptr, in which case every element is colored.
+     * @param phase Only elements whose phase equals this value are colored when phases is not nullptr
+     * @param goodVoxels Pointer to n mask values. May be nullptr. Masked out elements are not colored.
+     * @param n The number of elements
+     * @param refDir The 3 Component Reference Direction
+     * @param convertDegrees Are the input angles in Degrees
+     * @param rgbOut [output] The 3 * n RGB values. Elements that are not colored are left untouched.
+     */
+    virtual void generateIPFColors(const float* eulers, const int32_t* phases, int32_t phase, const bool* goodVoxels, size_t n, const double refDir[3], bool convertDegrees,
+                                   uint8_t* rgbOut);
+
+    /**
+     * @brief generateIPFColors Generates the IPF colors for a contiguous block of Euler angles where
+     * every element has its own reference direction, e.g. face normals.
+     * @param eulers Pointer to n 3 component Euler Angles
+     * @param refDirs Pointer to n 3 Component Reference Directions
+     * @param n The number of elements
+     * @param convertDegrees Are the input angles in Degrees
+     * @param rgbOut [output] The 3 * n RGB values
+     */
+    virtual void generateIPFColors(const float* eulers, const double* refDirs, size_t n, bool convertDegrees, uint8_t* rgbOut);
+
     /**
      * @brief generateRodriguesColor Generates an RGB Color from a Rodrigues Vector
      * @param r1 First component of the Rodrigues Vector
@@ -213,6 +253,23 @@ class OrientationLib_EXPORT LaueOps
                         QuatF& q1, QuatF& q2,
                         float& n1, float& n2, float& n3);
 
+    void _calcMisoQuatBatch(const QuatF quatsym[24], int numsym,
+                            const QuatF* q1, const QuatF* q2, size_t n,
+                            float* angles, float* axes);
+
+    /**
+     * @brief _calcIPFColor Converts a direction inside the standard stereographic triangle into the
+     * normalized RGB values for this Laue class.
+     * @param eta Azimuthal angle of the direction in radians
+     * @param chi Polar angle of the direction in radians
+     * @param rgb [output] The RGB values in the range [0, 1]
+     */
+    virtual void _calcIPFColor(float eta, float chi, float rgb[3]) = 0;
+
+    void _calcIPFColors(const float* eulers, const double* refDirs, size_t refDirStride,
+                        const int32_t* phases, int32_t phase, const bool* goodVoxels, size_t n,
+                        bool convertDegrees, uint8_t* rgbOut);
+
     FOrientArrayType _calcRodNearestOrigin(const float rodsym[24][3], int numsym, FOrientArrayType rod);
     void _calcNearestQuat(const QuatF quatsym[24], int numsym, QuatF& q1, QuatF& q2);
     void _calcQuatNearestOrigin(const QuatF quatsym[24], int numsym, QuatF& qr);
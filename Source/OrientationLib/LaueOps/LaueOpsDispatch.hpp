@@ -0,0 +1,125 @@
+/* ============================================================================
+ * Copyright (c) 2015 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#pragma once
+
+#include <cstdint>
+
+#include "EbsdLib/EbsdConstants.h"
+
+#include "OrientationLib/LaueOps/CubicLowOps.h"
+#include "OrientationLib/LaueOps/CubicOps.h"
+#include "OrientationLib/LaueOps/HexagonalLowOps.h"
+#include "OrientationLib/LaueOps/HexagonalOps.h"
+#include "OrientationLib/LaueOps/MonoclinicOps.h"
+#include "OrientationLib/LaueOps/OrthoRhombicOps.h"
+#include "OrientationLib/LaueOps/TetragonalLowOps.h"
+#include "OrientationLib/LaueOps/TetragonalOps.h"
+#include "OrientationLib/LaueOps/TriclinicOps.h"
+#include "OrientationLib/LaueOps/TrigonalLowOps.h"
+#include "OrientationLib/LaueOps/TrigonalOps.h"
+
+/**
+ * @brief The LaueOpsDispatch class maps a crystal structure value onto the concrete
+ * LaueOps subclass for that Laue class and hands an instance of it to a callable.
+ *
+ * Every concrete LaueOps subclass is declared final, so calls made through the
+ * statically typed reference the callable receives are direct calls instead of
+ * virtual ones. A generic lambda is instantiated once per Laue class, which lets a
+ * filter write its inner loop once and run it without any indirect calls:
+ *
+ * @code
+ * LaueOpsDispatch::Dispatch(crystalStructure, [&](auto& ops) {
+ *   for(size_t i = 0; i < n; i++)
+ *   {
+ *     w[i] = ops.getMisoQuat(q1[i], q2[i], n1, n2, n3);
+ *   }
+ * });
+ * @endcode
+ */
+class LaueOpsDispatch
+{
+  public:
+    /**
+     * @brief Dispatch Calls func with an instance of the LaueOps subclass that matches crystalStructure
+     * @param crystalStructure One of the Ebsd::CrystalStructure values
+     * @param func Callable taking a reference to the concrete LaueOps subclass
+     * @return false if crystalStructure is not a known Laue class, in which case func is not called
+     */
+    template <typename Func>
+    static bool Dispatch(uint32_t crystalStructure, Func&& func)
+    {
+      switch(crystalStructure)
+      {
+        case Ebsd::CrystalStructure::Hexagonal_High:
+          return Invoke<HexagonalOps>(func);
+        case Ebsd::CrystalStructure::Cubic_High:
+          return Invoke<CubicOps>(func);
+        case Ebsd::CrystalStructure::Hexagonal_Low:
+          return Invoke<HexagonalLowOps>(func);
+        case Ebsd::CrystalStructure::Cubic_Low:
+          return Invoke<CubicLowOps>(func);
+        case Ebsd::CrystalStructure::Triclinic:
+          return Invoke<TriclinicOps>(func);
+        case Ebsd::CrystalStructure::Monoclinic:
+          return Invoke<MonoclinicOps>(func);
+        case Ebsd::CrystalStructure::OrthoRhombic:
+          return Invoke<OrthoRhombicOps>(func);
+        case Ebsd::CrystalStructure::Tetragonal_Low:
+          return Invoke<TetragonalLowOps>(func);
+        case Ebsd::CrystalStructure::Tetragonal_High:
+          return Invoke<TetragonalOps>(func);
+        case Ebsd::CrystalStructure::Trigonal_Low:
+          return Invoke<TrigonalLowOps>(func);
+        case Ebsd::CrystalStructure::Trigonal_High:
+          return Invoke<TrigonalOps>(func);
+        default:
+          return false;
+      }
+    }
+
+  private:
+    template <typename OpsType, typename Func>
+    static bool Invoke(Func& func)
+    {
+      OpsType ops;
+      func(ops);
+      return true;
+    }
+
+  public:
+    LaueOpsDispatch() = delete;
+    LaueOpsDispatch(const LaueOpsDispatch&) = delete; // Copy Constructor Not Implemented
+    LaueOpsDispatch(LaueOpsDispatch&&) = delete;      // Move Constructor Not Implemented
+    LaueOpsDispatch& operator=(const LaueOpsDispatch&) = delete; // Copy Assignment Not Implemented
+    LaueOpsDispatch& operator=(LaueOpsDispatch&&) = delete;      // Move Assignment Not Implemented
+};
+
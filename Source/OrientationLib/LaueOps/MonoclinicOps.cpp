@@ -50,6 +50,7 @@
 #include "SIMPLib/Utilities/ColorTable.h"
 
 #include "OrientationLib/OrientationMath/OrientationArray.hpp"
+#include "OrientationLib/OrientationMath/OrientationFixedArray.hpp"
 #include "OrientationLib/OrientationMath/OrientationTransforms.hpp"
 #include "OrientationLib/Utilities/ComputeStereographicProjection.h"
 
@@ -158,6 +159,16 @@ float MonoclinicOps::getMisoQuat(QuatF& q1, QuatF& q2, float& n1, float& n2, flo
   return _calcMisoQuat(MonoclinicQuatSym, numsym, q1, q2, n1, n2, n3);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void MonoclinicOps::getMisoQuatBatch(const QuatF* q1, const QuatF* q2, size_t n, float* angles, float* axes)
+{
+  int numsym = 2;
+
+  _calcMisoQuatBatch(MonoclinicQuatSym, numsym, q1, q2, n, angles, axes);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -522,9 +533,10 @@ namespace Detail
 
           for(size_t i = start; i < end; ++i)
           {
-            FOrientArrayType eu(m_Eulers->getPointer(i * 3), 3);
-            FOrientArrayType om(9, 0.0);
-            OrientationTransforms<FOrientArrayType, float>::eu2om(eu, om);
+            float* euler = m_Eulers->getPointer(i * 3);
+            FOrientFixedArrayType eu(euler[0], euler[1], euler[2]);
+            FOrientFixedArrayType om(9, 0.0f);
+            FOrientFixedTransformsType::eu2om(eu, om);
             om.toGMatrix(g);
             MatrixMath::Transpose3x3(g, gTranpose);
 
@@ -647,10 +659,10 @@ SIMPL::Rgb MonoclinicOps::generateIPFColor(double phi1, double phi, double phi2,
   float eta = 0.0f, chi = 0.0f;
   float _rgb[3] = { 0.0, 0.0, 0.0 };
 
-  FOrientArrayType eu(phi1, phi, phi2);
-  FOrientArrayType qu(4);
-  FOrientArrayType om(9); // Reusable for the loop
-  OrientationTransforms<FOrientArrayType, float>::eu2qu(eu, qu);
+  FOrientFixedArrayType eu(phi1, phi, phi2);
+  FOrientFixedArrayType qu(4);
+  FOrientFixedArrayType om(9); // Reusable for the loop
+  FOrientFixedTransformsType::eu2qu(eu, qu);
   q1 = qu.toQuaternion();
 
   for (int j = 0; j < 2; j++)
@@ -658,7 +670,7 @@ SIMPL::Rgb MonoclinicOps::generateIPFColor(double phi1, double phi, double phi2,
     QuaternionMathF::Multiply(MonoclinicQuatSym[j], q1, qc);
 
     qu.fromQuaternion(qc);
-    OrientationTransforms<FOrientArrayType, float>::qu2om(qu, om);
+    FOrientFixedTransformsType::qu2om(qu, om);
     om.toGMatrix(g);
 
     refDirection[0] = refDir0;
@@ -685,6 +697,16 @@ SIMPL::Rgb MonoclinicOps::generateIPFColor(double phi1, double phi, double phi2,
       break;
   }
 
+  _calcIPFColor(eta, chi, _rgb);
+
+  return RgbColor::dRgb(_rgb[0] * 255, _rgb[1] * 255, _rgb[2] * 255, 255);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void MonoclinicOps::_calcIPFColor(float eta, float chi, float _rgb[3])
+{
   float etaMin = 0.0;
   float etaMax = 180.0;
   float chiMax = 90.0;
@@ -713,8 +735,6 @@ SIMPL::Rgb MonoclinicOps::generateIPFColor(double phi1, double phi, double phi2,
   _rgb[0] = _rgb[0] / max;
   _rgb[1] = _rgb[1] / max;
   _rgb[2] = _rgb[2] / max;
-
-  return RgbColor::dRgb(_rgb[0] * 255, _rgb[1] * 255, _rgb[2] * 255, 255);
 }
 
 // -----------------------------------------------------------------------------
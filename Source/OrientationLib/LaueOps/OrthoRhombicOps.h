@@ -51,7 +51,7 @@
  * @date May 5, 2011
  * @version 1.0
  */
-class OrientationLib_EXPORT OrthoRhombicOps : public LaueOps
+class OrientationLib_EXPORT OrthoRhombicOps final : public LaueOps
 {
   public:
     SIMPL_SHARED_POINTERS(OrthoRhombicOps)
@@ -99,6 +99,7 @@ class OrientationLib_EXPORT OrthoRhombicOps : public LaueOps
 
 
     virtual float getMisoQuat(QuatF& q1, QuatF& q2, float& n1, float& n2, float& n3);
+    virtual void getMisoQuatBatch(const QuatF* q1, const QuatF* q2, size_t n, float* angles, float* axes);
     virtual void getQuatSymOp(int i, QuatF& q);
     virtual void getRodSymOp(int i, float* r);
     virtual void getMatSymOp(int i, float g[3][3]);
@@ -181,6 +182,8 @@ class OrientationLib_EXPORT OrthoRhombicOps : public LaueOps
     virtual UInt8ArrayType::Pointer generateIPFTriangleLegend(int imageDim);
 
   protected:
+    virtual void _calcIPFColor(float eta, float chi, float rgb[3]);
+
     float _calcMisoQuat(const QuatF quatsym[4], int numsym,
                         QuatF& q1, QuatF& q2,
                         float& n1, float& n2, float& n3);
@@ -31,6 +31,15 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "SO3Sampler.h"
 
+#include <algorithm>
+#include <numeric>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
 
 #include "SIMPLib/Math/SIMPLibMath.h"
 #include "SIMPLib/Math/ArrayHelpers.hpp"
@@ -470,3 +479,186 @@ SO3Sampler::OrientationListArrayType SO3Sampler::SampleRFZ(int nsteps,int pgnum)
 
   return FZlist;
 }
+
+namespace
+{
+// Number of grid slabs held in memory at once by the streaming SampleRFZ
+const int SlabsPerPass = 32;
+
+/**
+ * @brief The SampleRFZSlabsImpl class samples a range of slabs of constant x of the
+ * cubochoric grid used by SampleRFZ. Depending on which outputs are given it only
+ * counts the points inside the FZ, writes them at a precomputed offset into one
+ * contiguous array, or appends them to one vector per slab.
+ */
+class SampleRFZSlabsImpl
+{
+public:
+  SampleRFZSlabsImpl(SO3Sampler* sampler, int nsteps, int firstSlab, int fzType, int fzOrder, size_t* counts, const size_t* offsets, double* rods, std::vector<double>* slabRods)
+  : m_Sampler(sampler)
+  , m_NSteps(nsteps)
+  , m_FirstSlab(firstSlab)
+  , m_FZType(fzType)
+  , m_FZOrder(fzOrder)
+  , m_Counts(counts)
+  , m_Offsets(offsets)
+  , m_Rods(rods)
+  , m_SlabRods(slabRods)
+  {
+  }
+  virtual ~SampleRFZSlabsImpl() = default;
+
+  void generate(size_t start, size_t end) const
+  {
+    double delta = (0.50 * LPs::ap) / static_cast<double>(m_NSteps);
+    DOrientFixedArrayType cu(3);
+    DOrientFixedArrayType rod(4);
+
+    for(size_t s = start; s < end; s++)
+    {
+      int i = m_FirstSlab + static_cast<int>(s) - m_NSteps;
+      double x = static_cast<double>(i) * delta;
+      double* out = (nullptr != m_Rods) ? m_Rods + m_Offsets[s] * 4 : nullptr;
+      std::vector<double>* slab = (nullptr != m_SlabRods) ? m_SlabRods + s : nullptr;
+      if(nullptr != slab)
+      {
+        slab->clear();
+      }
+      size_t count = 0;
+
+      for(int j = -m_NSteps; j < m_NSteps; j++)
+      {
+        double y = static_cast<double>(j) * delta;
+        for(int k = -m_NSteps; k < m_NSteps; k++)
+        {
+          double z = static_cast<double>(k) * delta;
+          cu[0] = x;
+          cu[1] = y;
+          cu[2] = z;
+          DOrientFixedTransformsType::cu2ro(cu, rod);
+          if(!m_Sampler->IsinsideFZ(rod.data(), m_FZType, m_FZOrder))
+          {
+            continue;
+          }
+          if(nullptr != out)
+          {
+            std::copy(rod.data(), rod.data() + 4, out + count * 4);
+          }
+          if(nullptr != slab)
+          {
+            slab->insert(slab->end(), rod.data(), rod.data() + 4);
+          }
+          count++;
+        }
+      }
+      if(nullptr != m_Counts)
+      {
+        m_Counts[s] = count;
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    generate(r.begin(), r.end());
+  }
+#endif
+
+private:
+  SO3Sampler* m_Sampler;
+  int m_NSteps;
+  int m_FirstSlab;
+  int m_FZType;
+  int m_FZOrder;
+  size_t* m_Counts;
+  const size_t* m_Offsets;
+  double* m_Rods;
+  std::vector<double>* m_SlabRods;
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void RunSampleRFZSlabs(size_t numSlabs, const SampleRFZSlabsImpl& impl)
+{
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+  if(doParallel)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numSlabs), impl, tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    impl.generate(0, numSlabs);
+  }
+}
+} // namespace
+
+//--------------------------------------------------------------------------
+//
+//--------------------------------------------------------------------------
+size_t SO3Sampler::CountRFZ(int nsteps, int pgnum)
+{
+  size_t numSlabs = static_cast<size_t>(2 * nsteps);
+  std::vector<size_t> counts(numSlabs, 0);
+  RunSampleRFZSlabs(numSlabs, SampleRFZSlabsImpl(this, nsteps, 0, FZtarray[pgnum - 1], FZoarray[pgnum - 1], counts.data(), nullptr, nullptr, nullptr));
+  return std::accumulate(counts.begin(), counts.end(), static_cast<size_t>(0));
+}
+
+//--------------------------------------------------------------------------
+//
+//--------------------------------------------------------------------------
+size_t SO3Sampler::SampleRFZ(int nsteps, int pgnum, std::vector<double>& rods)
+{
+  int32_t FZtype = FZtarray[pgnum - 1];
+  int32_t FZorder = FZoarray[pgnum - 1];
+  size_t numSlabs = static_cast<size_t>(2 * nsteps);
+
+  // First pass only counts so the output can be allocated once at its final
+  // size; the second pass writes every slab directly at its offset.
+  std::vector<size_t> counts(numSlabs, 0);
+  RunSampleRFZSlabs(numSlabs, SampleRFZSlabsImpl(this, nsteps, 0, FZtype, FZorder, counts.data(), nullptr, nullptr, nullptr));
+
+  std::vector<size_t> offsets(numSlabs, 0);
+  size_t total = 0;
+  for(size_t s = 0; s < numSlabs; s++)
+  {
+    offsets[s] = total;
+    total += counts[s];
+  }
+
+  rods.resize(total * 4);
+  RunSampleRFZSlabs(numSlabs, SampleRFZSlabsImpl(this, nsteps, 0, FZtype, FZorder, nullptr, offsets.data(), rods.data(), nullptr));
+  return total;
+}
+
+//--------------------------------------------------------------------------
+//
+//--------------------------------------------------------------------------
+size_t SO3Sampler::SampleRFZ(int nsteps, int pgnum, const RodriguesBatchCallback& callback)
+{
+  int32_t FZtype = FZtarray[pgnum - 1];
+  int32_t FZorder = FZoarray[pgnum - 1];
+  int numSlabs = 2 * nsteps;
+
+  std::vector<std::vector<double>> slabRods(SlabsPerPass);
+  size_t total = 0;
+  for(int firstSlab = 0; firstSlab < numSlabs; firstSlab += SlabsPerPass)
+  {
+    size_t passSlabs = static_cast<size_t>(std::min(SlabsPerPass, numSlabs - firstSlab));
+    RunSampleRFZSlabs(passSlabs, SampleRFZSlabsImpl(this, nsteps, firstSlab, FZtype, FZorder, nullptr, nullptr, nullptr, slabRods.data()));
+    for(size_t s = 0; s < passSlabs; s++)
+    {
+      size_t count = slabRods[s].size() / 4;
+      if(count > 0)
+      {
+        callback(slabRods[s].data(), count);
+      }
+      total += count;
+    }
+  }
+  return total;
+}
@@ -31,7 +31,9 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #pragma once
 
-
+#include <functional>
+#include <list>
+#include <vector>
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
@@ -61,6 +63,44 @@ class OrientationLib_EXPORT SO3Sampler
     // sampler routine
     OrientationListArrayType SampleRFZ(int nsteps,int pgnum);
 
+    /**
+     * @brief RodriguesBatchCallback Receives a batch of count 4 component Rodrigues vectors
+     * stored contiguously as (n1, n2, n3, tan(w/2)). The pointer is only valid during the call.
+     */
+    typedef std::function<void(const double* rods, size_t count)> RodriguesBatchCallback;
+
+    /**
+     * @brief CountRFZ Returns the number of grid points that SampleRFZ will produce for
+     * the same arguments without storing any of them.
+     * @param nsteps Number of steps along the semi-edge of the cubochoric grid
+     * @param pgnum Point group number that selects the Rodrigues fundamental zone
+     * @return
+     */
+    size_t CountRFZ(int nsteps, int pgnum);
+
+    /**
+     * @brief SampleRFZ Samples the Rodrigues fundamental zone into one contiguous array of
+     * 4 component Rodrigues vectors. The grid is split into slabs that are sampled in parallel;
+     * the points come out in the same order as the list based version.
+     * @param nsteps Number of steps along the semi-edge of the cubochoric grid
+     * @param pgnum Point group number that selects the Rodrigues fundamental zone
+     * @param rods [output] Resized to 4 * the number of points
+     * @return The number of points inside the fundamental zone
+     */
+    size_t SampleRFZ(int nsteps, int pgnum, std::vector<double>& rods);
+
+    /**
+     * @brief SampleRFZ Samples the Rodrigues fundamental zone and streams the points to
+     * callback one grid slab at a time, in the same order as the list based version. Only
+     * a bounded number of slabs is held in memory at once so arbitrarily fine grids can be
+     * sampled. The callback is always invoked from the calling thread.
+     * @param nsteps Number of steps along the semi-edge of the cubochoric grid
+     * @param pgnum Point group number that selects the Rodrigues fundamental zone
+     * @param callback Receives each batch of points
+     * @return The number of points inside the fundamental zone
+     */
+    size_t SampleRFZ(int nsteps, int pgnum, const RodriguesBatchCallback& callback);
+
     /**
      * @brief IsinsideFZ
      * @param rod
@@ -49,6 +49,7 @@ set(OrientationLib_LaueOps_HDRS
   ${OrientationLib_SOURCE_DIR}/LaueOps/TriclinicOps.h
   ${OrientationLib_SOURCE_DIR}/LaueOps/MonoclinicOps.h
   ${OrientationLib_SOURCE_DIR}/LaueOps/SO3Sampler.h
+  ${OrientationLib_SOURCE_DIR}/LaueOps/LaueOpsDispatch.hpp
 )
 set(OrientationLib_LaueOps_SRCS
   ${OrientationLib_SOURCE_DIR}/LaueOps/LaueOps.cpp
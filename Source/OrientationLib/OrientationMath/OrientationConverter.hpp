@@ -48,6 +48,7 @@
 #include "OrientationLib/OrientationLib.h"
 #include "OrientationLib/OrientationMath/OrientationArray.hpp"
 #include "OrientationLib/OrientationMath/OrientationTransforms.hpp"
+#include "OrientationLib/OrientationMath/OrientationTransformsBatch.hpp"
 
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
@@ -290,6 +291,29 @@ class OrientationConverter
   OrientationArray_t res(om, OUTSTRIDE); \
   OrientationTransforms<OrientationArray_t, T>::CONVERSION_METHOD(rot, res); \
   }\
+  void operator()(T* in, T* out, size_t count, size_t inStride, size_t outStride) { \
+  for (size_t i = 0; i < count; ++i) { \
+  (*this)(in + i * inStride, out + i * outStride); \
+  }\
+  }\
+  private:\
+  };
+
+/**
+ * @brief This macro creates the same kind of functor as OC_CONVERTOR_FUNCTOR but for
+ * the conversions that have an array wide version in @see OrientationTransformsBatch.
+ */
+#define OC_BATCH_CONVERTOR_FUNCTOR(CLASSNAME, INSTRIDE, OUTSTRIDE, CONVERSION_METHOD)\
+  template<typename T>\
+  class CLASSNAME {\
+  public:\
+  CLASSNAME()  { }\
+  void operator()(T* eu, T* om) { \
+  OrientationTransformsBatch<T>::CONVERSION_METHOD(eu, om, 1, INSTRIDE, OUTSTRIDE); \
+  }\
+  void operator()(T* in, T* out, size_t count, size_t inStride, size_t outStride) { \
+  OrientationTransformsBatch<T>::CONVERSION_METHOD(in, out, count, inStride, outStride); \
+  }\
   private:\
   };
 
@@ -300,7 +324,7 @@ class OrientationConverter
 namespace Convertors {
 /* Euler Functors  */
 OC_CONVERTOR_FUNCTOR(Eu2Om, 3, 9, eu2om)
-OC_CONVERTOR_FUNCTOR(Eu2Qu, 3, 4, eu2qu)
+OC_BATCH_CONVERTOR_FUNCTOR(Eu2Qu, 3, 4, eu2qu)
 OC_CONVERTOR_FUNCTOR(Eu2Ax, 3, 4, eu2ax)
 OC_CONVERTOR_FUNCTOR(Eu2Ro, 3, 4, eu2ro)
 OC_CONVERTOR_FUNCTOR(Eu2Ho, 3, 3, eu2ho)
@@ -308,15 +332,15 @@ OC_CONVERTOR_FUNCTOR(Eu2Cu, 3, 3, eu2cu)
 
 /* OrientationMatrix Functors */
 OC_CONVERTOR_FUNCTOR(Om2Eu, 9, 3, om2eu)
-OC_CONVERTOR_FUNCTOR(Om2Qu, 9, 4, om2qu)
+OC_BATCH_CONVERTOR_FUNCTOR(Om2Qu, 9, 4, om2qu)
 OC_CONVERTOR_FUNCTOR(Om2Ax, 9, 4, om2ax)
 OC_CONVERTOR_FUNCTOR(Om2Ro, 9, 4, om2ro)
 OC_CONVERTOR_FUNCTOR(Om2Ho, 9, 3, om2ho)
 OC_CONVERTOR_FUNCTOR(Om2Cu, 9, 3, om2cu)
 
 /* Quaterion Functors */
-OC_CONVERTOR_FUNCTOR(Qu2Eu, 4, 3, qu2eu)
-OC_CONVERTOR_FUNCTOR(Qu2Om, 4, 9, qu2om)
+OC_BATCH_CONVERTOR_FUNCTOR(Qu2Eu, 4, 3, qu2eu)
+OC_BATCH_CONVERTOR_FUNCTOR(Qu2Om, 4, 9, qu2om)
 OC_CONVERTOR_FUNCTOR(Qu2Ax, 4, 4, qu2ax)
 OC_CONVERTOR_FUNCTOR(Qu2Ro, 4, 4, qu2ro)
 OC_CONVERTOR_FUNCTOR(Qu2Ho, 4, 3, qu2ho)
@@ -333,7 +357,7 @@ OC_CONVERTOR_FUNCTOR(Ax2Cu, 4, 3, ax2cu)
 /* Rodrigues Functors */
 OC_CONVERTOR_FUNCTOR(Ro2Eu, 4, 3, ro2eu)
 OC_CONVERTOR_FUNCTOR(Ro2Om, 4, 9, ro2om)
-OC_CONVERTOR_FUNCTOR(Ro2Qu, 4, 4, ro2qu)
+OC_BATCH_CONVERTOR_FUNCTOR(Ro2Qu, 4, 4, ro2qu)
 OC_CONVERTOR_FUNCTOR(Ro2Ax, 4, 4, ro2ax)
 OC_CONVERTOR_FUNCTOR(Ro2Ho, 4, 3, ro2ho)
 OC_CONVERTOR_FUNCTOR(Ro2Cu, 4, 3, ro2cu)  
@@ -344,7 +368,7 @@ OC_CONVERTOR_FUNCTOR(Ho2Om, 3, 9, ho2om)
 OC_CONVERTOR_FUNCTOR(Ho2Qu, 3, 4, ho2qu)
 OC_CONVERTOR_FUNCTOR(Ho2Ax, 3, 4, ho2ax)
 OC_CONVERTOR_FUNCTOR(Ho2Ro, 3, 4, ho2ro)
-OC_CONVERTOR_FUNCTOR(Ho2Cu, 3, 3, ho2cu)      
+OC_BATCH_CONVERTOR_FUNCTOR(Ho2Cu, 3, 3, ho2cu)      
 
 /* Rodrigues Functors */
 OC_CONVERTOR_FUNCTOR(Cu2Eu, 3, 3, cu2eu)
@@ -352,7 +376,7 @@ OC_CONVERTOR_FUNCTOR(Cu2Om, 3, 9, cu2om)
 OC_CONVERTOR_FUNCTOR(Cu2Qu, 3, 4, cu2qu)
 OC_CONVERTOR_FUNCTOR(Cu2Ax, 3, 4, cu2ax)
 OC_CONVERTOR_FUNCTOR(Cu2Ro, 3, 4, cu2ro)
-OC_CONVERTOR_FUNCTOR(Cu2Ho, 3, 3, cu2ho)   
+OC_BATCH_CONVERTOR_FUNCTOR(Cu2Ho, 3, 3, cu2ho)   
 
 }
 
@@ -383,11 +407,7 @@ class ConvertRepresentation
       Converter conv;
       T* input = m_InPtr + (start * m_InStride);
       T* output = m_OutPtr + (start * m_OutStride);
-      for (size_t i = start; i < end; ++i) { 
-        conv(input, output);
-        input = input + m_InStride; /* Increment input pointer */ 
-        output = output + m_OutStride; /* Increment output pointer*/ 
-      }
+      conv(input, output, end - start, m_InStride, m_OutStride);
     } 
     
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
@@ -0,0 +1,290 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <array>
+#include <assert.h>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Math/QuaternionMath.hpp"
+
+#include "OrientationLib/OrientationLib.h"
+
+
+template<typename T, size_t Capacity = 9>
+/**
+ * @brief The OrientationFixedArray class is a value type that holds a single orientation
+ * in any of the representations supported by @see OrientationTransforms. It has the same
+ * interface as @see OrientationArray but keeps its elements in a std::array that lives
+ * inline with the object, so constructing, copying or resizing one never touches the heap.
+ * The capacity defaults to 9 so that every representation (including the 3x3 orientation
+ * matrix that some of the conversions use as an intermediate) fits.
+ *
+ * Use this class instead of OrientationArray for per element conversions inside loops.
+ * OrientationArray is still the right choice for wrapping an existing array of values.
+ */
+class OrientationFixedArray
+{
+
+  public:
+    /**
+     * @brief OrientationFixedArray Constructor
+     * @param size The number of elements
+     * @param init Initialization value to be assigned to each element
+     */
+    OrientationFixedArray(size_t size = Capacity, T init = (T)(0)) :
+      m_Size(size)
+    {
+      assert(m_Size <= Capacity);
+      m_Data.fill(init);
+    }
+
+    /**
+     * @brief OrientationFixedArray
+     * @param val0
+     * @param val1
+     * @param val2
+     */
+    OrientationFixedArray(T val0, T val1, T val2) :
+      m_Size(3)
+    {
+      m_Data.fill(static_cast<T>(0));
+      m_Data[0] = val0;
+      m_Data[1] = val1;
+      m_Data[2] = val2;
+    }
+
+    /**
+     * @brief OrientationFixedArray
+     * @param val0
+     * @param val1
+     * @param val2
+     * @param val3
+     */
+    OrientationFixedArray(T val0, T val1, T val2, T val3) :
+      m_Size(4)
+    {
+      m_Data.fill(static_cast<T>(0));
+      m_Data[0] = val0;
+      m_Data[1] = val1;
+      m_Data[2] = val2;
+      m_Data[3] = val3;
+    }
+
+    /**
+    * @brief OrientationFixedArray Constructor from a Quaternion
+    * @param quat
+    */
+    explicit OrientationFixedArray(typename QuaternionMath<T>::Quaternion quat) :
+      m_Size(4)
+    {
+      m_Data.fill(static_cast<T>(0));
+      fromQuaternion(quat);
+    }
+
+    /**
+    * @brief OrientationFixedArray Constructor from a 3x3 matrix
+    * @param g
+    */
+    explicit OrientationFixedArray(T g[3][3]) :
+      m_Size(9)
+    {
+      static_assert(Capacity >= 9, "OrientationFixedArray needs a capacity of at least 9 to hold a 3x3 matrix");
+      m_Data[0] = g[0][0];
+      m_Data[1] = g[0][1];
+      m_Data[2] = g[0][2];
+      m_Data[3] = g[1][0];
+      m_Data[4] = g[1][1];
+      m_Data[5] = g[1][2];
+      m_Data[6] = g[2][0];
+      m_Data[7] = g[2][1];
+      m_Data[8] = g[2][2];
+    }
+
+    OrientationFixedArray(const OrientationFixedArray&) = default;
+    OrientationFixedArray& operator=(const OrientationFixedArray&) = default;
+
+    ~OrientationFixedArray() = default;
+
+    /**
+     * @brief Returns the number of elements
+     * @return
+     */
+    size_t size() const { return m_Size; }
+
+    /**
+     * @brief operator [] Returns a reference to the value at the indicated offset.
+     * This will assert if "i" is not within the bounds of the array size
+     * @param i
+     * @return
+     */
+    T& operator[](size_t i)
+    {
+      assert(i < m_Size);
+      return m_Data[i];
+    }
+
+    /**
+     * @brief operator [] Returns a const reference to the value at the indicated offset.
+     * This will assert if "i" is not within the bounds of the array size
+     * @param i
+     * @return
+     */
+    const T& operator[](size_t i) const
+    {
+      assert(i < m_Size);
+      return m_Data[i];
+    }
+
+    /**
+     * @brief data Returns a pointer to the internal data array
+     * @return
+     */
+    T* data() { return m_Data.data(); }
+    const T* data() const { return m_Data.data(); }
+
+    /**
+     * @brief toQuaternion
+     * @param layout
+     * @return
+     */
+    typename QuaternionMath<T>::Quaternion toQuaternion(typename QuaternionMath<T>::Order layout = QuaternionMath<T>::QuaternionVectorScalar) const
+    {
+      assert(m_Size == 4);
+      typename QuaternionMath<T>::Quaternion quat;
+      if(layout == QuaternionMath<T>::QuaternionVectorScalar)
+      {
+        quat.x = m_Data[0], quat.y = m_Data[1], quat.z = m_Data[2], quat.w = m_Data[3];
+      }
+      else
+      {
+        quat.x = m_Data[1], quat.y = m_Data[2], quat.z = m_Data[3], quat.w = m_Data[0];
+      }
+      return quat;
+    }
+
+    /**
+     * @brief fromQuaternion Copies the values from quat into the internal memory
+     * @param quat The quaternion to copy
+     */
+    void fromQuaternion(typename QuaternionMath<T>::Quaternion quat)
+    {
+      m_Size = 4;
+      m_Data[0] = quat.x;
+      m_Data[1] = quat.y;
+      m_Data[2] = quat.z;
+      m_Data[3] = quat.w;
+    }
+
+    /**
+     * @brief fromAxisAngle Copies the Axis-Angle values into this object.
+     * @param x X Component of the Axis
+     * @param y Y Component of the Axis
+     * @param z Z Component of the Axis
+     * @param w The "Angle" part
+     */
+    void fromAxisAngle(T x, T y, T z, T w)
+    {
+      m_Size = 4;
+      m_Data[0] = x;
+      m_Data[1] = y;
+      m_Data[2] = z;
+      m_Data[3] = w;
+    }
+
+    /**
+     * @brief toGMatrix Copies the internal values into the 3x3 "G" Matrix
+     * @param g
+     */
+    void toGMatrix(T g[3][3]) const
+    {
+      assert(m_Size == 9);
+      g[0][0] = m_Data[0];
+      g[0][1] = m_Data[1];
+      g[0][2] = m_Data[2];
+      g[1][0] = m_Data[3];
+      g[1][1] = m_Data[4];
+      g[1][2] = m_Data[5];
+      g[2][0] = m_Data[6];
+      g[2][1] = m_Data[7];
+      g[2][2] = m_Data[8];
+    }
+
+    /**
+     * @brief toAxisAngle Copies the values out to an Axis-Angle representation. Note that
+     * arguments will have values copied into them as they are pass-by-reference.
+     * @param x
+     * @param y
+     * @param z
+     * @param w
+     */
+    void toAxisAngle(T& x, T& y, T& z, T& w) const
+    {
+      x = m_Data[0];
+      y = m_Data[1];
+      z = m_Data[2];
+      w = m_Data[3];
+    }
+
+    /**
+     * @brief resize Changes the number of elements. Any new elements are set to zero. The
+     * size can never grow past the capacity of the class.
+     * @param size The number of elements
+     */
+    void resize(size_t size)
+    {
+      assert(size <= Capacity);
+      for(size_t i = m_Size; i < size; i++)
+      {
+        m_Data[i] = static_cast<T>(0);
+      }
+      m_Size = size;
+    }
+
+  private:
+    std::array<T, Capacity> m_Data;
+    size_t m_Size;
+};
+
+/**
+ * @brief FOrientFixedArrayType A convenience Typedef for a OrientationFixedArray<float>
+ */
+typedef OrientationFixedArray<float> FOrientFixedArrayType;
+
+/**
+ * @brief DOrientFixedArrayType A convenience Typedef for a OrientationFixedArray<double>
+ */
+typedef OrientationFixedArray<double> DOrientFixedArrayType;
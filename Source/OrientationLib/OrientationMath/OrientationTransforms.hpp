@@ -54,6 +54,7 @@
 
 #include "OrientationLib/OrientationLib.h"
 #include "OrientationLib/OrientationMath/OrientationArray.hpp"
+#include "OrientationLib/OrientationMath/OrientationFixedArray.hpp"
 #include "OrientationLib/Utilities/ModifiedLambertProjection3D.hpp"
 
 
@@ -132,7 +133,7 @@ namespace DConst = SIMPLib::Constants;
 
 /**
  * @brief The OrientationTransforms class
- * template parameter T can be one of std::vector<T>, QVector<T> or OrientationArray<T>
+ * template parameter T can be one of std::vector<T>, QVector<T>, OrientationArray<T> or OrientationFixedArray<T>
  * and template parameter K is the type specified in T. For example if T is std::vector<float>
  * then K is float.
  */
@@ -2164,4 +2165,7 @@ class OrientationTransforms
 typedef OrientationTransforms<FOrientArrayType, float>     FOrientTransformsType;
 typedef OrientationTransforms<DOrientArrayType, double>     DOrientTransformsType;
 
+typedef OrientationTransforms<FOrientFixedArrayType, float>     FOrientFixedTransformsType;
+typedef OrientationTransforms<DOrientFixedArrayType, double>     DOrientFixedTransformsType;
+
 
@@ -0,0 +1,425 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Math/SIMPLibMath.h"
+
+#include "OrientationLib/OrientationLib.h"
+#include "OrientationLib/OrientationMath/OrientationFixedArray.hpp"
+#include "OrientationLib/OrientationMath/OrientationTransforms.hpp"
+#include "OrientationLib/Utilities/ModifiedLambertProjection3D.hpp"
+
+/**
+ * @brief The OrientationTransformsBatch class holds array wide versions of the most
+ * heavily used conversions in @see OrientationTransforms. Each method converts n tuples
+ * stored one after the other (with the given strides) in a plain array of K.
+ *
+ * The tuples are processed in blocks of k_BlockSize. Each block is first gathered into
+ * structure-of-arrays scratch buffers, then converted with loops over the block that have
+ * no data dependent branches so the compiler can map them onto SIMD lanes, and finally
+ * scattered back into the output. Conversions that are mostly branching (the Lambert
+ * cube/ball mappings) are run tuple by tuple on @see OrientationFixedArray so they at
+ * least never touch the heap.
+ *
+ * Quaternions are always in the <Vector>Scalar layout that the rest of DREAM.3D stores in
+ * its arrays. The results agree with the scalar methods to within float rounding.
+ */
+template <typename K>
+class OrientationTransformsBatch
+{
+  public:
+    static const size_t k_BlockSize = 16;
+
+    using FixedArrayType = OrientationFixedArray<K>;
+    using ScalarTransformsType = OrientationTransforms<FixedArrayType, K>;
+
+    /**
+     * @brief eu2qu Converts Bunge Euler angles (radians) to unit quaternions
+     * @param eu Input Euler angles
+     * @param qu Output quaternions
+     * @param n Number of tuples to convert
+     * @param inStride Number of values between consecutive input tuples
+     * @param outStride Number of values between consecutive output tuples
+     */
+    static void eu2qu(const K* eu, K* qu, size_t n, size_t inStride = 3, size_t outStride = 4)
+    {
+      ProcessBlocks<3, 4>(eu, qu, n, inStride, outStride, &Eu2QuBlock);
+    }
+
+    /**
+     * @brief qu2eu Converts unit quaternions to Bunge Euler angles (radians)
+     * @param qu Input quaternions
+     * @param eu Output Euler angles
+     * @param n Number of tuples to convert
+     * @param inStride Number of values between consecutive input tuples
+     * @param outStride Number of values between consecutive output tuples
+     */
+    static void qu2eu(const K* qu, K* eu, size_t n, size_t inStride = 4, size_t outStride = 3)
+    {
+      ProcessBlocks<4, 3>(qu, eu, n, inStride, outStride, &Qu2EuBlock);
+    }
+
+    /**
+     * @brief qu2om Converts unit quaternions to row major 3x3 orientation matrices
+     * @param qu Input quaternions
+     * @param om Output orientation matrices
+     * @param n Number of tuples to convert
+     * @param inStride Number of values between consecutive input tuples
+     * @param outStride Number of values between consecutive output tuples
+     */
+    static void qu2om(const K* qu, K* om, size_t n, size_t inStride = 4, size_t outStride = 9)
+    {
+      ProcessBlocks<4, 9>(qu, om, n, inStride, outStride, &Qu2OmBlock);
+    }
+
+    /**
+     * @brief om2qu Converts row major 3x3 orientation matrices to unit quaternions
+     * @param om Input orientation matrices
+     * @param qu Output quaternions
+     * @param n Number of tuples to convert
+     * @param inStride Number of values between consecutive input tuples
+     * @param outStride Number of values between consecutive output tuples
+     */
+    static void om2qu(const K* om, K* qu, size_t n, size_t inStride = 9, size_t outStride = 4)
+    {
+      ProcessBlocks<9, 4>(om, qu, n, inStride, outStride, &Om2QuBlock);
+    }
+
+    /**
+     * @brief ro2qu Converts Rodrigues vectors (unit axis, tan(w/2)) to unit quaternions
+     * @param ro Input Rodrigues vectors
+     * @param qu Output quaternions
+     * @param n Number of tuples to convert
+     * @param inStride Number of values between consecutive input tuples
+     * @param outStride Number of values between consecutive output tuples
+     */
+    static void ro2qu(const K* ro, K* qu, size_t n, size_t inStride = 4, size_t outStride = 4)
+    {
+      ProcessBlocks<4, 4>(ro, qu, n, inStride, outStride, &Ro2QuBlock);
+    }
+
+    /**
+     * @brief ho2cu Converts homochoric vectors to cubochoric vectors
+     * @param ho Input homochoric vectors
+     * @param cu Output cubochoric vectors
+     * @param n Number of tuples to convert
+     * @param inStride Number of values between consecutive input tuples
+     * @param outStride Number of values between consecutive output tuples
+     */
+    static void ho2cu(const K* ho, K* cu, size_t n, size_t inStride = 3, size_t outStride = 3)
+    {
+      FixedArrayType in(3);
+      int ierr = 0;
+      for(size_t i = 0; i < n; i++)
+      {
+        in[0] = ho[i * inStride];
+        in[1] = ho[i * inStride + 1];
+        in[2] = ho[i * inStride + 2];
+        FixedArrayType res = ModifiedLambertProjection3D<FixedArrayType, K>::LambertBallToCube(in, ierr);
+        cu[i * outStride] = res[0];
+        cu[i * outStride + 1] = res[1];
+        cu[i * outStride + 2] = res[2];
+      }
+    }
+
+    /**
+     * @brief cu2ho Converts cubochoric vectors to homochoric vectors
+     * @param cu Input cubochoric vectors
+     * @param ho Output homochoric vectors
+     * @param n Number of tuples to convert
+     * @param inStride Number of values between consecutive input tuples
+     * @param outStride Number of values between consecutive output tuples
+     */
+    static void cu2ho(const K* cu, K* ho, size_t n, size_t inStride = 3, size_t outStride = 3)
+    {
+      FixedArrayType in(3);
+      int ierr = 0;
+      for(size_t i = 0; i < n; i++)
+      {
+        in[0] = cu[i * inStride];
+        in[1] = cu[i * inStride + 1];
+        in[2] = cu[i * inStride + 2];
+        FixedArrayType res = ModifiedLambertProjection3D<FixedArrayType, K>::LambertCubeToBall(in, ierr);
+        ho[i * outStride] = res[0];
+        ho[i * outStride + 1] = res[1];
+        ho[i * outStride + 2] = res[2];
+      }
+    }
+
+  protected:
+    OrientationTransformsBatch() = default;
+
+    using BlockType = K[k_BlockSize];
+
+    /**
+     * @brief ProcessBlocks Gathers blocks of tuples into SoA scratch buffers, runs kernel on
+     * each block and scatters the results back out.
+     */
+    template <size_t InComps, size_t OutComps, typename Kernel>
+    static void ProcessBlocks(const K* in, K* out, size_t n, size_t inStride, size_t outStride, Kernel kernel)
+    {
+      K src[InComps][k_BlockSize];
+      K dst[OutComps][k_BlockSize];
+      for(size_t start = 0; start < n; start += k_BlockSize)
+      {
+        size_t count = std::min(k_BlockSize, n - start);
+        const K* inPtr = in + start * inStride;
+        for(size_t l = 0; l < count; l++)
+        {
+          for(size_t c = 0; c < InComps; c++)
+          {
+            src[c][l] = inPtr[l * inStride + c];
+          }
+        }
+        // Pad a partial block with a valid value so the kernels never see garbage
+        for(size_t l = count; l < k_BlockSize; l++)
+        {
+          for(size_t c = 0; c < InComps; c++)
+          {
+            src[c][l] = src[c][0];
+          }
+        }
+
+        kernel(src, dst);
+
+        K* outPtr = out + start * outStride;
+        for(size_t l = 0; l < count; l++)
+        {
+          for(size_t c = 0; c < OutComps; c++)
+          {
+            outPtr[l * outStride + c] = dst[c][l];
+          }
+        }
+      }
+    }
+
+    /**
+     * @brief WrapAngle Maps a negative angle back into [0, period) the same way the scalar transforms do
+     */
+    static K WrapAngle(K angle, double period)
+    {
+      return (angle < 0.0) ? static_cast<K>(std::fmod(angle + 100.0 * SIMPLib::Constants::k_Pi, period)) : angle;
+    }
+
+    static void Eu2QuBlock(const BlockType* eu, BlockType* qu)
+    {
+      const K eps = static_cast<K>(Rotations::Constants::epsijk);
+      for(size_t l = 0; l < k_BlockSize; l++)
+      {
+        K e0 = static_cast<K>(0.5) * eu[0][l];
+        K e1 = static_cast<K>(0.5) * eu[1][l];
+        K e2 = static_cast<K>(0.5) * eu[2][l];
+        K cPhi = std::cos(e1);
+        K sPhi = std::sin(e1);
+        K cm = std::cos(e0 - e2);
+        K sm = std::sin(e0 - e2);
+        K cp = std::cos(e0 + e2);
+        K sp = std::sin(e0 + e2);
+        K w = cPhi * cp;
+        // Keep the scalar part positive
+        K sign = (w < 0.0) ? static_cast<K>(-1.0) : static_cast<K>(1.0);
+        qu[0][l] = sign * -eps * sPhi * cm;
+        qu[1][l] = sign * -eps * sPhi * sm;
+        qu[2][l] = sign * -eps * cPhi * sp;
+        qu[3][l] = sign * w;
+      }
+    }
+
+    static void Qu2EuBlock(const BlockType* qu, BlockType* eu)
+    {
+      const K eps = static_cast<K>(Rotations::Constants::epsijk);
+      for(size_t l = 0; l < k_BlockSize; l++)
+      {
+        K x = qu[0][l];
+        K y = qu[1][l];
+        K z = qu[2][l];
+        // The passive and active conventions only differ by the sign of the scalar part
+        K w = eps * qu[3][l];
+
+        K q03 = qu[3][l] * qu[3][l] + z * z;
+        K q12 = x * x + y * y;
+        K chi = std::sqrt(q03 * q12);
+        bool degenerate = (chi == 0.0);
+        K chiInv = degenerate ? static_cast<K>(0.0) : static_cast<K>(1.0) / chi;
+
+        K Phi = std::atan2(static_cast<K>(2.0) * chi, q03 - q12);
+        K phi1 = std::atan2((-w * y + x * z) * chiInv, (-w * x - y * z) * chiInv);
+        K phi2 = std::atan2((w * y + x * z) * chiInv, (-w * x + y * z) * chiInv);
+
+        // Rotations about the sample Z axis (q12 == 0) or with Phi == pi (q03 == 0)
+        bool aboutZ = (q12 == 0.0);
+        K degPhi1 = aboutZ ? std::atan2(static_cast<K>(-2.0) * w * z, w * w - z * z) : std::atan2(static_cast<K>(2.0) * x * y, x * x - y * y);
+        K degPhi = aboutZ ? static_cast<K>(0.0) : static_cast<K>(SIMPLib::Constants::k_Pi);
+
+        eu[0][l] = degenerate ? degPhi1 : phi1;
+        eu[1][l] = degenerate ? degPhi : Phi;
+        eu[2][l] = degenerate ? static_cast<K>(0.0) : phi2;
+      }
+      for(size_t l = 0; l < k_BlockSize; l++)
+      {
+        eu[0][l] = WrapAngle(eu[0][l], SIMPLib::Constants::k_2Pi);
+        eu[1][l] = WrapAngle(eu[1][l], SIMPLib::Constants::k_Pi);
+        eu[2][l] = WrapAngle(eu[2][l], SIMPLib::Constants::k_2Pi);
+      }
+    }
+
+    static void Qu2OmBlock(const BlockType* qu, BlockType* om)
+    {
+      // The active convention stores the transpose
+      const bool transpose = (Rotations::Constants::epsijk != 1.0);
+      const size_t _01 = transpose ? 3 : 1;
+      const size_t _10 = transpose ? 1 : 3;
+      const size_t _12 = transpose ? 7 : 5;
+      const size_t _21 = transpose ? 5 : 7;
+      const size_t _02 = transpose ? 6 : 2;
+      const size_t _20 = transpose ? 2 : 6;
+      for(size_t l = 0; l < k_BlockSize; l++)
+      {
+        K x = qu[0][l];
+        K y = qu[1][l];
+        K z = qu[2][l];
+        K w = qu[3][l];
+        K qq = w * w - (x * x + y * y + z * z);
+        om[0][l] = qq + static_cast<K>(2.0) * x * x;
+        om[4][l] = qq + static_cast<K>(2.0) * y * y;
+        om[8][l] = qq + static_cast<K>(2.0) * z * z;
+        om[_01][l] = static_cast<K>(2.0) * (x * y - w * z);
+        om[_12][l] = static_cast<K>(2.0) * (y * z - w * x);
+        om[_20][l] = static_cast<K>(2.0) * (z * x - w * y);
+        om[_10][l] = static_cast<K>(2.0) * (y * x + w * z);
+        om[_21][l] = static_cast<K>(2.0) * (z * y + w * x);
+        om[_02][l] = static_cast<K>(2.0) * (x * z + w * y);
+      }
+    }
+
+    static void Om2QuBlock(const BlockType* om, BlockType* qu)
+    {
+      const K eps = static_cast<K>(Rotations::Constants::epsijk);
+      const K thr = (sizeof(K) == 4) ? static_cast<K>(1.0E-6L) : static_cast<K>(1.0E-10L);
+      // om2eu snaps Phi to pi within 1.0E-6, which the scalar om2qu only reaches below a scalar part of about 7.1E-4
+      const K halfTurnThr = static_cast<K>(1.0E-3L);
+      bool halfTurn[k_BlockSize];
+      size_t numHalfTurns = 0;
+      for(size_t l = 0; l < k_BlockSize; l++)
+      {
+        K s = om[0][l] + om[4][l] + om[8][l] + static_cast<K>(1.0);
+        K s1 = om[0][l] - om[4][l] - om[8][l] + static_cast<K>(1.0);
+        K s2 = -om[0][l] + om[4][l] - om[8][l] + static_cast<K>(1.0);
+        K s3 = -om[0][l] - om[4][l] + om[8][l] + static_cast<K>(1.0);
+        s = SIMPLibMath::closeEnough(std::fabs(s), static_cast<K>(0.0), thr) ? static_cast<K>(0.0) : s;
+        s1 = SIMPLibMath::closeEnough(std::fabs(s1), static_cast<K>(0.0), thr) ? static_cast<K>(0.0) : s1;
+        s2 = SIMPLibMath::closeEnough(std::fabs(s2), static_cast<K>(0.0), thr) ? static_cast<K>(0.0) : s2;
+        s3 = SIMPLibMath::closeEnough(std::fabs(s3), static_cast<K>(0.0), thr) ? static_cast<K>(0.0) : s3;
+        K w = std::sqrt(s) * static_cast<K>(0.5);
+        K x = std::sqrt(s1) * static_cast<K>(0.5);
+        K y = std::sqrt(s2) * static_cast<K>(0.5);
+        K z = std::sqrt(s3) * static_cast<K>(0.5);
+
+        // verify the signs (q0 always positive)
+        x = (om[7][l] < om[5][l]) ? -eps * x : x;
+        y = (om[2][l] < om[6][l]) ? -eps * y : y;
+        z = (om[3][l] < om[1][l]) ? -eps * z : z;
+
+        K mag = std::sqrt(x * x + y * y + z * z + w * w);
+        K scale = (mag != 0.0) ? static_cast<K>(1.0) / mag : static_cast<K>(1.0);
+        qu[0][l] = x * scale;
+        qu[1][l] = y * scale;
+        qu[2][l] = z * scale;
+        qu[3][l] = w * scale;
+        halfTurn[l] = (qu[3][l] < halfTurnThr);
+        numHalfTurns += halfTurn[l] ? 1 : 0;
+      }
+      if(numHalfTurns == 0)
+      {
+        return;
+      }
+
+      // Away from a half turn the signs above are the ones the scalar om2qu ends up with. Close to
+      // one it takes the signs of the axis that om2eu -> eu2ax produces, so do the same there.
+      FixedArrayType o(9);
+      FixedArrayType eu(3);
+      FixedArrayType ax(4);
+      for(size_t l = 0; l < k_BlockSize; l++)
+      {
+        if(!halfTurn[l])
+        {
+          continue;
+        }
+        for(size_t c = 0; c < 9; c++)
+        {
+          o[c] = om[c][l];
+        }
+        ScalarTransformsType::om2eu(o, eu);
+        ScalarTransformsType::eu2ax(eu, ax);
+        qu[0][l] = (ax[0] * qu[0][l] < 0.0) ? -qu[0][l] : qu[0][l];
+        qu[1][l] = (ax[1] * qu[1][l] < 0.0) ? -qu[1][l] : qu[1][l];
+        qu[2][l] = (ax[2] * qu[2][l] < 0.0) ? -qu[2][l] : qu[2][l];
+      }
+    }
+
+    static void Ro2QuBlock(const BlockType* ro, BlockType* qu)
+    {
+      for(size_t l = 0; l < k_BlockSize; l++)
+      {
+        K ta = ro[3][l];
+        bool identity = (ta == 0.0);
+        bool halfTurn = (ta == std::numeric_limits<K>::infinity());
+        K angle = halfTurn ? static_cast<K>(SIMPLib::Constants::k_Pi) : static_cast<K>(2.0 * std::atan(ta));
+        K len = std::sqrt(ro[0][l] * ro[0][l] + ro[1][l] * ro[1][l] + ro[2][l] * ro[2][l]);
+        K invLen = (halfTurn || identity) ? static_cast<K>(1.0) : static_cast<K>(1.0) / len;
+        K c = std::cos(angle * static_cast<K>(0.5));
+        K s = std::sin(angle * static_cast<K>(0.5)) * invLen;
+        qu[0][l] = identity ? static_cast<K>(0.0) : ro[0][l] * s;
+        qu[1][l] = identity ? static_cast<K>(0.0) : ro[1][l] * s;
+        qu[2][l] = identity ? static_cast<K>(0.0) : ro[2][l] * s;
+        qu[3][l] = identity ? static_cast<K>(1.0) : c;
+      }
+    }
+
+  public:
+    OrientationTransformsBatch(const OrientationTransformsBatch&) = delete; // Copy Constructor Not Implemented
+    OrientationTransformsBatch(OrientationTransformsBatch&&) = delete;      // Move Constructor Not Implemented
+    OrientationTransformsBatch& operator=(const OrientationTransformsBatch&) = delete; // Copy Assignment Not Implemented
+    OrientationTransformsBatch& operator=(OrientationTransformsBatch&&) = delete;      // Move Assignment Not Implemented
+};
+
+typedef OrientationTransformsBatch<float> FOrientTransformsBatchType;
+typedef OrientationTransformsBatch<double> DOrientTransformsBatchType;
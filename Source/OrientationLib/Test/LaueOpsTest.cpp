@@ -0,0 +1,518 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "SIMPLib/Math/QuaternionMath.hpp"
+#include "SIMPLib/Math/SIMPLibMath.h"
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Utilities/ColorTable.h"
+#include "UnitTestSupport.hpp"
+
+#include "OrientationLib/LaueOps/LaueOps.h"
+#include "OrientationLib/LaueOps/LaueOpsDispatch.hpp"
+#include "OrientationLib/OrientationLib.h"
+#include "OrientationLib/OrientationMath/OrientationTransforms.hpp"
+#include "OrientationLib/Texture/DistributionAccumulator.h"
+#include "OrientationLib/Texture/MdfAccumulator.h"
+#include "OrientationLib/Texture/OdfAccumulator.h"
+#include "OrientationLib/Utilities/ModifiedLambertProjection.h"
+
+#include "OrientationLibTestFileLocations.h"
+
+class LaueOpsTest
+{
+public:
+  LaueOpsTest()
+  {
+  }
+  virtual ~LaueOpsTest()
+  {
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RemoveTestFiles()
+  {
+#if REMOVE_TEST_FILES
+// QFile::remove();
+#endif
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  std::vector<QuatF> GenerateRandomQuats(size_t count, uint32_t seed)
+  {
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+
+    std::vector<QuatF> quats(count);
+    FOrientArrayType eu(3, 0.0f);
+    FOrientArrayType qu(4, 0.0f);
+    for(size_t i = 0; i < count; i++)
+    {
+      eu[0] = distribution(generator) * SIMPLib::Constants::k_2Pi;
+      eu[1] = distribution(generator) * SIMPLib::Constants::k_Pi;
+      eu[2] = distribution(generator) * SIMPLib::Constants::k_2Pi;
+      FOrientTransformsType::eu2qu(eu, qu);
+      quats[i] = qu.toQuaternion();
+    }
+    return quats;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestMisoQuatBatch()
+  {
+    // Use a count that is not a multiple of the internal block size so the tail is exercised
+    const size_t count = 1001;
+    std::vector<QuatF> q1 = GenerateRandomQuats(count, 5489u);
+    std::vector<QuatF> q2 = GenerateRandomQuats(count, 1234u);
+    // Make some pairs identical to exercise the zero angle case
+    q2[0] = q1[0];
+    q2[500] = q1[500];
+
+    std::vector<float> angles(count, 0.0f);
+    std::vector<float> axes(count * 3, 0.0f);
+
+    std::vector<LaueOps::Pointer> ops = LaueOps::getOrientationOpsVector();
+    for(size_t o = 0; o < ops.size(); o++)
+    {
+      ops[o]->getMisoQuatBatch(q1.data(), q2.data(), count, angles.data(), axes.data());
+      for(size_t i = 0; i < count; i++)
+      {
+        float n1 = 0.0f, n2 = 0.0f, n3 = 0.0f;
+        QuatF qa = q1[i];
+        QuatF qb = q2[i];
+        float w = ops[o]->getMisoQuat(qa, qb, n1, n2, n3);
+        DREAM3D_REQUIRE(std::fabs(w - angles[i]) < 1.0E-4f)
+        // The axis is only well defined away from zero rotation
+        if(w > 1.0E-2f)
+        {
+          float dot = n1 * axes[i * 3] + n2 * axes[i * 3 + 1] + n3 * axes[i * 3 + 2];
+          DREAM3D_REQUIRE(std::fabs(dot) > 0.999f)
+        }
+      }
+
+      // Angles only
+      std::vector<float> anglesOnly(count, 0.0f);
+      ops[o]->getMisoQuatBatch(q1.data(), q2.data(), count, anglesOnly.data(), nullptr);
+      for(size_t i = 0; i < count; i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(anglesOnly[i], angles[i])
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestSymOpDotMisorientation()
+  {
+    // FindKernelAvgMisorientations multiplies q1 by the symmetry operators up front and takes the
+    // misorientation angle as 2*acos(max |dot(S_i*q1, q2)|). Check it against getMisoQuat on random
+    // pairs, half of them close together as neighboring Cells usually are.
+    const size_t count = 1000;
+    std::vector<QuatF> q1 = GenerateRandomQuats(count, 5489u);
+    std::vector<QuatF> q2 = GenerateRandomQuats(count, 1234u);
+    std::mt19937 generator(42u);
+    std::uniform_real_distribution<float> distribution(-0.02f, 0.02f);
+    for(size_t i = 0; i < count / 2; i++)
+    {
+      q2[i].x = q1[i].x + distribution(generator);
+      q2[i].y = q1[i].y + distribution(generator);
+      q2[i].z = q1[i].z + distribution(generator);
+      q2[i].w = q1[i].w + distribution(generator);
+      QuaternionMathF::UnitQuaternion(q2[i]);
+    }
+    q2[0] = q1[0];
+
+    std::vector<LaueOps::Pointer> ops = LaueOps::getOrientationOpsVector();
+    for(size_t o = 0; o < ops.size(); o++)
+    {
+      int32_t numSymOps = ops[o]->getNumSymOps();
+      std::vector<QuatF> symOps(numSymOps);
+      for(int32_t s = 0; s < numSymOps; s++)
+      {
+        ops[o]->getQuatSymOp(s, symOps[s]);
+      }
+
+      for(size_t i = 0; i < count; i++)
+      {
+        QuatF qs = QuaternionMathF::New();
+        float wmax = 0.0f;
+        for(int32_t s = 0; s < numSymOps; s++)
+        {
+          QuaternionMathF::Multiply(symOps[s], q1[i], qs);
+          float w = std::fabs(qs.x * q2[i].x + qs.y * q2[i].y + qs.z * q2[i].z + qs.w * q2[i].w);
+          wmax = std::max(wmax, w);
+        }
+        wmax = std::min(wmax, 1.0f);
+
+        float n1 = 0.0f, n2 = 0.0f, n3 = 0.0f;
+        QuatF qa = q1[i];
+        QuatF qb = q2[i];
+        float w = ops[o]->getMisoQuat(qa, qb, n1, n2, n3);
+        // Compare the cosines of the half angles, acos loses too much precision near 1 for small misorientations
+        DREAM3D_REQUIRE(std::fabs(std::cos(0.5f * w) - wmax) < 1.0E-5f)
+        DREAM3D_REQUIRE(std::fabs(2.0f * std::acos(wmax) - w) < 1.0E-2f)
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  bool ColorsMatch(SIMPL::Rgb argb, const uint8_t* rgb)
+  {
+    // Allow for the float rounding differences between the two paths
+    return std::abs(RgbColor::dRed(argb) - rgb[0]) <= 2 && std::abs(RgbColor::dGreen(argb) - rgb[1]) <= 2 && std::abs(RgbColor::dBlue(argb) - rgb[2]) <= 2;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestIPFColorBatch()
+  {
+    const size_t count = 1001;
+    std::mt19937 generator(5489u);
+    std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+
+    std::vector<float> eulers(count * 3, 0.0f);
+    std::vector<int32_t> phases(count, 1);
+    std::vector<double> refDirs(count * 3, 0.0);
+    for(size_t i = 0; i < count; i++)
+    {
+      eulers[i * 3] = distribution(generator) * SIMPLib::Constants::k_2Pi;
+      eulers[i * 3 + 1] = distribution(generator) * SIMPLib::Constants::k_Pi;
+      eulers[i * 3 + 2] = distribution(generator) * SIMPLib::Constants::k_2Pi;
+      refDirs[i * 3] = distribution(generator) * 2.0 - 1.0;
+      refDirs[i * 3 + 1] = distribution(generator) * 2.0 - 1.0;
+      refDirs[i * 3 + 2] = distribution(generator) * 2.0 - 1.0;
+    }
+    // Every third element belongs to another phase and must be left alone
+    for(size_t i = 0; i < count; i += 3)
+    {
+      phases[i] = 2;
+    }
+
+    // Not normalized on purpose
+    double refDir[3] = {0.2, 0.3, 1.0};
+    std::vector<uint8_t> colors(count * 3, 0);
+
+    std::vector<LaueOps::Pointer> ops = LaueOps::getOrientationOpsVector();
+    for(size_t o = 0; o < ops.size(); o++)
+    {
+      std::fill(colors.begin(), colors.end(), 7);
+      ops[o]->generateIPFColors(eulers.data(), phases.data(), 1, nullptr, count, refDir, false, colors.data());
+      for(size_t i = 0; i < count; i++)
+      {
+        if(phases[i] != 1)
+        {
+          DREAM3D_REQUIRE_EQUAL(colors[i * 3], 7)
+          DREAM3D_REQUIRE_EQUAL(colors[i * 3 + 1], 7)
+          DREAM3D_REQUIRE_EQUAL(colors[i * 3 + 2], 7)
+          continue;
+        }
+        SIMPL::Rgb argb = ops[o]->generateIPFColor(eulers[i * 3], eulers[i * 3 + 1], eulers[i * 3 + 2], refDir[0], refDir[1], refDir[2], false);
+        DREAM3D_REQUIRE(ColorsMatch(argb, colors.data() + i * 3))
+      }
+
+      // One reference direction per element
+      ops[o]->generateIPFColors(eulers.data(), refDirs.data(), count, false, colors.data());
+      for(size_t i = 0; i < count; i++)
+      {
+        SIMPL::Rgb argb = ops[o]->generateIPFColor(eulers[i * 3], eulers[i * 3 + 1], eulers[i * 3 + 2], refDirs[i * 3], refDirs[i * 3 + 1], refDirs[i * 3 + 2], false);
+        DREAM3D_REQUIRE(ColorsMatch(argb, colors.data() + i * 3))
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestDispatch()
+  {
+    const size_t count = 257;
+    std::vector<QuatF> q1 = GenerateRandomQuats(count, 42u);
+    std::vector<QuatF> q2 = GenerateRandomQuats(count, 4242u);
+
+    std::vector<LaueOps::Pointer> ops = LaueOps::getOrientationOpsVector();
+    for(uint32_t cs = 0; cs < Ebsd::CrystalStructure::LaueGroupEnd; cs++)
+    {
+      bool called = false;
+      bool dispatched = LaueOpsDispatch::Dispatch(cs, [&](auto& concreteOps) {
+        called = true;
+        DREAM3D_REQUIRE(concreteOps.getSymmetryName() == ops[cs]->getSymmetryName())
+        DREAM3D_REQUIRE_EQUAL(concreteOps.getNumSymOps(), ops[cs]->getNumSymOps())
+        for(size_t i = 0; i < count; i++)
+        {
+          float n1 = 0.0f, n2 = 0.0f, n3 = 0.0f;
+          QuatF qa = q1[i];
+          QuatF qb = q2[i];
+          float expected = ops[cs]->getMisoQuat(qa, qb, n1, n2, n3);
+          qa = q1[i];
+          qb = q2[i];
+          float w = concreteOps.getMisoQuat(qa, qb, n1, n2, n3);
+          DREAM3D_REQUIRE_EQUAL(w, expected)
+        }
+      });
+      DREAM3D_REQUIRE_EQUAL(dispatched, true)
+      DREAM3D_REQUIRE_EQUAL(called, true)
+    }
+
+    bool called = false;
+    bool dispatched = LaueOpsDispatch::Dispatch(Ebsd::CrystalStructure::UnknownCrystalStructure, [&](auto&) { called = true; });
+    DREAM3D_REQUIRE_EQUAL(dispatched, false)
+    DREAM3D_REQUIRE_EQUAL(called, false)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestFusedLambertProjection()
+  {
+    const size_t count = 5000;
+    const int lambertDim = 64;
+    std::mt19937 generator(1234u);
+    std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+    QVector<size_t> cDims(1, 3);
+    FloatArrayType::Pointer eulers = FloatArrayType::CreateArray(count, cDims, "Eulers");
+    for(size_t i = 0; i < count; i++)
+    {
+      eulers->setComponent(i, 0, distribution(generator) * SIMPLib::Constants::k_2Pi);
+      eulers->setComponent(i, 1, std::acos(2.0f * distribution(generator) - 1.0f));
+      eulers->setComponent(i, 2, distribution(generator) * SIMPLib::Constants::k_2Pi);
+    }
+
+    // Reference: materialize the <011> sphere coordinates and bin them
+    FloatArrayType::Pointer xyz001 = FloatArrayType::CreateArray(count * 6, cDims, "xyz001");
+    FloatArrayType::Pointer xyz011 = FloatArrayType::CreateArray(count * 12, cDims, "xyz011");
+    FloatArrayType::Pointer xyz111 = FloatArrayType::CreateArray(count * 8, cDims, "xyz111");
+    LaueOps::Pointer cubicOps = LaueOps::getOrientationOpsVector()[Ebsd::CrystalStructure::Cubic_High];
+    cubicOps->generateSphereCoordsFromEulers(eulers.get(), xyz001.get(), xyz011.get(), xyz111.get());
+    ModifiedLambertProjection::Pointer expected = ModifiedLambertProjection::LambertBallToSquare(xyz011.get(), lambertDim, 1.0f);
+
+    const float r2 = SIMPLib::Constants::k_1OverRoot2;
+    std::vector<float> directions011 = {r2, r2, 0.0f, r2, 0.0f, r2, 0.0f, r2, r2, -r2, r2, 0.0f, -r2, 0.0f, r2, 0.0f, -r2, r2};
+    ModifiedLambertProjection::Pointer fused = ModifiedLambertProjection::LambertEulersToSquare(eulers.get(), directions011, lambertDim, 1.0f);
+
+    DREAM3D_REQUIRE_EQUAL(fused->getDimension(), expected->getDimension())
+    double* eNorth = expected->getNorthSquare()->getPointer(0);
+    double* eSouth = expected->getSouthSquare()->getPointer(0);
+    double* fNorth = fused->getNorthSquare()->getPointer(0);
+    double* fSouth = fused->getSouthSquare()->getPointer(0);
+    double total = 0.0;
+    for(size_t i = 0; i < static_cast<size_t>(lambertDim * lambertDim); i++)
+    {
+      DREAM3D_REQUIRE(std::fabs(eNorth[i] - fNorth[i]) < 1.0E-6 * (1.0 + std::fabs(eNorth[i])))
+      DREAM3D_REQUIRE(std::fabs(eSouth[i] - fSouth[i]) < 1.0E-6 * (1.0 + std::fabs(eSouth[i])))
+      total += fNorth[i] + fSouth[i];
+    }
+    // Every point deposits a total weight of 1 across its 4 interpolation bins
+    DREAM3D_REQUIRE(std::fabs(total - static_cast<double>(count * 12)) < 1.0E-6 * total)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestDistributionAccumulator()
+  {
+    const size_t numBins = 200;
+    std::mt19937 generator(4321u);
+    std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+    std::uniform_int_distribution<int32_t> binDistribution(0, static_cast<int32_t>(numBins) - 1);
+
+    QVector<size_t> cDims(1, 1);
+    FloatArrayType::Pointer target = FloatArrayType::CreateArray(numBins, cDims, "Target");
+    for(size_t i = 0; i < numBins; i++)
+    {
+      target->setValue(i, distribution(generator));
+    }
+
+    DistributionAccumulator::Pointer accumulator = DistributionAccumulator::New(numBins);
+    DREAM3D_REQUIRE_EQUAL(accumulator->getNumberOfBins(), numBins)
+    DREAM3D_REQUIRE_EQUAL(accumulator->hasTarget(), false)
+    accumulator->setTarget(target);
+    DREAM3D_REQUIRE_EQUAL(accumulator->hasTarget(), true)
+
+    // Enough updates to go through several resynchronizations of the running error
+    for(size_t i = 0; i < numBins * 5; i++)
+    {
+      int32_t bin1 = binDistribution(generator);
+      int32_t bin2 = binDistribution(generator);
+      float weight = distribution(generator) * 0.1f;
+      double before = accumulator->getError();
+      double predicted = 0.0;
+      switch(i % 3)
+      {
+      case 0:
+        predicted = accumulator->getErrorChange(bin1, weight);
+        accumulator->addToBin(bin1, weight);
+        break;
+      case 1:
+        predicted = accumulator->getErrorChange(bin1, -weight);
+        accumulator->removeFromBin(bin1, weight);
+        break;
+      default:
+        predicted = accumulator->getErrorChange(bin1, -weight, bin2, weight);
+        accumulator->moveBetweenBins(bin1, bin2, weight);
+        break;
+      }
+      double actual = accumulator->getError() - before;
+      DREAM3D_REQUIRE(std::fabs(actual - predicted) < 1.0E-4 * (1.0 + before))
+    }
+
+    // Moving weight within a bin changes nothing
+    DREAM3D_REQUIRE_EQUAL(accumulator->getErrorChange(3, -0.5f, 3, 0.5f), 0.0)
+
+    double running = accumulator->getError();
+    accumulator->recomputeError();
+    DREAM3D_REQUIRE(std::fabs(running - accumulator->getError()) < 1.0E-4 * (1.0 + running))
+
+    double expected = 0.0;
+    for(size_t i = 0; i < numBins; i++)
+    {
+      double diff = static_cast<double>(target->getValue(i)) - accumulator->getValue(static_cast<int32_t>(i));
+      expected += diff * diff;
+    }
+    DREAM3D_REQUIRE(std::fabs(expected - accumulator->getError()) < 1.0E-6 * (1.0 + expected))
+
+    FloatArrayType::Pointer values = accumulator->toDataArray("Values");
+    DREAM3D_REQUIRE_EQUAL(values->getNumberOfTuples(), numBins)
+    DREAM3D_REQUIRE_EQUAL(values->getValue(7), accumulator->getValue(7))
+    accumulator->reset();
+    DREAM3D_REQUIRE_EQUAL(accumulator->getValue(7), 0.0f)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestOdfMdfAccumulators()
+  {
+    const size_t count = 5000;
+    std::mt19937 generator(2468u);
+    std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+    std::vector<float> eulers(count * 3);
+    std::vector<float> weights(count);
+    for(size_t i = 0; i < count; i++)
+    {
+      eulers[i * 3] = distribution(generator) * SIMPLib::Constants::k_2Pi;
+      eulers[i * 3 + 1] = distribution(generator) * SIMPLib::Constants::k_Pi;
+      eulers[i * 3 + 2] = distribution(generator) * SIMPLib::Constants::k_2Pi;
+      // Some zero weights to exercise the skipped tuples
+      weights[i] = (i % 7 == 0) ? 0.0f : distribution(generator);
+    }
+    std::vector<QuatF> q1 = GenerateRandomQuats(count, 13579u);
+    std::vector<QuatF> q2 = GenerateRandomQuats(count, 97531u);
+
+    std::vector<LaueOps::Pointer> ops = LaueOps::getOrientationOpsVector();
+    std::vector<size_t> laueClasses = {Ebsd::CrystalStructure::Cubic_High, Ebsd::CrystalStructure::Hexagonal_High};
+    for(size_t laue : laueClasses)
+    {
+      OdfAccumulator::Pointer serialOdf = OdfAccumulator::New(ops[laue]);
+      OdfAccumulator::Pointer batchOdf = OdfAccumulator::New(ops[laue]);
+      DREAM3D_REQUIRE_EQUAL(serialOdf->getNumberOfBins(), static_cast<size_t>(ops[laue]->getODFSize()))
+      for(size_t i = 0; i < count; i++)
+      {
+        if(weights[i] != 0.0f)
+        {
+          serialOdf->addEulers(eulers.data() + i * 3, weights[i]);
+        }
+      }
+      batchOdf->addEulers(eulers.data(), weights.data(), count);
+
+      MdfAccumulator::Pointer serialMdf = MdfAccumulator::New(ops[laue]);
+      MdfAccumulator::Pointer batchMdf = MdfAccumulator::New(ops[laue]);
+      DREAM3D_REQUIRE_EQUAL(serialMdf->getNumberOfBins(), static_cast<size_t>(ops[laue]->getMDFSize()))
+      for(size_t i = 0; i < count; i++)
+      {
+        serialMdf->addMisorientation(q1[i], q2[i], 1.0f);
+      }
+      batchMdf->addMisorientations(q1.data(), q2.data(), nullptr, count);
+
+      for(size_t i = 0; i < serialOdf->getNumberOfBins(); i++)
+      {
+        int32_t bin = static_cast<int32_t>(i);
+        DREAM3D_REQUIRE(std::fabs(serialOdf->getValue(bin) - batchOdf->getValue(bin)) < 1.0E-3f)
+      }
+      float mdfTotal = 0.0f;
+      for(size_t i = 0; i < serialMdf->getNumberOfBins(); i++)
+      {
+        int32_t bin = static_cast<int32_t>(i);
+        DREAM3D_REQUIRE_EQUAL(serialMdf->getValue(bin), batchMdf->getValue(bin))
+        mdfTotal += batchMdf->getValue(bin);
+      }
+      DREAM3D_REQUIRE_EQUAL(mdfTotal, static_cast<float>(count))
+
+      // Removing everything again leaves an empty ODF
+      for(size_t i = 0; i < count; i++)
+      {
+        if(weights[i] != 0.0f)
+        {
+          batchOdf->removeEulers(eulers.data() + i * 3, weights[i]);
+        }
+      }
+      for(size_t i = 0; i < batchOdf->getNumberOfBins(); i++)
+      {
+        DREAM3D_REQUIRE(std::fabs(batchOdf->getValue(static_cast<int32_t>(i))) < 1.0E-3f)
+      }
+    }
+  }
+
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+    DREAM3D_REGISTER_TEST(TestMisoQuatBatch())
+    DREAM3D_REGISTER_TEST(TestSymOpDotMisorientation())
+    DREAM3D_REGISTER_TEST(TestIPFColorBatch())
+    DREAM3D_REGISTER_TEST(TestDispatch())
+    DREAM3D_REGISTER_TEST(TestFusedLambertProjection())
+    DREAM3D_REGISTER_TEST(TestDistributionAccumulator())
+    DREAM3D_REGISTER_TEST(TestOdfMdfAccumulators())
+    DREAM3D_REGISTER_TEST(RemoveTestFiles())
+  }
+
+private:
+  LaueOpsTest(const LaueOpsTest&);    // Copy Constructor Not Implemented
+  void operator=(const LaueOpsTest&); // Move assignment Not Implemented
+};
@@ -32,6 +32,7 @@ using namespace SIMPLib::Constants;
 #include "OrientationLib/OrientationLib.h"
 #include "OrientationLib/OrientationMath/OrientationArray.hpp"
 #include "OrientationLib/OrientationMath/OrientationConverter.hpp"
+#include "OrientationLib/OrientationMath/OrientationFixedArray.hpp"
 #include "OrientationLib/OrientationMath/OrientationTransforms.hpp"
 
 #include "OrientationLib/Test/OrientationLibTestFileLocations.h"
@@ -563,6 +564,7 @@ public:
     GenRotTest<FOrientArrayType, float>(eu, omega);
     GenRotTest<FloatVectorType, float>(eu, omega);
     GenRotTest<FloatQVectorType, float>(eu, omega);
+    GenRotTest<FOrientFixedArrayType, float>(eu, omega);
   }
 
   // -----------------------------------------------------------------------------
@@ -684,6 +686,7 @@ ax2eu  eu2ax                                                     FAILED
       EU_2_XXX<OrientType, K>(eu);
       EU_2_XXX<VectorType, K>(eu);
       EU_2_XXX<QVectorType, K>(eu);
+      EU_2_XXX<OrientationFixedArray<K>, K>(eu);
     }
   }
 
@@ -752,6 +755,7 @@ Orientation Matrix               : | -1.0000   0.0000   0.0000 |
     OM_2_XXX<FOrientArrayType>(om);
     OM_2_XXX<FloatVectorType>(om);
     OM_2_XXX<FloatQVectorType>(om);
+    OM_2_XXX<FOrientFixedArrayType>(om);
   }
 
   // -----------------------------------------------------------------------------
@@ -810,6 +814,7 @@ Orientation Matrix               : | -1.0000   0.0000   0.0000 |
     RO_2_XXX<FOrientArrayType>(ro);
     RO_2_XXX<FloatVectorType>(ro);
     RO_2_XXX<FloatQVectorType>(ro);
+    RO_2_XXX<FOrientFixedArrayType>(ro);
   }
 
   // -----------------------------------------------------------------------------
@@ -861,6 +866,7 @@ Orientation Matrix               : | -1.0000   0.0000   0.0000 |
     AX_2_XXX<FOrientArrayType>(ax);
     AX_2_XXX<std::vector<float>>(ax);
     AX_2_XXX<FloatQVectorType>(ax);
+    AX_2_XXX<FOrientFixedArrayType>(ax);
   }
 
   // -----------------------------------------------------------------------------
@@ -984,6 +990,7 @@ Orientation Matrix               : | -1.0000   0.0000   0.0000 |
     HO_2_XXX<FOrientArrayType>(ho);
     HO_2_XXX<std::vector<float>>(ho);
     HO_2_XXX<FloatQVectorType>(ho);
+    HO_2_XXX<FOrientFixedArrayType>(ho);
   }
 
   // -----------------------------------------------------------------------------
@@ -1045,6 +1052,63 @@ Orientation Matrix               : | -1.0000   0.0000   0.0000 |
     }
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestFixedArrayMatchesOrientationArray()
+  {
+    typedef OrientationTransforms<FOrientArrayType, float> HeapTransformType;
+    typedef OrientationTransforms<FOrientFixedArrayType, float> FixedTransformType;
+
+    float eulers[4][3] = {{0.3926990816987242f, 0.0f, 0.0f}, {1.0f, 0.4f, 0.9f}, {5.1f, 2.9f, 0.2f}, {3.0f, 1.57f, 6.0f}};
+    for(size_t e = 0; e < 4; e++)
+    {
+      FOrientArrayType euHeap(eulers[e][0], eulers[e][1], eulers[e][2]);
+      FOrientFixedArrayType euFixed(eulers[e][0], eulers[e][1], eulers[e][2]);
+
+      FOrientArrayType quHeap(4), omHeap(9), roHeap(4), cuHeap(3), resHeap(3);
+      FOrientFixedArrayType quFixed(4), omFixed(9), roFixed(4), cuFixed(3), resFixed(3);
+
+      HeapTransformType::eu2qu(euHeap, quHeap);
+      FixedTransformType::eu2qu(euFixed, quFixed);
+      HeapTransformType::qu2om(quHeap, omHeap);
+      FixedTransformType::qu2om(quFixed, omFixed);
+      HeapTransformType::om2ro(omHeap, roHeap);
+      FixedTransformType::om2ro(omFixed, roFixed);
+      HeapTransformType::ro2cu(roHeap, cuHeap);
+      FixedTransformType::ro2cu(roFixed, cuFixed);
+      HeapTransformType::cu2eu(cuHeap, resHeap);
+      FixedTransformType::cu2eu(cuFixed, resFixed);
+
+      DREAM3D_REQUIRE_EQUAL(quFixed.size(), 4)
+      DREAM3D_REQUIRE_EQUAL(omFixed.size(), 9)
+      DREAM3D_REQUIRE_EQUAL(resFixed.size(), 3)
+      for(size_t i = 0; i < 4; i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(quFixed[i], quHeap[i])
+      }
+      for(size_t i = 0; i < 9; i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(omFixed[i], omHeap[i])
+      }
+      for(size_t i = 0; i < 3; i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(cuFixed[i], cuHeap[i])
+        DREAM3D_REQUIRE_EQUAL(resFixed[i], resHeap[i])
+      }
+    }
+
+    // Copies are deep and resizing stays within the inline storage
+    FOrientFixedArrayType a(1.0f, 2.0f, 3.0f);
+    FOrientFixedArrayType b = a;
+    b[0] = 10.0f;
+    DREAM3D_REQUIRE_EQUAL(a[0], 1.0f)
+    b.resize(9);
+    DREAM3D_REQUIRE_EQUAL(b.size(), 9)
+    DREAM3D_REQUIRE_EQUAL(b[2], 3.0f)
+    DREAM3D_REQUIRE_EQUAL(b[8], 0.0f)
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -1114,6 +1178,7 @@ Orientation Matrix               : | -1.0000   0.0000   0.0000 |
     DREAM3D_REGISTER_TEST(Test_ho2_XXX());
 
     DREAM3D_REGISTER_TEST(TestInputs());
+    DREAM3D_REGISTER_TEST(TestFixedArrayMatchesOrientationArray());
   }
 
 private:
@@ -33,8 +33,12 @@
  *
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <limits>
+#include <random>
+#include <vector>
 
 #include <QtCore/QCoreApplication>
 #include <QtCore/QString>
@@ -52,6 +56,7 @@
 #include "OrientationLib/OrientationMath/OrientationArray.hpp"
 #include "OrientationLib/OrientationMath/OrientationConverter.hpp"
 #include "OrientationLib/OrientationMath/OrientationTransforms.hpp"
+#include "OrientationLib/OrientationMath/OrientationTransformsBatch.hpp"
 
 #include "GenerateFunctionList.h"
 #include "OrientationLibTestFileLocations.h"
@@ -651,12 +656,183 @@ public:
     }
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename K> bool CloseAngle(K a, K b, K tol)
+  {
+    K diff = std::fabs(a - b);
+    // Angles that land right at the wrap point may come out as 0 in one path and 2pi in the other
+    diff = std::min(diff, static_cast<K>(std::fabs(diff - SIMPLib::Constants::k_2Pi)));
+    return diff < tol;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename K, typename ScalarFunc> void CompareBatch(const std::vector<K>& input, size_t inStride, const std::vector<K>& batch, size_t outStride, ScalarFunc scalar, K tol, bool angles)
+  {
+    using FixedArray_t = OrientationFixedArray<K>;
+    size_t count = input.size() / inStride;
+    DREAM3D_REQUIRE_EQUAL(batch.size(), count * outStride)
+    for(size_t i = 0; i < count; i++)
+    {
+      FixedArray_t in(inStride);
+      FixedArray_t out(outStride);
+      for(size_t c = 0; c < inStride; c++)
+      {
+        in[c] = input[i * inStride + c];
+      }
+      scalar(in, out);
+      for(size_t c = 0; c < outStride; c++)
+      {
+        if(angles)
+        {
+          DREAM3D_REQUIRE(CloseAngle<K>(out[c], batch[i * outStride + c], tol))
+        }
+        else
+        {
+          DREAM3D_REQUIRE(std::fabs(out[c] - batch[i * outStride + c]) < tol)
+        }
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename K> void TestBatchTransforms(K tol)
+  {
+    using Transforms_t = OrientationTransforms<OrientationFixedArray<K>, K>;
+    using Batch_t = OrientationTransformsBatch<K>;
+
+    // Not a multiple of the block size so the partial block is exercised
+    const size_t count = 1000 + 7;
+    std::mt19937 generator(5489u);
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+    std::vector<K> eu(count * 3);
+    for(size_t i = 0; i < count; i++)
+    {
+      eu[i * 3] = static_cast<K>(distribution(generator) * SIMPLib::Constants::k_2Pi);
+      eu[i * 3 + 1] = static_cast<K>(distribution(generator) * SIMPLib::Constants::k_Pi);
+      eu[i * 3 + 2] = static_cast<K>(distribution(generator) * SIMPLib::Constants::k_2Pi);
+    }
+    // Degenerate cases: identity, rotation about Z only, and Phi = pi
+    eu[0] = 0.0;
+    eu[1] = 0.0;
+    eu[2] = 0.0;
+    eu[3] = 1.0;
+    eu[4] = 0.0;
+    eu[5] = 0.0;
+    eu[6] = 0.5;
+    eu[7] = static_cast<K>(SIMPLib::Constants::k_Pi);
+    eu[8] = 0.0;
+
+    std::vector<K> qu(count * 4);
+    Batch_t::eu2qu(eu.data(), qu.data(), count);
+    CompareBatch<K>(eu, 3, qu, 4, [](const OrientationFixedArray<K>& in, OrientationFixedArray<K>& out) { Transforms_t::eu2qu(in, out); }, tol, false);
+
+    std::vector<K> euBack(count * 3);
+    Batch_t::qu2eu(qu.data(), euBack.data(), count);
+    CompareBatch<K>(qu, 4, euBack, 3, [](const OrientationFixedArray<K>& in, OrientationFixedArray<K>& out) { Transforms_t::qu2eu(in, out); }, tol, true);
+
+    std::vector<K> om(count * 9);
+    Batch_t::qu2om(qu.data(), om.data(), count);
+    CompareBatch<K>(qu, 4, om, 9, [](const OrientationFixedArray<K>& in, OrientationFixedArray<K>& out) { Transforms_t::qu2om(in, out); }, tol, false);
+
+    // Half turns, where the signs cannot be read off the off-diagonal differences
+    const K halfTurnAxes[4][3] = {{1.0, 0.0, 0.0}, {0.0, 0.6, 0.8}, {-0.48, 0.6, 0.64}, {0.0, 0.0, -1.0}};
+    for(size_t a = 0; a < 4; a++)
+    {
+      OrientationFixedArray<K> ax(halfTurnAxes[a][0], halfTurnAxes[a][1], halfTurnAxes[a][2], static_cast<K>(SIMPLib::Constants::k_Pi));
+      OrientationFixedArray<K> o(9);
+      Transforms_t::ax2om(ax, o);
+      for(size_t c = 0; c < 9; c++)
+      {
+        om[(10 + a) * 9 + c] = o[c];
+      }
+    }
+
+    std::vector<K> quBack(count * 4);
+    Batch_t::om2qu(om.data(), quBack.data(), count);
+    CompareBatch<K>(om, 9, quBack, 4, [](const OrientationFixedArray<K>& in, OrientationFixedArray<K>& out) { Transforms_t::om2qu(in, out); }, tol, false);
+
+    std::vector<K> ro(count * 4);
+    std::vector<K> ho(count * 3);
+    for(size_t i = 0; i < count; i++)
+    {
+      OrientationFixedArray<K> q(qu[i * 4], qu[i * 4 + 1], qu[i * 4 + 2], qu[i * 4 + 3]);
+      OrientationFixedArray<K> r(4);
+      OrientationFixedArray<K> h(3);
+      Transforms_t::qu2ro(q, r);
+      Transforms_t::qu2ho(q, h);
+      for(size_t c = 0; c < 4; c++)
+      {
+        ro[i * 4 + c] = r[c];
+      }
+      for(size_t c = 0; c < 3; c++)
+      {
+        ho[i * 3 + c] = h[c];
+      }
+    }
+    // Half turn
+    ro[4 * 4] = 1.0;
+    ro[4 * 4 + 1] = 0.0;
+    ro[4 * 4 + 2] = 0.0;
+    ro[4 * 4 + 3] = std::numeric_limits<K>::infinity();
+
+    Batch_t::ro2qu(ro.data(), quBack.data(), count);
+    CompareBatch<K>(ro, 4, quBack, 4, [](const OrientationFixedArray<K>& in, OrientationFixedArray<K>& out) { Transforms_t::ro2qu(in, out); }, tol, false);
+
+    std::vector<K> cu(count * 3);
+    Batch_t::ho2cu(ho.data(), cu.data(), count);
+    CompareBatch<K>(ho, 3, cu, 3, [](const OrientationFixedArray<K>& in, OrientationFixedArray<K>& out) { Transforms_t::ho2cu(in, out); }, tol, false);
+
+    std::vector<K> hoBack(count * 3);
+    Batch_t::cu2ho(cu.data(), hoBack.data(), count);
+    CompareBatch<K>(cu, 3, hoBack, 3, [](const OrientationFixedArray<K>& in, OrientationFixedArray<K>& out) { Transforms_t::cu2ho(in, out); }, tol, false);
+
+    // Strided input: Euler angles interleaved with a 4th component
+    std::vector<K> euPadded(count * 4, static_cast<K>(-1.0));
+    for(size_t i = 0; i < count; i++)
+    {
+      euPadded[i * 4] = eu[i * 3];
+      euPadded[i * 4 + 1] = eu[i * 3 + 1];
+      euPadded[i * 4 + 2] = eu[i * 3 + 2];
+    }
+    std::vector<K> quStrided(count * 4);
+    Batch_t::eu2qu(euPadded.data(), quStrided.data(), count, 4, 4);
+    for(size_t i = 0; i < quStrided.size(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(quStrided[i], qu[i])
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestBatchTransformsFloat()
+  {
+    TestBatchTransforms<float>(1.0E-4f);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestBatchTransformsDouble()
+  {
+    TestBatchTransforms<double>(1.0E-9);
+  }
+
   void operator()()
   {
     int err = EXIT_SUCCESS;
 
     StartTest();
 
+    DREAM3D_REGISTER_TEST(TestBatchTransformsFloat());
+    DREAM3D_REGISTER_TEST(TestBatchTransformsDouble());
     DREAM3D_REGISTER_TEST(RemoveTestFiles());
   }
 
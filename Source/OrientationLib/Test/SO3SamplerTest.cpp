@@ -30,6 +30,8 @@
  *
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
+#include <vector>
+
 #include "SIMPLib/Math/SIMPLibMath.h"
 #include "SIMPLib/SIMPLib.h"
 #include "UnitTestSupport.hpp"
@@ -75,6 +77,52 @@ public:
     DREAM3D_REQUIRE_EQUAL(333227, orientations.size());
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void SO3ContiguousTest()
+  {
+    SO3Sampler::Pointer sampler = SO3Sampler::New();
+    // Octahedral, dihedral, cyclic and triclinic fundamental zones
+    int pointGroups[4] = {32, 15, 9, 1};
+    for(int p = 0; p < 4; p++)
+    {
+      SO3Sampler::OrientationListArrayType orientations = sampler->SampleRFZ(10, pointGroups[p]);
+
+      size_t count = sampler->CountRFZ(10, pointGroups[p]);
+      DREAM3D_REQUIRE_EQUAL(count, orientations.size());
+
+      std::vector<double> rods;
+      count = sampler->SampleRFZ(10, pointGroups[p], rods);
+      DREAM3D_REQUIRE_EQUAL(count, orientations.size());
+      DREAM3D_REQUIRE_EQUAL(rods.size(), count * 4);
+
+      std::vector<double> streamed;
+      size_t numBatches = 0;
+      count = sampler->SampleRFZ(10, pointGroups[p], [&](const double* batch, size_t batchCount) {
+        streamed.insert(streamed.end(), batch, batch + batchCount * 4);
+        numBatches++;
+      });
+      DREAM3D_REQUIRE_EQUAL(count, orientations.size());
+      DREAM3D_REQUIRE(numBatches > 0)
+      DREAM3D_REQUIRE(streamed == rods)
+
+      // Same points in the same order as the list based sampler
+      size_t i = 0;
+      for(const DOrientArrayType& rod : orientations)
+      {
+        for(size_t c = 0; c < 4; c++)
+        {
+          DREAM3D_REQUIRE_EQUAL(rods[i * 4 + c], rod[c])
+        }
+        i++;
+      }
+    }
+
+    size_t count = sampler->CountRFZ(100, 32);
+    DREAM3D_REQUIRE_EQUAL(333227, count);
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -133,6 +181,7 @@ public:
     DREAM3D_REGISTER_TEST(InsideCubicFZTest())
     DREAM3D_REGISTER_TEST(TestPyramid())
     DREAM3D_REGISTER_TEST(SO3CountTest())
+    DREAM3D_REGISTER_TEST(SO3ContiguousTest())
     DREAM3D_REGISTER_TEST(RemoveTestFiles())
   }
 
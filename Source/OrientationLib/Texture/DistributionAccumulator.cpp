@@ -0,0 +1,329 @@
+/* ============================================================================
+ * Copyright (c) 2015 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "DistributionAccumulator.h"
+
+#include <algorithm>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_reduce.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
+
+namespace
+{
+// -----------------------------------------------------------------------------
+// Fills a private histogram; used as a tbb::parallel_reduce body so the
+// per-thread histograms are only summed once at the end.
+// -----------------------------------------------------------------------------
+class BinningImpl
+{
+    const std::function<int32_t(size_t)>* m_BinFunc = nullptr;
+    const float* m_Weights = nullptr;
+
+  public:
+    std::vector<float> m_Bins;
+
+    BinningImpl(const std::function<int32_t(size_t)>* binFunc, const float* weights, size_t numBins)
+    : m_BinFunc(binFunc)
+    , m_Weights(weights)
+    , m_Bins(numBins, 0.0f)
+    {
+    }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    BinningImpl(BinningImpl& other, tbb::split)
+    : m_BinFunc(other.m_BinFunc)
+    , m_Weights(other.m_Weights)
+    , m_Bins(other.m_Bins.size(), 0.0f)
+    {
+    }
+#endif
+
+    void accumulate(size_t start, size_t end)
+    {
+      for(size_t i = start; i < end; i++)
+      {
+        float weight = (nullptr == m_Weights) ? 1.0f : m_Weights[i];
+        if(weight == 0.0f)
+        {
+          continue;
+        }
+        m_Bins[(*m_BinFunc)(i)] += weight;
+      }
+    }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    void operator()(const tbb::blocked_range<size_t>& r)
+    {
+      accumulate(r.begin(), r.end());
+    }
+#endif
+
+    void join(const BinningImpl& rhs)
+    {
+      for(size_t i = 0; i < m_Bins.size(); i++)
+      {
+        m_Bins[i] += rhs.m_Bins[i];
+      }
+    }
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DistributionAccumulator::DistributionAccumulator(size_t numBins)
+: m_Values(numBins, 0.0f)
+, m_Target(numBins, 0.0f)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DistributionAccumulator::~DistributionAccumulator() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t DistributionAccumulator::getNumberOfBins() const
+{
+  return m_Values.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DistributionAccumulator::reset()
+{
+  std::fill(m_Values.begin(), m_Values.end(), 0.0f);
+  recomputeError();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+float DistributionAccumulator::getValue(int32_t bin) const
+{
+  return m_Values[bin];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const std::vector<float>& DistributionAccumulator::getValues() const
+{
+  return m_Values;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DistributionAccumulator::applyDelta(int32_t bin, float delta)
+{
+  m_Error += getErrorChange(bin, delta);
+  m_Values[bin] += delta;
+  m_UpdatesSinceResync++;
+  if(m_UpdatesSinceResync >= m_Values.size())
+  {
+    recomputeError();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DistributionAccumulator::addToBin(int32_t bin, float weight)
+{
+  applyDelta(bin, weight);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DistributionAccumulator::removeFromBin(int32_t bin, float weight)
+{
+  applyDelta(bin, -weight);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DistributionAccumulator::moveBetweenBins(int32_t fromBin, int32_t toBin, float weight)
+{
+  if(fromBin == toBin)
+  {
+    return;
+  }
+  applyDelta(fromBin, -weight);
+  applyDelta(toBin, weight);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DistributionAccumulator::merge(const DistributionAccumulator& other)
+{
+  mergeRaw(other.m_Values.data());
+  recomputeError();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DistributionAccumulator::addBinned(size_t count, const std::function<int32_t(size_t)>& binFunc, const float* weights)
+{
+  BinningImpl impl(&binFunc, weights, m_Values.size());
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+  if(doParallel)
+  {
+    tbb::parallel_reduce(tbb::blocked_range<size_t>(0, count), impl, tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    impl.accumulate(0, count);
+  }
+
+  mergeRaw(impl.m_Bins.data());
+  recomputeError();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DistributionAccumulator::mergeRaw(const float* values)
+{
+  size_t numBins = m_Values.size();
+  for(size_t i = 0; i < numBins; i++)
+  {
+    m_Values[i] += values[i];
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DistributionAccumulator::scale(float factor)
+{
+  for(auto& value : m_Values)
+  {
+    value *= factor;
+  }
+  recomputeError();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DistributionAccumulator::setTarget(FloatArrayType::Pointer target)
+{
+  std::fill(m_Target.begin(), m_Target.end(), 0.0f);
+  if(nullptr != target.get())
+  {
+    size_t count = std::min(m_Target.size(), target->getSize());
+    std::copy(target->getPointer(0), target->getPointer(0) + count, m_Target.begin());
+  }
+  m_HasTarget = (nullptr != target.get());
+  recomputeError();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool DistributionAccumulator::hasTarget() const
+{
+  return m_HasTarget;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double DistributionAccumulator::getError() const
+{
+  return m_Error;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double DistributionAccumulator::getErrorChange(int32_t bin, float delta) const
+{
+  // (t - v - d)^2 - (t - v)^2 = d * (d - 2 * (t - v))
+  double diff = static_cast<double>(m_Target[bin]) - static_cast<double>(m_Values[bin]);
+  double d = static_cast<double>(delta);
+  return d * (d - 2.0 * diff);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double DistributionAccumulator::getErrorChange(int32_t bin1, float delta1, int32_t bin2, float delta2) const
+{
+  if(bin1 == bin2)
+  {
+    return getErrorChange(bin1, delta1 + delta2);
+  }
+  return getErrorChange(bin1, delta1) + getErrorChange(bin2, delta2);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DistributionAccumulator::recomputeError()
+{
+  double error = 0.0;
+  size_t numBins = m_Values.size();
+  for(size_t i = 0; i < numBins; i++)
+  {
+    double diff = static_cast<double>(m_Target[i]) - static_cast<double>(m_Values[i]);
+    error += diff * diff;
+  }
+  m_Error = error;
+  m_UpdatesSinceResync = 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FloatArrayType::Pointer DistributionAccumulator::toDataArray(const QString& name) const
+{
+  FloatArrayType::Pointer data = FloatArrayType::CreateArray(m_Values.size(), name);
+  std::copy(m_Values.begin(), m_Values.end(), data->getPointer(0));
+  return data;
+}
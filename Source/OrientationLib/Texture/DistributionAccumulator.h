@@ -0,0 +1,208 @@
+/* ============================================================================
+ * Copyright (c) 2015 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+
+#include "OrientationLib/OrientationLib.h"
+
+/**
+ * @brief The DistributionAccumulator class holds a binned orientation distribution (ODF, MDF)
+ * together with an optional target distribution and keeps the squared error between the two
+ * up to date as values are added and removed.
+ *
+ * Every single bin update changes the error by a closed form amount, so getError() and the
+ * trial getErrorChange() queries are O(1) instead of a walk over all bins. The running error is
+ * resynchronized with a full pass once as many updates as there are bins have been applied, which
+ * keeps accumulated rounding bounded at O(1) amortized cost.
+ *
+ * OdfAccumulator and MdfAccumulator add the binning of orientations and misorientations on top.
+ */
+class OrientationLib_EXPORT DistributionAccumulator
+{
+  public:
+    SIMPL_SHARED_POINTERS(DistributionAccumulator)
+    SIMPL_TYPE_MACRO(DistributionAccumulator)
+
+    static Pointer New(size_t numBins)
+    {
+      Pointer sharedPtr(new DistributionAccumulator(numBins));
+      return sharedPtr;
+    }
+
+    virtual ~DistributionAccumulator();
+
+    /**
+     * @brief getNumberOfBins
+     * @return
+     */
+    size_t getNumberOfBins() const;
+
+    /**
+     * @brief reset Sets every bin back to zero. The target is kept.
+     */
+    void reset();
+
+    /**
+     * @brief getValue Returns the current value of a bin
+     * @param bin
+     * @return
+     */
+    float getValue(int32_t bin) const;
+
+    /**
+     * @brief getValues Returns all bins
+     * @return
+     */
+    const std::vector<float>& getValues() const;
+
+    /**
+     * @brief addToBin Adds weight to a bin and updates the error
+     * @param bin
+     * @param weight
+     */
+    void addToBin(int32_t bin, float weight);
+
+    /**
+     * @brief removeFromBin Removes weight from a bin and updates the error
+     * @param bin
+     * @param weight
+     */
+    void removeFromBin(int32_t bin, float weight);
+
+    /**
+     * @brief moveBetweenBins Moves weight from one bin to another, as when the orientation of a
+     * feature is swapped during Monte Carlo matching.
+     * @param fromBin
+     * @param toBin
+     * @param weight
+     */
+    void moveBetweenBins(int32_t fromBin, int32_t toBin, float weight);
+
+    /**
+     * @brief merge Adds the bins of another accumulator with the same number of bins
+     * @param other
+     */
+    void merge(const DistributionAccumulator& other);
+
+    /**
+     * @brief scale Multiplies every bin by factor, e.g. to normalize a histogram of raw weights
+     * @param factor
+     */
+    void scale(float factor);
+
+    /**
+     * @brief setTarget Copies the distribution the error is measured against. It must have
+     * getNumberOfBins() values; extra values are ignored and missing ones count as zero.
+     * @param target
+     */
+    void setTarget(FloatArrayType::Pointer target);
+
+    /**
+     * @brief hasTarget
+     * @return
+     */
+    bool hasTarget() const;
+
+    /**
+     * @brief getError Returns the sum over all bins of (target - value)^2
+     * @return
+     */
+    double getError() const;
+
+    /**
+     * @brief getErrorChange Returns how much getError() would change if delta were added to
+     * bin, without changing anything. Negative values mean the distribution gets closer to the target.
+     * @param bin
+     * @param delta
+     * @return
+     */
+    double getErrorChange(int32_t bin, float delta) const;
+
+    /**
+     * @brief getErrorChange Returns how much getError() would change if delta1 were added to
+     * bin1 and delta2 to bin2. bin1 and bin2 may be the same bin.
+     * @return
+     */
+    double getErrorChange(int32_t bin1, float delta1, int32_t bin2, float delta2) const;
+
+    /**
+     * @brief recomputeError Recomputes the error with a full pass over the bins
+     */
+    void recomputeError();
+
+    /**
+     * @brief toDataArray Copies the bins into a new array, in the layout the StatsData classes expect
+     * @param name
+     * @return
+     */
+    FloatArrayType::Pointer toDataArray(const QString& name) const;
+
+  protected:
+    DistributionAccumulator(size_t numBins);
+
+    /**
+     * @brief addBinned Adds weights[i] to bin binFunc(i) for every i in [0, count) in parallel.
+     * Each thread fills a private histogram, the histograms are merged once and the error is
+     * recomputed. binFunc must be safe to call concurrently.
+     * @param count
+     * @param binFunc Returns the bin of item i
+     * @param weights Pointer to count weights. Items with a zero weight are skipped. If nullptr every item has weight 1.
+     */
+    void addBinned(size_t count, const std::function<int32_t(size_t)>& binFunc, const float* weights);
+
+    /**
+     * @brief mergeRaw Adds raw bin values without resynchronizing the error
+     * @param values Pointer to getNumberOfBins() values
+     */
+    void mergeRaw(const float* values);
+
+  private:
+    std::vector<float> m_Values;
+    std::vector<float> m_Target;
+    bool m_HasTarget = false;
+    double m_Error = 0.0;
+    size_t m_UpdatesSinceResync = 0;
+
+    void applyDelta(int32_t bin, float delta);
+
+  public:
+    DistributionAccumulator(const DistributionAccumulator&) = delete; // Copy Constructor Not Implemented
+    DistributionAccumulator(DistributionAccumulator&&) = delete;      // Move Constructor Not Implemented
+    DistributionAccumulator& operator=(const DistributionAccumulator&) = delete; // Copy Assignment Not Implemented
+    DistributionAccumulator& operator=(DistributionAccumulator&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,104 @@
+/* ============================================================================
+ * Copyright (c) 2015 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "MdfAccumulator.h"
+
+#include "OrientationLib/OrientationMath/OrientationTransforms.hpp"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+MdfAccumulator::MdfAccumulator(LaueOps::Pointer ops)
+: DistributionAccumulator(static_cast<size_t>(ops->getMDFSize()))
+, m_Ops(ops)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+MdfAccumulator::~MdfAccumulator() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t MdfAccumulator::getBin(const QuatF& q1, const QuatF& q2) const
+{
+  // getMisoQuat takes its arguments by reference so work on copies
+  QuatF qa = q1;
+  QuatF qb = q2;
+  float n1 = 0.0f, n2 = 0.0f, n3 = 0.0f;
+  float w = m_Ops->getMisoQuat(qa, qb, n1, n2, n3);
+  FOrientArrayType rod(4);
+  FOrientTransformsType::ax2ro(FOrientArrayType(n1, n2, n3, w), rod);
+  return m_Ops->getMisoBin(rod);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t MdfAccumulator::getBin(const FOrientArrayType& rod) const
+{
+  return m_Ops->getMisoBin(rod);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void MdfAccumulator::addMisorientation(const QuatF& q1, const QuatF& q2, float weight)
+{
+  addToBin(getBin(q1, q2), weight);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void MdfAccumulator::removeMisorientation(const QuatF& q1, const QuatF& q2, float weight)
+{
+  removeFromBin(getBin(q1, q2), weight);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void MdfAccumulator::addMisorientations(const QuatF* q1, const QuatF* q2, const float* weights, size_t count)
+{
+  addBinned(count, [this, q1, q2](size_t i) { return getBin(q1[i], q2[i]); }, weights);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+LaueOps::Pointer MdfAccumulator::getLaueOps() const
+{
+  return m_Ops;
+}
@@ -0,0 +1,123 @@
+/* ============================================================================
+ * Copyright (c) 2015 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#pragma once
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/Math/QuaternionMath.hpp"
+
+#include "OrientationLib/OrientationLib.h"
+#include "OrientationLib/LaueOps/LaueOps.h"
+#include "OrientationLib/Texture/DistributionAccumulator.h"
+
+/**
+ * @brief The MdfAccumulator class bins misorientations into the MDF of one Laue class
+ * (LaueOps::getMisoBin) and tracks the error against a target MDF. See DistributionAccumulator.
+ */
+class OrientationLib_EXPORT MdfAccumulator : public DistributionAccumulator
+{
+  public:
+    SIMPL_SHARED_POINTERS(MdfAccumulator)
+    SIMPL_TYPE_MACRO_SUPER(MdfAccumulator, DistributionAccumulator)
+
+    /**
+     * @brief New Creates an empty MDF with LaueOps::getMDFSize() bins
+     * @param ops The symmetry operations of the Laue class
+     * @return
+     */
+    static Pointer New(LaueOps::Pointer ops)
+    {
+      Pointer sharedPtr(new MdfAccumulator(ops));
+      return sharedPtr;
+    }
+
+    ~MdfAccumulator() override;
+
+    /**
+     * @brief getBin Returns the MDF bin of the misorientation between two orientations
+     * @param q1
+     * @param q2
+     * @return
+     */
+    int32_t getBin(const QuatF& q1, const QuatF& q2) const;
+
+    /**
+     * @brief getBin Returns the MDF bin of a misorientation given in Rodrigues form
+     * @param rod
+     * @return
+     */
+    int32_t getBin(const FOrientArrayType& rod) const;
+
+    /**
+     * @brief addMisorientation Adds weight to the bin of the misorientation between q1 and q2
+     * @param q1
+     * @param q2
+     * @param weight
+     */
+    void addMisorientation(const QuatF& q1, const QuatF& q2, float weight);
+
+    /**
+     * @brief removeMisorientation Removes weight from the bin of the misorientation between q1 and q2
+     * @param q1
+     * @param q2
+     * @param weight
+     */
+    void removeMisorientation(const QuatF& q1, const QuatF& q2, float weight);
+
+    /**
+     * @brief addMisorientations Bins count pairs in parallel. Each thread fills a private
+     * histogram and the histograms are merged at the end.
+     * @param q1 Pointer to count orientations
+     * @param q2 Pointer to count orientations
+     * @param weights Pointer to count weights. Pairs with a zero weight are skipped. If nullptr every pair has weight 1.
+     * @param count
+     */
+    void addMisorientations(const QuatF* q1, const QuatF* q2, const float* weights, size_t count);
+
+    /**
+     * @brief getLaueOps
+     * @return
+     */
+    LaueOps::Pointer getLaueOps() const;
+
+  protected:
+    MdfAccumulator(LaueOps::Pointer ops);
+
+  private:
+    LaueOps::Pointer m_Ops;
+
+  public:
+    MdfAccumulator(const MdfAccumulator&) = delete; // Copy Constructor Not Implemented
+    MdfAccumulator(MdfAccumulator&&) = delete;      // Move Constructor Not Implemented
+    MdfAccumulator& operator=(const MdfAccumulator&) = delete; // Copy Assignment Not Implemented
+    MdfAccumulator& operator=(MdfAccumulator&&) = delete;      // Move Assignment Not Implemented
+};
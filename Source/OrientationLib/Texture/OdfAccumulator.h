@@ -0,0 +1,111 @@
+/* ============================================================================
+ * Copyright (c) 2015 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#pragma once
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+
+#include "OrientationLib/OrientationLib.h"
+#include "OrientationLib/LaueOps/LaueOps.h"
+#include "OrientationLib/Texture/DistributionAccumulator.h"
+
+/**
+ * @brief The OdfAccumulator class bins Euler angles into the ODF of one Laue class
+ * (LaueOps::getOdfBin) and tracks the error against a target ODF. See DistributionAccumulator.
+ */
+class OrientationLib_EXPORT OdfAccumulator : public DistributionAccumulator
+{
+  public:
+    SIMPL_SHARED_POINTERS(OdfAccumulator)
+    SIMPL_TYPE_MACRO_SUPER(OdfAccumulator, DistributionAccumulator)
+
+    /**
+     * @brief New Creates an empty ODF with LaueOps::getODFSize() bins
+     * @param ops The symmetry operations of the Laue class
+     * @return
+     */
+    static Pointer New(LaueOps::Pointer ops)
+    {
+      Pointer sharedPtr(new OdfAccumulator(ops));
+      return sharedPtr;
+    }
+
+    ~OdfAccumulator() override;
+
+    /**
+     * @brief getBin Returns the ODF bin of a set of Euler angles
+     * @param eulers Pointer to 3 Euler angles
+     * @return
+     */
+    int32_t getBin(const float* eulers) const;
+
+    /**
+     * @brief addEulers Adds weight to the bin of a set of Euler angles
+     * @param eulers Pointer to 3 Euler angles
+     * @param weight
+     */
+    void addEulers(const float* eulers, float weight);
+
+    /**
+     * @brief removeEulers Removes weight from the bin of a set of Euler angles
+     * @param eulers Pointer to 3 Euler angles
+     * @param weight
+     */
+    void removeEulers(const float* eulers, float weight);
+
+    /**
+     * @brief addEulers Bins count sets of Euler angles in parallel. Each thread fills a private
+     * histogram and the histograms are merged at the end.
+     * @param eulers Pointer to 3 * count Euler angles
+     * @param weights Pointer to count weights. Tuples with a zero weight are skipped. If nullptr every tuple has weight 1.
+     * @param count
+     */
+    void addEulers(const float* eulers, const float* weights, size_t count);
+
+    /**
+     * @brief getLaueOps
+     * @return
+     */
+    LaueOps::Pointer getLaueOps() const;
+
+  protected:
+    OdfAccumulator(LaueOps::Pointer ops);
+
+  private:
+    LaueOps::Pointer m_Ops;
+
+  public:
+    OdfAccumulator(const OdfAccumulator&) = delete; // Copy Constructor Not Implemented
+    OdfAccumulator(OdfAccumulator&&) = delete;      // Move Constructor Not Implemented
+    OdfAccumulator& operator=(const OdfAccumulator&) = delete; // Copy Assignment Not Implemented
+    OdfAccumulator& operator=(OdfAccumulator&&) = delete;      // Move Assignment Not Implemented
+};
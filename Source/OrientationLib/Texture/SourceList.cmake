@@ -34,12 +34,18 @@
 # ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
 set(OrientationLib_Texture_HDRS
+  ${OrientationLib_SOURCE_DIR}/Texture/DistributionAccumulator.h
+  ${OrientationLib_SOURCE_DIR}/Texture/MdfAccumulator.h
+  ${OrientationLib_SOURCE_DIR}/Texture/OdfAccumulator.h
   ${OrientationLib_SOURCE_DIR}/Texture/TexturePreset.h
   ${OrientationLib_SOURCE_DIR}/Texture/Texture.hpp
   ${OrientationLib_SOURCE_DIR}/Texture/StatsGen.hpp
 )
 
 set(OrientationLib_Texture_SRCS
+  ${OrientationLib_SOURCE_DIR}/Texture/DistributionAccumulator.cpp
+  ${OrientationLib_SOURCE_DIR}/Texture/MdfAccumulator.cpp
+  ${OrientationLib_SOURCE_DIR}/Texture/OdfAccumulator.cpp
   ${OrientationLib_SOURCE_DIR}/Texture/TexturePreset.cpp
 )
 
@@ -34,8 +34,38 @@
 #include "H5Support/H5Lite.h"
 #include "H5Support/H5Utilities.h"
 
+#include "SIMPLib/Math/MatrixMath.h"
+
+#include "OrientationLib/OrientationMath/OrientationFixedArray.hpp"
+#include "OrientationLib/OrientationMath/OrientationTransforms.hpp"
 #include "OrientationLib/Utilities/ModifiedLambertProjection.h"
 
+namespace
+{
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void AddDiscreteCount(float* xyz, int imageDim, double* intensity)
+{
+  int halfDim = imageDim / 2;
+  if(xyz[2] < 0.0f)
+  {
+    xyz[0] *= -1.0f;
+    xyz[1] *= -1.0f;
+    xyz[2] *= -1.0f;
+  }
+  float x = xyz[0] / (1 + xyz[2]);
+  float y = xyz[1] / (1 + xyz[2]);
+
+  int xCoord = static_cast<int>(x * (halfDim - 1)) + halfDim;
+  int yCoord = static_cast<int>(y * (halfDim - 1)) + halfDim;
+
+  size_t index = static_cast<size_t>((yCoord * imageDim) + xCoord);
+
+  intensity[index]++;
+}
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -46,6 +76,17 @@ ComputeStereographicProjection::ComputeStereographicProjection(FloatArrayType* x
 {
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ComputeStereographicProjection::ComputeStereographicProjection(FloatArrayType* eulers, std::vector<float> directions, PoleFigureConfiguration_t* config, DoubleArrayType* intensity)
+: m_Eulers(eulers)
+, m_Directions(std::move(directions))
+, m_Config(config)
+, m_Intensity(intensity)
+{
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -61,27 +102,45 @@ void ComputeStereographicProjection::operator()() const
 
   if(m_Config->discrete)
   {
-    int halfDim = m_Config->imageDim / 2;
     double* intensity = m_Intensity->getPointer(0);
-    size_t numCoords = m_XYZCoords->getNumberOfTuples();
-    float* xyzPtr = m_XYZCoords->getPointer(0);
-    for(size_t i = 0; i < numCoords; i++)
+    if(nullptr != m_XYZCoords)
     {
-      if(xyzPtr[i * 3 + 2] < 0.0f)
+      size_t numCoords = m_XYZCoords->getNumberOfTuples();
+      float* xyzPtr = m_XYZCoords->getPointer(0);
+      for(size_t i = 0; i < numCoords; i++)
       {
-        xyzPtr[i * 3 + 0] *= -1.0f;
-        xyzPtr[i * 3 + 1] *= -1.0f;
-        xyzPtr[i * 3 + 2] *= -1.0f;
+        AddDiscreteCount(xyzPtr + i * 3, m_Config->imageDim, intensity);
+      }
+    }
+    else
+    {
+      float g[3][3];
+      float gTranpose[3][3];
+      float direction[3] = {0.0f, 0.0f, 0.0f};
+      float xyz[3] = {0.0f, 0.0f, 0.0f};
+      size_t numOrientations = m_Eulers->getNumberOfTuples();
+      size_t numDirections = m_Directions.size() / 3;
+      for(size_t i = 0; i < numOrientations; i++)
+      {
+        float* euler = m_Eulers->getPointer(i * 3);
+        FOrientFixedArrayType eu(euler[0], euler[1], euler[2]);
+        FOrientFixedArrayType om(9, 0.0f);
+        FOrientFixedTransformsType::eu2om(eu, om);
+        om.toGMatrix(g);
+        MatrixMath::Transpose3x3(g, gTranpose);
+        for(size_t d = 0; d < numDirections; d++)
+        {
+          direction[0] = m_Directions[d * 3];
+          direction[1] = m_Directions[d * 3 + 1];
+          direction[2] = m_Directions[d * 3 + 2];
+          MatrixMath::Multiply3x3with3x1(gTranpose, direction, xyz);
+          AddDiscreteCount(xyz, m_Config->imageDim, intensity);
+          // AddDiscreteCount folds xyz into the upper hemisphere in place, so rebuild it before taking the antipode
+          MatrixMath::Multiply3x3with3x1(gTranpose, direction, xyz);
+          MatrixMath::Multiply3x1withConstant(xyz, -1);
+          AddDiscreteCount(xyz, m_Config->imageDim, intensity);
+        }
       }
-      float x = xyzPtr[i * 3] / (1 + xyzPtr[i * 3 + 2]);
-      float y = xyzPtr[i * 3 + 1] / (1 + xyzPtr[i * 3 + 2]);
-
-      int xCoord = static_cast<int>(x * (halfDim - 1)) + halfDim;
-      int yCoord = static_cast<int>(y * (halfDim - 1)) + halfDim;
-
-      size_t index = static_cast<size_t>((yCoord * m_Config->imageDim) + xCoord);
-
-      intensity[index]++;
     }
 #if 0
     // This chunk is here for some debugging....
@@ -97,7 +156,15 @@ void ComputeStereographicProjection::operator()() const
   }
   else
   {
-    ModifiedLambertProjection::Pointer lambert = ModifiedLambertProjection::LambertBallToSquare(m_XYZCoords, m_Config->lambertDim, m_Config->sphereRadius);
+    ModifiedLambertProjection::Pointer lambert;
+    if(nullptr != m_XYZCoords)
+    {
+      lambert = ModifiedLambertProjection::LambertBallToSquare(m_XYZCoords, m_Config->lambertDim, m_Config->sphereRadius);
+    }
+    else
+    {
+      lambert = ModifiedLambertProjection::LambertEulersToSquare(m_Eulers, m_Directions, m_Config->lambertDim, m_Config->sphereRadius);
+    }
     lambert->normalizeSquaresToMRD();
 #if 0
     int dim = lambert->getDimension();
@@ -31,6 +31,8 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #pragma once
 
+#include <vector>
+
 #include "SIMPLib/DataArrays/DataArray.hpp"
 
 
@@ -53,6 +55,16 @@ class OrientationLib_EXPORT ComputeStereographicProjection
      */
     ComputeStereographicProjection(FloatArrayType* xyzCoords, PoleFigureConfiguration_t* config, DoubleArrayType* intensity);
 
+    /**
+     * @brief ComputeStereographicProjection Fused variant that bins the rotated crystal directions straight from the
+     * Euler angles instead of from a precomputed array of XYZ coordinates.
+     * @param eulers The Euler angles (3 components per tuple)
+     * @param directions Unit crystal directions packed as XYZ triplets, one per +/- pair
+     * @param config
+     * @param intensity
+     */
+    ComputeStereographicProjection(FloatArrayType* eulers, std::vector<float> directions, PoleFigureConfiguration_t* config, DoubleArrayType* intensity);
+
     virtual ~ComputeStereographicProjection();
 
     /**
@@ -69,6 +81,8 @@ class OrientationLib_EXPORT ComputeStereographicProjection
 
   private:
     FloatArrayType*     m_XYZCoords = nullptr;
+    FloatArrayType*     m_Eulers = nullptr;
+    std::vector<float>  m_Directions;
     PoleFigureConfiguration_t* m_Config = nullptr;
     DoubleArrayType*    m_Intensity = nullptr;
 
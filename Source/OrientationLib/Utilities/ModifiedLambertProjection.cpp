@@ -36,12 +36,23 @@
 
 #include "ModifiedLambertProjection.h"
 
+#include <algorithm>
+
 #include <QtCore/QSet>
 
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_reduce.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
 
 #include "SIMPLib/Math/SIMPLibMath.h"
 #include "SIMPLib/Math/MatrixMath.h"
 
+#include "OrientationLib/OrientationMath/OrientationFixedArray.hpp"
+#include "OrientationLib/OrientationMath/OrientationTransforms.hpp"
+
 #define WRITE_LAMBERT_SQUARE_COORD_VTK 0
 
 // -----------------------------------------------------------------------------
@@ -61,30 +72,134 @@ ModifiedLambertProjection::ModifiedLambertProjection() :
 // -----------------------------------------------------------------------------
 ModifiedLambertProjection::~ModifiedLambertProjection() = default;
 
+// -----------------------------------------------------------------------------
+// Accumulates interpolated Lambert counts into a private pair of squares. Used as
+// a tbb::parallel_reduce body so each worker bins into its own buffers and the
+// buffers are summed once at the end instead of contending on shared bins.
+// -----------------------------------------------------------------------------
+class ModifiedLambertProjection::LambertAccumulator
+{
+    const ModifiedLambertProjection* m_Projection = nullptr;
+    FloatArrayType* m_Coords = nullptr;
+    FloatArrayType* m_Eulers = nullptr;
+    const std::vector<float>* m_Directions = nullptr;
+    std::vector<double> m_North;
+    std::vector<double> m_South;
+
+  public:
+    LambertAccumulator(const ModifiedLambertProjection* projection, FloatArrayType* coords, FloatArrayType* eulers, const std::vector<float>* directions)
+    : m_Projection(projection)
+    , m_Coords(coords)
+    , m_Eulers(eulers)
+    , m_Directions(directions)
+    , m_North(static_cast<size_t>(projection->m_Dimension * projection->m_Dimension), 0.0)
+    , m_South(static_cast<size_t>(projection->m_Dimension * projection->m_Dimension), 0.0)
+    {
+    }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    LambertAccumulator(LambertAccumulator& other, tbb::split)
+    : m_Projection(other.m_Projection)
+    , m_Coords(other.m_Coords)
+    , m_Eulers(other.m_Eulers)
+    , m_Directions(other.m_Directions)
+    , m_North(other.m_North.size(), 0.0)
+    , m_South(other.m_South.size(), 0.0)
+    {
+    }
+#endif
+
+    void binPoint(float* xyz)
+    {
+      float sqCoord[2] = {0.0f, 0.0f};
+      // get coordinates in square projection of crystal normal parallel to boundary normal
+      bool nhCheck = m_Projection->getSquareCoord(xyz, sqCoord);
+      if(nhCheck)
+      {
+        m_Projection->addInterpolatedValues(m_North.data(), sqCoord, 1.0);
+      }
+      else
+      {
+        m_Projection->addInterpolatedValues(m_South.data(), sqCoord, 1.0);
+      }
+    }
+
+    void accumulate(size_t start, size_t end)
+    {
+      if(nullptr != m_Coords)
+      {
+        for(size_t i = start; i < end; ++i)
+        {
+          binPoint(m_Coords->getPointer(i * 3));
+        }
+        return;
+      }
+
+      float g[3][3];
+      float gTranpose[3][3];
+      float direction[3] = {0.0f, 0.0f, 0.0f};
+      float xyz[3] = {0.0f, 0.0f, 0.0f};
+      size_t numDirections = m_Directions->size() / 3;
+      for(size_t i = start; i < end; ++i)
+      {
+        float* euler = m_Eulers->getPointer(i * 3);
+        FOrientFixedArrayType eu(euler[0], euler[1], euler[2]);
+        FOrientFixedArrayType om(9, 0.0f);
+        FOrientFixedTransformsType::eu2om(eu, om);
+        om.toGMatrix(g);
+        MatrixMath::Transpose3x3(g, gTranpose);
+        for(size_t d = 0; d < numDirections; ++d)
+        {
+          direction[0] = (*m_Directions)[d * 3];
+          direction[1] = (*m_Directions)[d * 3 + 1];
+          direction[2] = (*m_Directions)[d * 3 + 2];
+          MatrixMath::Multiply3x3with3x1(gTranpose, direction, xyz);
+          binPoint(xyz);
+          MatrixMath::Multiply3x1withConstant(xyz, -1);
+          binPoint(xyz);
+        }
+      }
+    }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    void operator()(const tbb::blocked_range<size_t>& r)
+    {
+      accumulate(r.begin(), r.end());
+    }
+#endif
+
+    void join(const LambertAccumulator& rhs)
+    {
+      for(size_t i = 0; i < m_North.size(); ++i)
+      {
+        m_North[i] += rhs.m_North[i];
+        m_South[i] += rhs.m_South[i];
+      }
+    }
+
+    void copyInto(ModifiedLambertProjection* projection) const
+    {
+      std::copy(m_North.begin(), m_North.end(), projection->m_NorthSquare->getPointer(0));
+      std::copy(m_South.begin(), m_South.end(), projection->m_SouthSquare->getPointer(0));
+    }
+};
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 ModifiedLambertProjection::Pointer ModifiedLambertProjection::LambertBallToSquare(FloatArrayType* coords, int dimension, float sphereRadius)
 {
-
   size_t npoints = coords->getNumberOfTuples();
-  bool nhCheck = false;
-  float sqCoord[2];
-  //int sqIndex = 0;
   ModifiedLambertProjection::Pointer squareProj = ModifiedLambertProjection::New();
   squareProj->initializeSquares(dimension, sphereRadius);
 
-
 #if WRITE_LAMBERT_SQUARE_COORD_VTK
-  QString ss;
   QString filename("/tmp/");
   filename.append("ModifiedLambert_Square_Coords_").append(coords->getName()).append(".vtk");
   FILE* f = nullptr;
   f = fopen(filename.toLatin1().data(), "wb");
   if(nullptr == f)
   {
-    ss.str("");
-    QString ss = QObject::tr("Could not open vtk viz file %1 for writing. Please check access permissions and the path to the output location exists").arg(filename);
     return squareProj;
   }
 
@@ -95,36 +210,58 @@ ModifiedLambertProjection::Pointer ModifiedLambertProjection::LambertBallToSquar
   fprintf(f, "\n");
 
   fprintf(f, "DATASET UNSTRUCTURED_GRID\nPOINTS %lu float\n", coords->getNumberOfTuples() );
-#endif
-
   for(size_t i = 0; i < npoints; ++i)
   {
-    sqCoord[0] = 0.0;
-    sqCoord[1] = 0.0;
-    //get coordinates in square projection of crystal normal parallel to boundary normal
-    nhCheck = squareProj->getSquareCoord(coords->getPointer(i * 3), sqCoord);
-#if WRITE_LAMBERT_SQUARE_COORD_VTK
+    float sqCoord[2] = {0.0f, 0.0f};
+    squareProj->getSquareCoord(coords->getPointer(i * 3), sqCoord);
     fprintf(f, "%f %f 0\n", sqCoord[0], sqCoord[1]);
+  }
+  fclose(f);
 #endif
 
-    // Based on the XY coordinate, get the pointer index that the value corresponds to in the proper square
-//    sqIndex = squareProj->getSquareIndex(sqCoord);
-    if(nhCheck)
-    {
-      //north increment by 1
-//      squareProj->addValue(ModifiedLambertProjection::NorthSquare, sqIndex, 1.0);
-      squareProj->addInterpolatedValues(ModifiedLambertProjection::NorthSquare, sqCoord, 1.0);
-    }
-    else
-    {
-      // south increment by 1
-//      squareProj->addValue(ModifiedLambertProjection::SouthSquare, sqIndex, 1.0);
-      squareProj->addInterpolatedValues(ModifiedLambertProjection::SouthSquare, sqCoord, 1.0);
-    }
+  LambertAccumulator accumulator(squareProj.get(), coords, nullptr, nullptr);
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+  if(doParallel)
+  {
+    tbb::parallel_reduce(tbb::blocked_range<size_t>(0, npoints), accumulator, tbb::auto_partitioner());
   }
-#if WRITE_LAMBERT_SQUARE_COORD_VTK
-  fclose(f);
+  else
 #endif
+  {
+    accumulator.accumulate(0, npoints);
+  }
+  accumulator.copyInto(squareProj.get());
+
+  return squareProj;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ModifiedLambertProjection::Pointer ModifiedLambertProjection::LambertEulersToSquare(FloatArrayType* eulers, const std::vector<float>& directions, int dimension, float sphereRadius)
+{
+  size_t nOrientations = eulers->getNumberOfTuples();
+  ModifiedLambertProjection::Pointer squareProj = ModifiedLambertProjection::New();
+  squareProj->initializeSquares(dimension, sphereRadius);
+
+  LambertAccumulator accumulator(squareProj.get(), nullptr, eulers, &directions);
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+  if(doParallel)
+  {
+    tbb::parallel_reduce(tbb::blocked_range<size_t>(0, nOrientations), accumulator, tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    accumulator.accumulate(0, nOrientations);
+  }
+  accumulator.copyInto(squareProj.get());
 
   return squareProj;
 }
@@ -188,6 +325,21 @@ int ModifiedLambertProjection::readHDF5Data(hid_t groupId)
 //
 // -----------------------------------------------------------------------------
 void ModifiedLambertProjection::addInterpolatedValues(Square square, float* sqCoord, double value)
+{
+  if (square == NorthSquare)
+  {
+    addInterpolatedValues(m_NorthSquare->getPointer(0), sqCoord, value);
+  }
+  else
+  {
+    addInterpolatedValues(m_SouthSquare->getPointer(0), sqCoord, value);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ModifiedLambertProjection::addInterpolatedValues(double* square, const float* sqCoord, double value) const
 {
   int abin1 = 0, bbin1 = 0;
   int abin2 = 0, bbin2 = 0;
@@ -253,28 +405,10 @@ void ModifiedLambertProjection::addInterpolatedValues(Square square, float* sqCo
   int index2 = bbin2 * m_Dimension + abin2;
   int index3 = bbin3 * m_Dimension + abin3;
   int index4 = bbin4 * m_Dimension + abin4;
-  if (square == NorthSquare)
-  {
-    double v1 = m_NorthSquare->getValue(index1) + value * (1.0 - modX) * (1.0 - modY);
-    double v2 = m_NorthSquare->getValue(index2) + value * (modX) * (1.0 - modY);
-    double v3 = m_NorthSquare->getValue(index3) + value * (1.0 - modX) * (modY);
-    double v4 = m_NorthSquare->getValue(index4) + value * (modX) * (modY);
-    m_NorthSquare->setValue(index1, v1);
-    m_NorthSquare->setValue(index2, v2);
-    m_NorthSquare->setValue(index3, v3);
-    m_NorthSquare->setValue(index4, v4);
-  }
-  else
-  {
-    double v1 = m_SouthSquare->getValue(index1) + value * (1.0 - modX) * (1.0 - modY);
-    double v2 = m_SouthSquare->getValue(index2) + value * (modX) * (1.0 - modY);
-    double v3 = m_SouthSquare->getValue(index3) + value * (1.0 - modX) * (modY);
-    double v4 = m_SouthSquare->getValue(index4) + value * (modX) * (modY);
-    m_SouthSquare->setValue(index1, v1);
-    m_SouthSquare->setValue(index2, v2);
-    m_SouthSquare->setValue(index3, v3);
-    m_SouthSquare->setValue(index4, v4);
-  }
+  square[index1] += value * (1.0 - modX) * (1.0 - modY);
+  square[index2] += value * (modX) * (1.0 - modY);
+  square[index3] += value * (1.0 - modX) * (modY);
+  square[index4] += value * (modX) * (modY);
 }
 
 // -----------------------------------------------------------------------------
@@ -408,7 +542,7 @@ double ModifiedLambertProjection::getInterpolatedValue(Square square, float* sqC
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-bool ModifiedLambertProjection::getSquareCoord(float* xyz, float* sqCoord)
+bool ModifiedLambertProjection::getSquareCoord(float* xyz, float* sqCoord) const
 {
   bool nhCheck = false;
   float adjust = 1.0;
@@ -36,6 +36,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
@@ -77,6 +79,20 @@ class OrientationLib_EXPORT ModifiedLambertProjection
      */
     static Pointer LambertBallToSquare(FloatArrayType* coords, int dimension, float sphereRadius);
 
+    /**
+     * @brief LambertEulersToSquare This static method creates the north and south squares directly from a set of Euler
+     * angles and a family of crystal directions. Each direction is rotated into the sample frame by every orientation and
+     * the resulting point (and its antipode) is binned immediately, so the N x 3 array of XYZ coordinates that
+     * LambertBallToSquare needs is never allocated. The result is identical to generating those coordinates and calling
+     * LambertBallToSquare, up to floating point summation order.
+     * @param eulers The Euler angles (3 components per tuple)
+     * @param directions Unit crystal directions packed as XYZ triplets. Only one direction of each +/- pair is listed.
+     * @param dimension The Dimension of the modified lambert projections images
+     * @param sphereRadius The radius of the sphere from where the coordinates are coming from.
+     * @return
+     */
+    static Pointer LambertEulersToSquare(FloatArrayType* eulers, const std::vector<float>& directions, int dimension, float sphereRadius);
+
     SIMPL_GET_PROPERTY(int, Dimension)
     SIMPL_GET_PROPERTY(float, StepSize)
     SIMPL_GET_PROPERTY(float, SphereRadius)
@@ -141,7 +157,7 @@ class OrientationLib_EXPORT ModifiedLambertProjection
      * @param sqCoord [output] The XY coordinate in the Modified Lambert Square
      * @return If the point was in the north or south squares
      */
-    bool getSquareCoord(float* xyz, float* sqCoord);
+    bool getSquareCoord(float* xyz, float* sqCoord) const;
 
     /**
      * @brief getSquareIndex
@@ -172,7 +188,18 @@ class OrientationLib_EXPORT ModifiedLambertProjection
   protected:
     ModifiedLambertProjection();
 
+    /**
+     * @brief addInterpolatedValues Spreads 'value' over the 4 bins surrounding sqCoord in the raw square buffer 'square'.
+     * This does not touch any member data so it is safe to call concurrently on separate buffers.
+     * @param square Pointer to m_Dimension x m_Dimension values
+     * @param sqCoord
+     * @param value
+     */
+    void addInterpolatedValues(double* square, const float* sqCoord, double value) const;
+
   private:
+    class LambertAccumulator;
+
     int m_Dimension;
     float m_StepSize; // The length of an individual grid square
     float m_SphereRadius;
@@ -39,6 +39,7 @@
 #include <QtCore/QByteArray>
 #include <QtCore/QTextStream>
 
+#include "SIMPLib/Math/SIMPLibMath.h"
 #include "SIMPLib/Utilities/ColorTable.h"
 
 
@@ -200,32 +201,17 @@ void PoleFigureUtilities::GenerateHexPoleFigures(FloatArrayType* eulers, int lam
                                                  DoubleArrayType::Pointer& intensity1010,
                                                  DoubleArrayType::Pointer& intensity1120)
 {
-  size_t numOrientations = eulers->getNumberOfTuples();
-
-  // Create an Array to hold the XYZ Coordinates which are the coords on the sphere.
-  // this is size for HEX ONLY, <0001> Family
-  QVector<size_t> dims(1, 3);
-  FloatArrayType::Pointer xyz0001 = FloatArrayType::CreateArray(numOrientations * 2, dims, "TEMP_<0001>_xyzCoords");
-  // this is size for HEX ONLY, <10-10> Family
-  FloatArrayType::Pointer xyz1010 = FloatArrayType::CreateArray(numOrientations * 6, dims, "TEMP_<1010>_xyzCoords");
-  // this is size for HEX ONLY, <11-20> Family
-  FloatArrayType::Pointer xyz1120 = FloatArrayType::CreateArray(numOrientations * 6, dims, "TEMP_<1120>_xyzCoords");
-
-
+  // The crystal directions of each family, one per +/- pair. The Lambert squares are binned straight from the
+  // Euler angles so the per family sphere coordinate arrays are never allocated.
+  const float r3o2 = SIMPLib::Constants::k_Root3Over2;
+  std::vector<float> directions0001 = {0.0f, 0.0f, 1.0f};
+  std::vector<float> directions1010 = {r3o2, 0.5f, 0.0f, 0.0f, 1.0f, 0.0f, -r3o2, 0.5f, 0.0f};
+  std::vector<float> directions1120 = {1.0f, 0.0f, 0.0f, 0.5f, r3o2, 0.0f, -0.5f, r3o2, 0.0f};
 
   float sphereRadius = 1.0f;
 
-  // Generate the coords on the sphere
-  HexagonalOps ops;
-  ops.generateSphereCoordsFromEulers(eulers, xyz0001.get(), xyz1010.get(), xyz1120.get());
-#if WRITE_XYZ_SPHERE_COORD_VTK
-  writeVtkFile(xyz0001.get(), "c:/Users/GroebeMA/Desktop/Sphere_XYZ_FROM_EULER_0001.vtk");
-  writeVtkFile(xyz1010.get(), "c:/Users/GroebeMA/Desktop/Sphere_XYZ_FROM_EULER_1010.vtk");
-  writeVtkFile(xyz1120.get(), "c:/Users/GroebeMA/Desktop/Sphere_XYZ_FROM_EULER_1120.vtk");
-#endif
-
   // Generate the modified Lambert projection images (Squares, 2 of them, 1 for northern hemisphere, 1 for southern hemisphere
-  ModifiedLambertProjection::Pointer lambert = ModifiedLambertProjection::LambertBallToSquare(xyz0001.get(), lambertDimension, sphereRadius);
+  ModifiedLambertProjection::Pointer lambert = ModifiedLambertProjection::LambertEulersToSquare(eulers, directions0001, lambertDimension, sphereRadius);
   // Now create the intensity image that will become the actual Pole figure image
   DoubleArrayType::Pointer poleFigurePtr = lambert->createStereographicProjection(poleFigureDim);
   poleFigurePtr->setName("PoleFigure_<0001>");
@@ -242,13 +228,13 @@ void PoleFigureUtilities::GenerateHexPoleFigures(FloatArrayType* eulers, int lam
 
 
 // Generate the <011> pole figure which will generate a new set of Lambert Squares
-  lambert = ModifiedLambertProjection::LambertBallToSquare(xyz1010.get(), lambertDimension, sphereRadius);
+  lambert = ModifiedLambertProjection::LambertEulersToSquare(eulers, directions1010, lambertDimension, sphereRadius);
   poleFigurePtr = lambert->createStereographicProjection(poleFigureDim);
   poleFigurePtr->setName("PoleFigure_<1010>");
   intensity1010.swap(poleFigurePtr);
 
   // Generate the <111> pole figure which will generate a new set of Lambert Squares
-  lambert = ModifiedLambertProjection::LambertBallToSquare(xyz1120.get(), lambertDimension, sphereRadius);
+  lambert = ModifiedLambertProjection::LambertEulersToSquare(eulers, directions1120, lambertDimension, sphereRadius);
   poleFigurePtr = lambert->createStereographicProjection(poleFigureDim);
   poleFigurePtr->setName("PoleFigure_<1120>");
   intensity1120.swap(poleFigurePtr);
@@ -262,32 +248,16 @@ void PoleFigureUtilities::GenerateOrthoPoleFigures(FloatArrayType* eulers, int l
                                                    DoubleArrayType::Pointer& intensity010,
                                                    DoubleArrayType::Pointer& intensity001)
 {
-  size_t numOrientations = eulers->getNumberOfTuples();
-
-  // Create an Array to hold the XYZ Coordinates which are the coords on the sphere.
-  // this is size for ORTHO ONLY, <100> Family
-  QVector<size_t> dims(1, 3);
-  FloatArrayType::Pointer xyz100 = FloatArrayType::CreateArray(numOrientations * 2, dims, "TEMP_<100>_xyzCoords");
-  // this is size for ORTHO ONLY, <010> Family
-  FloatArrayType::Pointer xyz010 = FloatArrayType::CreateArray(numOrientations * 2, dims, "TEMP_<010>_xyzCoords");
-  // this is size for ORTHO ONLY, <001> Family
-  FloatArrayType::Pointer xyz001 = FloatArrayType::CreateArray(numOrientations * 2, dims, "TEMP_<001>_xyzCoords");
-
-
+  // The crystal directions of each family, one per +/- pair, in the same order OrthoRhombicOps::generateSphereCoordsFromEulers
+  // fills its three output arrays. The Lambert squares are binned straight from the Euler angles.
+  std::vector<float> directions100 = {0.0f, 0.0f, 1.0f};
+  std::vector<float> directions010 = {1.0f, 0.0f, 0.0f};
+  std::vector<float> directions001 = {0.0f, 1.0f, 0.0f};
 
   float sphereRadius = 1.0f;
 
-  // Generate the coords on the sphere
-  OrthoRhombicOps ops;
-  ops.generateSphereCoordsFromEulers(eulers, xyz100.get(), xyz010.get(), xyz001.get());
-#if WRITE_XYZ_SPHERE_COORD_VTK
-  writeVtkFile(xyz100.get(), "c:/Users/GroebeMA/Desktop/Sphere_XYZ_FROM_EULER_100.vtk");
-  writeVtkFile(xyz010.get(), "c:/Users/GroebeMA/Desktop/Sphere_XYZ_FROM_EULER_010.vtk");
-  writeVtkFile(xyz001.get(), "c:/Users/GroebeMA/Desktop/Sphere_XYZ_FROM_EULER_001.vtk");
-#endif
-
   // Generate the modified Lambert projection images (Squares, 2 of them, 1 for northern hemisphere, 1 for southern hemisphere
-  ModifiedLambertProjection::Pointer lambert = ModifiedLambertProjection::LambertBallToSquare(xyz100.get(), lambertDimension, sphereRadius);
+  ModifiedLambertProjection::Pointer lambert = ModifiedLambertProjection::LambertEulersToSquare(eulers, directions100, lambertDimension, sphereRadius);
   // Now create the intensity image that will become the actual Pole figure image
   DoubleArrayType::Pointer poleFigurePtr = lambert->createStereographicProjection(poleFigureDim);
   poleFigurePtr->setName("PoleFigure_<100>");
@@ -304,13 +274,13 @@ void PoleFigureUtilities::GenerateOrthoPoleFigures(FloatArrayType* eulers, int l
 
 
 // Generate the <011> pole figure which will generate a new set of Lambert Squares
-  lambert = ModifiedLambertProjection::LambertBallToSquare(xyz010.get(), lambertDimension, sphereRadius);
+  lambert = ModifiedLambertProjection::LambertEulersToSquare(eulers, directions010, lambertDimension, sphereRadius);
   poleFigurePtr = lambert->createStereographicProjection(poleFigureDim);
   poleFigurePtr->setName("PoleFigure_<010>");
   intensity010.swap(poleFigurePtr);
 
   // Generate the <111> pole figure which will generate a new set of Lambert Squares
-  lambert = ModifiedLambertProjection::LambertBallToSquare(xyz001.get(), lambertDimension, sphereRadius);
+  lambert = ModifiedLambertProjection::LambertEulersToSquare(eulers, directions001, lambertDimension, sphereRadius);
   poleFigurePtr = lambert->createStereographicProjection(poleFigureDim);
   poleFigurePtr->setName("PoleFigure_<001>");
   intensity001.swap(poleFigurePtr);
@@ -87,6 +87,9 @@ void EbsdToH5EbsdFilterParameter::readJson(const QJsonObject& json)
   m_Filter->setFileSuffix(json["FileSuffix"].toString());
   m_Filter->setFileExtension(json["FileExtension"].toString());
   m_Filter->setPaddingDigits(json["PaddingDigits"].toInt());
+  m_Filter->setChunkSize(json["ChunkSize"].toInt(0));
+  m_Filter->setCompressionLevel(json["CompressionLevel"].toInt(0));
+  m_Filter->setShuffle(json["Shuffle"].toBool(false));
 
   QJsonObject sampleTransObj = json["SampleTransformation"].toObject();
   AxisAngleInput_t sampleTrans;
@@ -114,6 +117,9 @@ void EbsdToH5EbsdFilterParameter::writeJson(QJsonObject& json)
   json["FileSuffix"] = m_Filter->getFileSuffix();
   json["FileExtension"] = m_Filter->getFileExtension();
   json["PaddingDigits"] = m_Filter->getPaddingDigits();
+  json["ChunkSize"] = m_Filter->getChunkSize();
+  json["CompressionLevel"] = m_Filter->getCompressionLevel();
+  json["Shuffle"] = m_Filter->getShuffle();
 
   QJsonObject sampleTransObj;
   AxisAngleInput_t sampleTrans = m_Filter->getSampleTransformation();
@@ -82,6 +82,11 @@ void ReadH5EbsdFilterParameter::readJson(const QJsonObject& json)
   m_Filter->setInputFile(json["InputFile"].toString());
   m_Filter->setZStartIndex(json["ZStartIndex"].toInt());
   m_Filter->setZEndIndex(json["ZEndIndex"].toInt());
+  m_Filter->setUseRegionOfInterest(json["UseRegionOfInterest"].toBool(false));
+  m_Filter->setXStartIndex(json["XStartIndex"].toInt(0));
+  m_Filter->setXEndIndex(json["XEndIndex"].toInt(0));
+  m_Filter->setYStartIndex(json["YStartIndex"].toInt(0));
+  m_Filter->setYEndIndex(json["YEndIndex"].toInt(0));
   m_Filter->setUseTransformations(static_cast<bool>(json["UseTransformations"].toInt()));
   m_Filter->setAngleRepresentation(json["AngleRepresentation"].toInt());
   m_Filter->setRefFrameZDir(static_cast<uint32_t>(json["RefFrameZDir"].toInt()));
@@ -103,6 +108,11 @@ void ReadH5EbsdFilterParameter::writeJson(QJsonObject& json)
   json["InputFile"] = m_Filter->getInputFile();
   json["ZStartIndex"] = m_Filter->getZStartIndex();
   json["ZEndIndex"] = m_Filter->getZEndIndex();
+  json["UseRegionOfInterest"] = m_Filter->getUseRegionOfInterest();
+  json["XStartIndex"] = m_Filter->getXStartIndex();
+  json["XEndIndex"] = m_Filter->getXEndIndex();
+  json["YStartIndex"] = m_Filter->getYStartIndex();
+  json["YEndIndex"] = m_Filter->getYEndIndex();
   json["UseTransformations"] = static_cast<int>(m_Filter->getUseTransformations());
   json["AngleRepresentation"] = m_Filter->getAngleRepresentation();
   json["RefFrameZDir"] = static_cast<int>(m_Filter->getRefFrameZDir());
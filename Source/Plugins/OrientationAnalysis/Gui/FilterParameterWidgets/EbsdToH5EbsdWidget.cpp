@@ -178,6 +178,7 @@ void EbsdToH5EbsdWidget::setupGui()
   m_WidgetList << m_LineEdit << m_InputDirBtn << m_OutputFile << m_OutputFileBtn;
   m_WidgetList << m_FileExt << m_ErrorMessage << m_TotalDigits;
   m_WidgetList << m_FilePrefix << m_TotalSlices << m_ZStartIndex << m_ZEndIndex << m_zSpacing;
+  m_WidgetList << m_ChunkSize << m_CompressionLevel << m_Shuffle;
   m_ErrorMessage->setVisible(false);
 
   m_StackingGroup = new QButtonGroup(this);
@@ -286,6 +287,10 @@ void EbsdToH5EbsdWidget::getGuiParametersFromFilter()
   m_FileExt->setText(m_Filter->getFileExtension());
   m_TotalDigits->setValue(m_Filter->getPaddingDigits());
 
+  m_ChunkSize->setValue(m_Filter->getChunkSize());
+  m_CompressionLevel->setValue(m_Filter->getCompressionLevel());
+  m_Shuffle->setChecked(m_Filter->getShuffle());
+
   m_SampleTransformation = m_Filter->getSampleTransformation();
   m_EulerTransformation = m_Filter->getEulerTransformation();
 
@@ -511,6 +516,30 @@ void EbsdToH5EbsdWidget::on_m_TotalDigits_valueChanged(int value)
   emit parametersChanged();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void EbsdToH5EbsdWidget::on_m_ChunkSize_valueChanged(int value)
+{
+  emit parametersChanged();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void EbsdToH5EbsdWidget::on_m_CompressionLevel_valueChanged(int value)
+{
+  emit parametersChanged();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void EbsdToH5EbsdWidget::on_m_Shuffle_stateChanged(int state)
+{
+  emit parametersChanged();
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -841,6 +870,9 @@ void EbsdToH5EbsdWidget::filterNeedsInputParameters(AbstractFilter* filter)
   ebsdConverter->setFileSuffix(m_FileSuffix->text());
   ebsdConverter->setFileExtension(m_FileExt->text());
   ebsdConverter->setPaddingDigits(m_TotalDigits->value());
+  ebsdConverter->setChunkSize(m_ChunkSize->value());
+  ebsdConverter->setCompressionLevel(m_CompressionLevel->value());
+  ebsdConverter->setShuffle(m_Shuffle->isChecked());
 
   ebsdConverter->setSampleTransformation(m_SampleTransformation);
   ebsdConverter->setEulerTransformation(m_EulerTransformation);
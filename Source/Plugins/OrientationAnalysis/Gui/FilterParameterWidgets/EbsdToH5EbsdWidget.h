@@ -118,6 +118,9 @@ class EbsdToH5EbsdWidget : public FilterParameterWidget, private Ui::EbsdToH5Ebs
     void on_m_ZStartIndex_valueChanged(int value);
     void on_m_ZEndIndex_valueChanged(int value);
     void on_m_zSpacing_textChanged(const QString& string);
+    void on_m_ChunkSize_valueChanged(int value);
+    void on_m_CompressionLevel_valueChanged(int value);
+    void on_m_Shuffle_stateChanged(int state);
 
     // slots to catch signals emitted by the various QLineEdit widgets
     void on_m_LineEdit_textChanged(const QString& text);
@@ -195,6 +195,18 @@ void ReadH5EbsdWidget::setupGui()
   m_ZEndIndex->setRange(0, m_Filter->getZEndIndex());
   m_ZEndIndex->setValue(m_Filter->getZEndIndex());
 
+  // The region of interest ranges are also adjusted once the dimensions of the file are known
+  m_XStartIndex->setRange(0, m_Filter->getXEndIndex());
+  m_XStartIndex->setValue(m_Filter->getXStartIndex());
+  m_XEndIndex->setRange(0, m_Filter->getXEndIndex());
+  m_XEndIndex->setValue(m_Filter->getXEndIndex());
+  m_YStartIndex->setRange(0, m_Filter->getYEndIndex());
+  m_YStartIndex->setValue(m_Filter->getYStartIndex());
+  m_YEndIndex->setRange(0, m_Filter->getYEndIndex());
+  m_YEndIndex->setValue(m_Filter->getYEndIndex());
+  m_UseRegionOfInterest->setChecked(m_Filter->getUseRegionOfInterest());
+  updateRegionOfInterestWidgets();
+
   m_UseTransformations->setChecked(m_Filter->getUseTransformations());
   m_AngleRepresentationCB->setCurrentIndex(m_Filter->getAngleRepresentation());
   m_RefFrameZDir->setText(Ebsd::StackingOrder::Utils::getStringForEnum(m_Filter->getRefFrameZDir()));
@@ -446,6 +458,69 @@ void ReadH5EbsdWidget::on_m_ZEndIndex_valueChanged(int value)
   m_DidCausePreflight = false;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ReadH5EbsdWidget::on_m_UseRegionOfInterest_stateChanged(int state)
+{
+  m_DidCausePreflight = true;
+  updateRegionOfInterestWidgets();
+  emit parametersChanged();
+  m_DidCausePreflight = false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ReadH5EbsdWidget::on_m_XStartIndex_valueChanged(int value)
+{
+  m_DidCausePreflight = true;
+  emit parametersChanged();
+  m_DidCausePreflight = false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ReadH5EbsdWidget::on_m_XEndIndex_valueChanged(int value)
+{
+  m_DidCausePreflight = true;
+  emit parametersChanged();
+  m_DidCausePreflight = false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ReadH5EbsdWidget::on_m_YStartIndex_valueChanged(int value)
+{
+  m_DidCausePreflight = true;
+  emit parametersChanged();
+  m_DidCausePreflight = false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ReadH5EbsdWidget::on_m_YEndIndex_valueChanged(int value)
+{
+  m_DidCausePreflight = true;
+  emit parametersChanged();
+  m_DidCausePreflight = false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ReadH5EbsdWidget::updateRegionOfInterestWidgets()
+{
+  bool enabled = m_UseRegionOfInterest->isChecked();
+  m_XStartIndex->setEnabled(enabled);
+  m_XEndIndex->setEnabled(enabled);
+  m_YStartIndex->setEnabled(enabled);
+  m_YEndIndex->setEnabled(enabled);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -490,6 +565,11 @@ void ReadH5EbsdWidget::filterNeedsInputParameters(AbstractFilter* filter)
   readEbsd->setInputFile(inputPath);
   readEbsd->setZStartIndex(m_ZStartIndex->text().toLongLong(&ok));
   readEbsd->setZEndIndex(m_ZEndIndex->text().toLongLong(&ok));
+  readEbsd->setUseRegionOfInterest(m_UseRegionOfInterest->isChecked());
+  readEbsd->setXStartIndex(m_XStartIndex->value());
+  readEbsd->setXEndIndex(m_XEndIndex->value());
+  readEbsd->setYStartIndex(m_YStartIndex->value());
+  readEbsd->setYEndIndex(m_YEndIndex->value());
   readEbsd->setUseTransformations(m_UseTransformations->isChecked());
   int index = m_AngleRepresentationCB->currentIndex();
   readEbsd->setAngleRepresentation(index);
@@ -647,6 +727,21 @@ void ReadH5EbsdWidget::updateFileInfoWidgets()
         {
           m_ZEndIndex->setValue(zEnd);
         }
+
+        // A region of interest can hold any of the Cells of a slice
+        int xMax = static_cast<int>(xpoints) - 1;
+        int yMax = static_cast<int>(ypoints) - 1;
+        bool resetEnd = (m_XEndIndex->value() == 0 && m_YEndIndex->value() == 0);
+        m_XStartIndex->setRange(0, xMax);
+        m_XEndIndex->setRange(0, xMax);
+        m_YStartIndex->setRange(0, yMax);
+        m_YEndIndex->setRange(0, yMax);
+        if(resetEnd)
+        {
+          // Nothing was chosen yet, so start from the whole slice
+          m_XEndIndex->setValue(xMax);
+          m_YEndIndex->setValue(yMax);
+        }
       }
       else
       {
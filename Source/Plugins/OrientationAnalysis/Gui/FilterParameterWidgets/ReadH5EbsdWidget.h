@@ -99,6 +99,11 @@ class ReadH5EbsdWidget : public FilterParameterWidget, private Ui::ReadH5EbsdWid
     void on_m_DataArraysCheckBox_stateChanged(int state);
     void on_m_ZStartIndex_valueChanged(int value);
     void on_m_ZEndIndex_valueChanged(int value);
+    void on_m_UseRegionOfInterest_stateChanged(int state);
+    void on_m_XStartIndex_valueChanged(int value);
+    void on_m_XEndIndex_valueChanged(int value);
+    void on_m_YStartIndex_valueChanged(int value);
+    void on_m_YEndIndex_valueChanged(int value);
     void on_m_UseTransformations_stateChanged(int state);
     void on_m_AngleRepresentationCB_currentIndexChanged(int index);
 
@@ -128,6 +133,11 @@ class ReadH5EbsdWidget : public FilterParameterWidget, private Ui::ReadH5EbsdWid
      */
     void resetGuiFileInfoWidgets();
 
+    /**
+     * @brief updateRegionOfInterestWidgets Enables the index widgets only while a region of interest is read
+     */
+    void updateRegionOfInterestWidgets();
+
     /**
      * @brief updateFileInfoWidgets
      */
@@ -31,6 +31,7 @@
 #include "EMsoftSO3Sampler.h"
 
 #include <cmath>
+#include <vector>
 
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
@@ -283,7 +284,9 @@ void EMsoftSO3Sampler::execute()
     return;
   }
 
-  OrientationListArrayType FZlist;
+  // Rodrigues vectors (n1, n2, n3, tan(w/2)) stored contiguously instead of one
+  // heap allocated node per point
+  std::vector<double> FZlist;
   typedef OrientationTransforms<DOrientArrayType, double> OrientationTransformsType;
 
   if(getsampleModeSelector() == 0)
@@ -350,7 +353,7 @@ void EMsoftSO3Sampler::execute()
                 bool b = IsinsideFZ(rod.data(), FZtype, FZorder);
                 if(b)
                 {
-                  FZlist.push_back(rod);
+                  FZlist.insert(FZlist.end(), rod.data(), rod.data() + 4);
                   Dg += 1;
                 }
                 Di += 1;
@@ -401,6 +404,7 @@ void EMsoftSO3Sampler::execute()
       // set counter parameters for the loop over the sub-cube surface
       int Np = getNumsp();
       int Totp = 24 * Np * Np + 2;
+      FZlist.reserve(static_cast<size_t>(Totp) * 4);
       int Dn = Totp / 20;
       int Dc = Dn;
       int Dg = 0;
@@ -418,7 +422,7 @@ void EMsoftSO3Sampler::execute()
             DOrientArrayType rod(4);
             OrientationTransformsType::cu2ro(cu, rod);
             RodriguesComposition(sigma, rod);
-            FZlist.push_back(rod);
+            FZlist.insert(FZlist.end(), rod.data(), rod.data() + 4);
             Dg += 1;
           }
           {
@@ -426,7 +430,7 @@ void EMsoftSO3Sampler::execute()
             DOrientArrayType rod(4);
             OrientationTransformsType::cu2ro(cu, rod);
             RodriguesComposition(sigma, rod);
-            FZlist.push_back(rod);
+            FZlist.insert(FZlist.end(), rod.data(), rod.data() + 4);
             Dg += 1;
           }
         }
@@ -448,7 +452,7 @@ void EMsoftSO3Sampler::execute()
             DOrientArrayType rod(4);
             OrientationTransformsType::cu2ro(cu, rod);
             RodriguesComposition(sigma, rod);
-            FZlist.push_back(rod);
+            FZlist.insert(FZlist.end(), rod.data(), rod.data() + 4);
             Dg += 1;
           }
           {
@@ -456,7 +460,7 @@ void EMsoftSO3Sampler::execute()
             DOrientArrayType rod(4);
             OrientationTransformsType::cu2ro(cu, rod);
             RodriguesComposition(sigma, rod);
-            FZlist.push_back(rod);
+            FZlist.insert(FZlist.end(), rod.data(), rod.data() + 4);
             Dg += 1;
           }
         }
@@ -478,7 +482,7 @@ void EMsoftSO3Sampler::execute()
             DOrientArrayType rod(4);
             OrientationTransformsType::cu2ro(cu, rod);
             RodriguesComposition(sigma, rod);
-            FZlist.push_back(rod);
+            FZlist.insert(FZlist.end(), rod.data(), rod.data() + 4);
             Dg += 1;
           }
           {
@@ -486,7 +490,7 @@ void EMsoftSO3Sampler::execute()
             DOrientArrayType rod(4);
             OrientationTransformsType::cu2ro(cu, rod);
             RodriguesComposition(sigma, rod);
-            FZlist.push_back(rod);
+            FZlist.insert(FZlist.end(), rod.data(), rod.data() + 4);
             Dg += 1;
           }
         }
@@ -509,6 +513,7 @@ void EMsoftSO3Sampler::execute()
       // set counter parameters for the loop over the sub-cube surface
       int Np = getNumsp();
       int Totp = (2 * Np + 1) * (2 * Np + 1) * (2 * Np + 1); // see misorientation sampling paper for this expression
+      FZlist.reserve(static_cast<size_t>(Totp) * 4);
       int Dn = Totp / 20;
       int Dc = Dn;
       int Dg = 0;
@@ -528,7 +533,7 @@ void EMsoftSO3Sampler::execute()
               DOrientArrayType rod(4);
               OrientationTransformsType::cu2ro(cu, rod);
               RodriguesComposition(sigma, rod);
-              FZlist.push_back(rod);
+              FZlist.insert(FZlist.end(), rod.data(), rod.data() + 4);
               Dg += 1;
             }
           }
@@ -546,17 +551,17 @@ void EMsoftSO3Sampler::execute()
 
   // resize the EulerAngles array to the number of items in FZlist; don't forget to redefine the hard pointer
   AttributeMatrix::Pointer am = getDataContainerArray()->getAttributeMatrix(DataArrayPath(getDataContainerName().getDataContainerName(), getEMsoftAttributeMatrixName(), ""));
-  QVector<size_t> tDims(1, FZlist.size());
+  size_t numRods = FZlist.size() / 4;
+  QVector<size_t> tDims(1, numRods);
   am->resizeAttributeArrays(tDims);
   m_EulerAngles = m_EulerAnglesPtr.lock()->getPointer(0);
 
   // copy the Rodrigues vectors as Euler angles into the m_EulerAngles array; convert doubles to floats along the way
-  int j = -1;
-  for(DOrientArrayType rod : FZlist)
+  DOrientFixedArrayType eu(3, 0.0);
+  for(size_t j = 0; j < numRods; j++)
   {
-    j += 1;
-    DOrientArrayType eu(3, 0.0);
-    OrientationTransformsType::ro2eu(rod, eu);
+    DOrientFixedArrayType rod(FZlist[j * 4], FZlist[j * 4 + 1], FZlist[j * 4 + 2], FZlist[j * 4 + 3]);
+    DOrientFixedTransformsType::ro2eu(rod, eu);
 
     m_EulerAngles[j * 3 + 0] = static_cast<float>(eu[0]);
     m_EulerAngles[j * 3 + 1] = static_cast<float>(eu[1]);
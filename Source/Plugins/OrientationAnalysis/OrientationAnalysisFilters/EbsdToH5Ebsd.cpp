@@ -35,8 +35,17 @@
 
 #include "EbsdToH5Ebsd.h"
 
+#include <algorithm>
+
 #include <QtCore/QDir>
 
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <atomic>
+
+#include <tbb/pipeline.h>
+#include <tbb/task_scheduler_init.h>
+#endif
+
 #include "H5Support/QH5Utilities.h"
 #include "H5Support/H5ScopedSentinel.h"
 
@@ -51,6 +60,21 @@
 #include "OrientationAnalysis/OrientationAnalysisConstants.h"
 #include "OrientationAnalysis/OrientationAnalysisVersion.h"
 
+namespace
+{
+/**
+ * @brief An EBSD file that was read into memory and is waiting to be written to the HDF5 file
+ */
+struct ParsedEbsdFile
+{
+  QString filePath;
+  EbsdReader::Pointer reader;
+  int err = 0;
+  QString message;
+};
+using ParsedEbsdFilePointer = std::shared_ptr<ParsedEbsdFile>;
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -65,6 +89,9 @@ EbsdToH5Ebsd::EbsdToH5Ebsd()
 , m_FileSuffix("")
 , m_FileExtension("ang")
 , m_PaddingDigits(4)
+, m_ChunkSize(0)
+, m_CompressionLevel(0)
+, m_Shuffle(false)
 {
   m_SampleTransformation.angle = 0.0f;
   m_SampleTransformation.h = 0.0f;
@@ -113,6 +140,9 @@ void EbsdToH5Ebsd::readFilterParameters(AbstractFilterParametersReader* reader,
   setPaddingDigits(reader->readValue("PaddingDigits", getPaddingDigits()));
   setSampleTransformation(reader->readAxisAngle("SampleTransformation", getSampleTransformation(), -1));
   setEulerTransformation(reader->readAxisAngle("EulerTransformation", getEulerTransformation(), -1));
+  setChunkSize(reader->readValue("ChunkSize", getChunkSize()));
+  setCompressionLevel(reader->readValue("CompressionLevel", getCompressionLevel()));
+  setShuffle(reader->readValue("Shuffle", getShuffle()));
   reader->closeFilterGroup();
 }
 
@@ -362,11 +392,12 @@ void EbsdToH5Ebsd::execute()
 
     return;
   }
+  fileImporter->setChunkSize(static_cast<hsize_t>(std::max(m_ChunkSize, 0)));
+  fileImporter->setCompressionLevel(m_CompressionLevel);
+  fileImporter->setShuffle(m_Shuffle);
 
   QVector<int32_t> indices;
   // Loop on Each EBSD File
-  float total = static_cast<float>(m_ZEndIndex - m_ZStartIndex);
-  int32_t progress = 0;
   int64_t z = m_ZStartIndex;
   int64_t xDim = 0, yDim = 0;
   float xRes = 0.0f, yRes = 0.0f;
@@ -396,19 +427,21 @@ void EbsdToH5Ebsd::execute()
   int64_t biggestxDim = 0;
   int64_t biggestyDim = 0;
   int32_t totalSlicesImported = 0;
-  for(QVector<QString>::iterator filepath = fileList.begin(); filepath != fileList.end(); ++filepath)
-  {
-    QString ebsdFName = *filepath;
-    progress = static_cast<int32_t>(z - m_ZStartIndex);
-    progress = (int32_t)(100.0f * (float)(progress) / total);
-    QString msg = "Converting File: " + ebsdFName;
 
+  // Writes a file that was read into memory to the HDF5 file. The files must arrive in z order.
+  auto writeEbsdFile = [&](const ParsedEbsdFile& parsed) -> bool {
+    QString msg = "Converting File: " + parsed.filePath;
     notifyStatusMessage(msg.toLatin1().data());
-    err = fileImporter->importFile(fileId, z, ebsdFName);
+    if(nullptr == parsed.reader)
+    {
+      setErrorCondition(-1, parsed.message);
+      return false;
+    }
+    err = fileImporter->writeEbsdData(fileId, z, parsed.reader);
     if(err < 0)
     {
       setErrorCondition(err, fileImporter->getPipelineMessage());
-      return;
+      return false;
     }
     totalSlicesImported = totalSlicesImported + fileImporter->numberOfSlicesImported();
 
@@ -423,19 +456,59 @@ void EbsdToH5Ebsd::execute()
       biggestyDim = yDim;
     }
 
-    if(err < 0)
-    {
-      QString ss = QObject::tr("Could not write dataset for slice to HDF5 file");
-      setErrorCondition(-1, ss);
-    }
-
     indices.push_back(static_cast<int32_t>(z));
     ++z;
-    if(getCancel())
+    return !getCancel();
+  };
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  // Read several files at once on the worker threads while the files that are done are
+  // written to the HDF5 file one at a time, in z order. The number of files in flight
+  // is bounded by the number of threads so memory use stays bounded as well.
+  tbb::task_scheduler_init init;
+  // The files are already read in parallel, so each one is parsed on the thread that reads it
+  fileImporter->setNumberOfParserThreads(1);
+  int32_t nextFile = 0;
+  std::atomic<bool> keepGoing(true);
+
+  auto nextFileFilter = tbb::make_filter<void, ParsedEbsdFilePointer>(tbb::filter::serial_in_order, [&](tbb::flow_control& fc) -> ParsedEbsdFilePointer {
+    if(!keepGoing || nextFile >= fileList.size())
+    {
+      fc.stop();
+      return ParsedEbsdFilePointer();
+    }
+    ParsedEbsdFilePointer parsed(new ParsedEbsdFile);
+    parsed->filePath = fileList[nextFile++];
+    return parsed;
+  });
+  auto readFilter = tbb::make_filter<ParsedEbsdFilePointer, ParsedEbsdFilePointer>(tbb::filter::parallel, [&fileImporter](ParsedEbsdFilePointer parsed) -> ParsedEbsdFilePointer {
+    parsed->reader = fileImporter->readEbsdFile(parsed->filePath, parsed->err, parsed->message);
+    return parsed;
+  });
+  auto writeFilter = tbb::make_filter<ParsedEbsdFilePointer, void>(tbb::filter::serial_in_order, [&](ParsedEbsdFilePointer parsed) {
+    // Once a file failed the files still in flight are dropped
+    if(keepGoing && !writeEbsdFile(*parsed))
+    {
+      keepGoing = false;
+    }
+  });
+  tbb::parallel_pipeline(static_cast<size_t>(tbb::task_scheduler_init::default_num_threads()), nextFileFilter & readFilter & writeFilter);
+  if(!keepGoing)
+  {
+    return;
+  }
+#else
+  for(const QString& ebsdFName : fileList)
+  {
+    ParsedEbsdFile parsed;
+    parsed.filePath = ebsdFName;
+    parsed.reader = fileImporter->readEbsdFile(ebsdFName, parsed.err, parsed.message);
+    if(!writeEbsdFile(parsed))
     {
       return;
     }
   }
+#endif
 
   // Write Z index start, Z index end and Z Spacing to the HDF5 file
   err = QH5Lite::writeScalarDataset(fileId, Ebsd::H5Ebsd::ZStartIndex, m_ZStartIndex);
@@ -515,6 +588,9 @@ AbstractFilter::Pointer EbsdToH5Ebsd::newFilterInstance(bool copyFilterParameter
     SIMPL_COPY_INSTANCEVAR(PaddingDigits)
     SIMPL_COPY_INSTANCEVAR(SampleTransformation)
     SIMPL_COPY_INSTANCEVAR(EulerTransformation)
+    SIMPL_COPY_INSTANCEVAR(ChunkSize)
+    SIMPL_COPY_INSTANCEVAR(CompressionLevel)
+    SIMPL_COPY_INSTANCEVAR(Shuffle)
   }
   return filter;
 }
@@ -63,6 +63,9 @@ class OrientationAnalysis_EXPORT EbsdToH5Ebsd : public AbstractFilter
   PYB11_PROPERTY(float ZResolution READ getZResolution WRITE setZResolution)
   PYB11_PROPERTY(AxisAngleInput_t SampleTransformation READ getSampleTransformation WRITE setSampleTransformation)
   PYB11_PROPERTY(AxisAngleInput_t EulerTransformation READ getEulerTransformation WRITE setEulerTransformation)
+  PYB11_PROPERTY(int ChunkSize READ getChunkSize WRITE setChunkSize)
+  PYB11_PROPERTY(int CompressionLevel READ getCompressionLevel WRITE setCompressionLevel)
+  PYB11_PROPERTY(bool Shuffle READ getShuffle WRITE setShuffle)
 public:
   SIMPL_SHARED_POINTERS(EbsdToH5Ebsd)
   SIMPL_FILTER_NEW_MACRO(EbsdToH5Ebsd)
@@ -94,6 +97,21 @@ public:
 
   SIMPL_FILTER_PARAMETER(AxisAngleInput_t, EulerTransformation)
 
+  /**
+   * @brief The number of values in each chunk of the imported data arrays, 0 for contiguous data arrays
+   */
+  SIMPL_INSTANCE_PROPERTY(int, ChunkSize)
+
+  /**
+   * @brief The deflate level (1 - 9) of the imported data arrays, 0 to leave them uncompressed
+   */
+  SIMPL_INSTANCE_PROPERTY(int, CompressionLevel)
+
+  /**
+   * @brief Apply the byte shuffle filter ahead of deflate
+   */
+  SIMPL_INSTANCE_PROPERTY(bool, Shuffle)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -41,6 +41,7 @@
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 
+#include "OrientationLib/LaueOps/LaueOpsDispatch.hpp"
 #include "OrientationLib/OrientationMath/OrientationTransforms.hpp"
 
 #include "OrientationAnalysis/OrientationAnalysisConstants.h"
@@ -64,8 +65,6 @@ FindAvgOrientations::FindAvgOrientations()
 , m_AvgQuatsArrayPath("", "", "")
 , m_AvgEulerAnglesArrayPath("", "", "")
 {
-  m_OrientationOps = LaueOps::getOrientationOpsQVector();
-
 }
 
 // -----------------------------------------------------------------------------
@@ -233,9 +232,6 @@ void FindAvgOrientations::execute()
 
   std::vector<float> counts(totalFeatures, 0.0f);
 
-  int32_t phase = 0;
-  QuatF voxquat = QuaternionMathF::New();
-  QuatF curavgquat = QuaternionMathF::New();
   QuatF* avgQuats = reinterpret_cast<QuatF*>(m_AvgQuats);
   QuatF* quats = reinterpret_cast<QuatF*>(m_Quats);
 
@@ -244,23 +240,34 @@ void FindAvgOrientations::execute()
     QuaternionMathF::ElementWiseAssign(avgQuats[i], 0.0);
   }
 
-  for(size_t i = 0; i < totalPoints; i++)
-  {
-    if(m_FeatureIds[i] > 0 && m_CellPhases[i] > 0)
+  // Accumulate one phase at a time so the nearest-quaternion search runs with
+  // the concrete LaueOps class of that phase and no virtual calls
+  auto accumulatePhase = [&](auto& ops, int32_t phase) {
+    QuatF voxquat = QuaternionMathF::New();
+    QuatF curavgquat = QuaternionMathF::New();
+    for(size_t i = 0; i < totalPoints; i++)
     {
-      counts[m_FeatureIds[i]] += 1.0f;
-      phase = m_CellPhases[i];
-      QuaternionMathF::Copy(quats[i], voxquat);
-      QuaternionMathF::Copy(avgQuats[m_FeatureIds[i]], curavgquat);
-      QuaternionMathF::ScalarDivide(curavgquat, counts[m_FeatureIds[i]]);
-
-      if(counts[m_FeatureIds[i]] == 1.0f)
+      if(m_FeatureIds[i] > 0 && m_CellPhases[i] == phase)
       {
-        QuaternionMathF::Identity(curavgquat);
+        counts[m_FeatureIds[i]] += 1.0f;
+        QuaternionMathF::Copy(quats[i], voxquat);
+        QuaternionMathF::Copy(avgQuats[m_FeatureIds[i]], curavgquat);
+        QuaternionMathF::ScalarDivide(curavgquat, counts[m_FeatureIds[i]]);
+
+        if(counts[m_FeatureIds[i]] == 1.0f)
+        {
+          QuaternionMathF::Identity(curavgquat);
+        }
+        ops.getNearestQuat(curavgquat, voxquat);
+        QuaternionMathF::Add(avgQuats[m_FeatureIds[i]], voxquat, avgQuats[m_FeatureIds[i]]);
       }
-      m_OrientationOps[m_CrystalStructures[phase]]->getNearestQuat(curavgquat, voxquat);
-      QuaternionMathF::Add(avgQuats[m_FeatureIds[i]], voxquat, avgQuats[m_FeatureIds[i]]);
     }
+  };
+
+  int32_t numPhases = static_cast<int32_t>(m_CrystalStructuresPtr.lock()->getNumberOfTuples());
+  for(int32_t phase = 1; phase < numPhases; phase++)
+  {
+    LaueOpsDispatch::Dispatch(m_CrystalStructures[phase], [&](auto& ops) { accumulatePhase(ops, phase); });
   }
 
   for(size_t i = 1; i < totalFeatures; i++)
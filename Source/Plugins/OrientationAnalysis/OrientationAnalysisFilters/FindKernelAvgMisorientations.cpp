@@ -33,8 +33,19 @@
 *
 * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
+
 #include "FindKernelAvgMisorientations.h"
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
@@ -49,6 +60,141 @@
 
 #include "EbsdLib/EbsdConstants.h"
 
+#include "OrientationLib/LaueOps/LaueOpsDispatch.hpp"
+
+namespace
+{
+const int32_t k_MaxSymOps = 24;
+}
+
+/**
+ * @brief The FindKernelAvgMisorientationsImpl class computes the kernel average misorientation
+ * for a range of planes. Cells are visited with X innermost and the kernel extent is clamped to
+ * the volume once per Cell, so the neighbor loops need no bounds checks. The misorientation angle
+ * only depends on the largest |scalar part| of S_i * q1 * q2^-1 over the symmetry operators S_i,
+ * which equals the 4D dot product of S_i * q1 with q2. Each Cell's quaternion is therefore
+ * multiplied by the symmetry operators once and every neighbor only costs one dot product per operator.
+ */
+class FindKernelAvgMisorientationsImpl
+{
+public:
+  FindKernelAvgMisorientationsImpl(const int64_t dims[3], const IntVec3Type& kernelSize, const int32_t* featureIds, const int32_t* cellPhases, const QuatF* quats, const QuatF* symOps,
+                                   const int32_t* numSymOps, int32_t numPhases, float* kernelAvgMisorientations)
+  : m_KernelSize(kernelSize)
+  , m_FeatureIds(featureIds)
+  , m_CellPhases(cellPhases)
+  , m_Quats(quats)
+  , m_SymOps(symOps)
+  , m_NumSymOps(numSymOps)
+  , m_NumPhases(numPhases)
+  , m_KernelAvgMisorientations(kernelAvgMisorientations)
+  {
+    m_Dims[0] = dims[0];
+    m_Dims[1] = dims[1];
+    m_Dims[2] = dims[2];
+  }
+
+  virtual ~FindKernelAvgMisorientationsImpl() = default;
+
+  void compute(int64_t zStart, int64_t zEnd) const
+  {
+    const int64_t xPoints = m_Dims[0];
+    const int64_t yPoints = m_Dims[1];
+    const int64_t zPoints = m_Dims[2];
+    const int64_t planeStride = xPoints * yPoints;
+
+    float symx[k_MaxSymOps];
+    float symy[k_MaxSymOps];
+    float symz[k_MaxSymOps];
+    float symw[k_MaxSymOps];
+    QuatF qs = QuaternionMathF::New();
+
+    for(int64_t plane = zStart; plane < zEnd; plane++)
+    {
+      const int64_t zMin = std::max<int64_t>(plane - m_KernelSize[2], 0);
+      const int64_t zMax = std::min<int64_t>(plane + m_KernelSize[2], zPoints - 1);
+      for(int64_t row = 0; row < yPoints; row++)
+      {
+        const int64_t yMin = std::max<int64_t>(row - m_KernelSize[1], 0);
+        const int64_t yMax = std::min<int64_t>(row + m_KernelSize[1], yPoints - 1);
+        for(int64_t col = 0; col < xPoints; col++)
+        {
+          const int64_t point = plane * planeStride + row * xPoints + col;
+          m_KernelAvgMisorientations[point] = 0.0f;
+          const int32_t featureId = m_FeatureIds[point];
+          const int32_t phase = m_CellPhases[point];
+          if(featureId <= 0 || phase <= 0 || phase >= m_NumPhases || m_NumSymOps[phase] == 0)
+          {
+            continue;
+          }
+
+          const int32_t numSym = m_NumSymOps[phase];
+          const QuatF* symOps = m_SymOps + phase * k_MaxSymOps;
+          for(int32_t i = 0; i < numSym; i++)
+          {
+            QuaternionMathF::Multiply(symOps[i], m_Quats[point], qs);
+            symx[i] = qs.x;
+            symy[i] = qs.y;
+            symz[i] = qs.z;
+            symw[i] = qs.w;
+          }
+
+          const int64_t xMin = std::max<int64_t>(col - m_KernelSize[0], 0);
+          const int64_t xMax = std::min<int64_t>(col + m_KernelSize[0], xPoints - 1);
+          float totalMisorientation = 0.0f;
+          int32_t numVoxel = 0;
+          for(int64_t z = zMin; z <= zMax; z++)
+          {
+            for(int64_t y = yMin; y <= yMax; y++)
+            {
+              const int64_t rowOffset = z * planeStride + y * xPoints;
+              for(int64_t x = xMin; x <= xMax; x++)
+              {
+                const int64_t neighbor = rowOffset + x;
+                if(m_FeatureIds[neighbor] != featureId)
+                {
+                  continue;
+                }
+                const QuatF& q2 = m_Quats[neighbor];
+                float wmax = 0.0f;
+                for(int32_t i = 0; i < numSym; i++)
+                {
+                  float w = std::fabs(symx[i] * q2.x + symy[i] * q2.y + symz[i] * q2.z + symw[i] * q2.w);
+                  wmax = std::max(wmax, w);
+                }
+                wmax = std::min(wmax, 1.0f);
+                totalMisorientation += 2.0f * std::acos(wmax) * (180.0f / SIMPLib::Constants::k_Pi);
+                numVoxel++;
+              }
+            }
+          }
+          if(numVoxel > 0)
+          {
+            m_KernelAvgMisorientations[point] = totalMisorientation / static_cast<float>(numVoxel);
+          }
+        }
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<int64_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+private:
+  int64_t m_Dims[3] = {0, 0, 0};
+  IntVec3Type m_KernelSize;
+  const int32_t* m_FeatureIds = nullptr;
+  const int32_t* m_CellPhases = nullptr;
+  const QuatF* m_Quats = nullptr;
+  const QuatF* m_SymOps = nullptr;
+  const int32_t* m_NumSymOps = nullptr;
+  int32_t m_NumPhases = 0;
+  float* m_KernelAvgMisorientations = nullptr;
+};
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -59,8 +205,6 @@ FindKernelAvgMisorientations::FindKernelAvgMisorientations()
 , m_QuatsArrayPath(SIMPL::Defaults::ImageDataContainerName, SIMPL::Defaults::CellAttributeMatrixName, SIMPL::CellData::Quats)
 , m_KernelAverageMisorientationsArrayName(SIMPL::CellData::KernelAverageMisorientations)
 {
-  m_OrientationOps = LaueOps::getOrientationOpsQVector();
-
   m_KernelSize[0] = 1;
   m_KernelSize[1] = 1;
   m_KernelSize[2] = 1;
@@ -220,101 +364,48 @@ void FindKernelAvgMisorientations::execute()
 
   DataContainer::Pointer m = getDataContainerArray()->getDataContainer(m_FeatureIdsArrayPath.getDataContainerName());
 
-  QuatF q1 = QuaternionMathF::New();
-  QuatF q2 = QuaternionMathF::New();
   QuatF* quats = reinterpret_cast<QuatF*>(m_Quats);
 
-  int32_t numVoxel = 0; // number of voxels in the feature...
-  bool good = false;
-
-  float w = 0.0f, totalmisorientation = 0.0f;
-  float n1 = 0.0f, n2 = 0.0f, n3 = 0.0f;
-  uint32_t phase1 = Ebsd::CrystalStructure::UnknownCrystalStructure;
-  uint32_t phase2 = Ebsd::CrystalStructure::UnknownCrystalStructure;
   SizeVec3Type udims = m->getGeometryAs<ImageGeom>()->getDimensions();
 
   int64_t xPoints = static_cast<int64_t>(udims[0]);
   int64_t yPoints = static_cast<int64_t>(udims[1]);
   int64_t zPoints = static_cast<int64_t>(udims[2]);
-  int64_t point = 0;
-  size_t neighbor = 0;
-  int64_t jStride = 0;
-  int64_t kStride = 0;
-
-  for(int64_t col = 0; col < xPoints; col++)
+  int64_t dims[3] = {xPoints, yPoints, zPoints};
+
+  // Gather the symmetry operators of every phase up front so the kernel can expand each
+  // Cell's quaternion without going through LaueOps. Phases with an unknown Laue class
+  // keep zero operators and their Cells are left at a KAM of 0
+  int32_t numPhases = static_cast<int32_t>(m_CrystalStructuresPtr.lock()->getNumberOfTuples());
+  std::vector<QuatF> symOps(static_cast<size_t>(numPhases * k_MaxSymOps), QuaternionMathF::New());
+  std::vector<int32_t> numSymOps(static_cast<size_t>(numPhases), 0);
+  for(int32_t phase = 1; phase < numPhases; phase++)
   {
-    for(int64_t row = 0; row < yPoints; row++)
-    {
-      for(int64_t plane = 0; plane < zPoints; plane++)
+    LaueOpsDispatch::Dispatch(m_CrystalStructures[phase], [&](auto& ops) {
+      numSymOps[phase] = std::min(ops.getNumSymOps(), k_MaxSymOps);
+      for(int32_t i = 0; i < numSymOps[phase]; i++)
       {
-        point = (plane * xPoints * yPoints) + (row * xPoints) + col;
-        if(m_FeatureIds[point] > 0 && m_CellPhases[point] > 0)
-        {
-          totalmisorientation = 0.0f;
-          numVoxel = 0;
-          QuaternionMathF::Copy(quats[point], q1);
-          phase1 = m_CrystalStructures[m_CellPhases[point]];
-          for(int32_t j = -m_KernelSize[2]; j < m_KernelSize[2] + 1; j++)
-          {
-            jStride = j * xPoints * yPoints;
-            for(int32_t k = -m_KernelSize[1]; k < m_KernelSize[1] + 1; k++)
-            {
-              kStride = k * xPoints;
-              for(int32_t l = -m_KernelSize[0]; l < m_KernelSize[0] + 1; l++)
-              {
-                good = true;
-                neighbor = point + (jStride) + (kStride) + (l);
-                if(plane + j < 0)
-                {
-                  good = false;
-                }
-                else if(plane + j > zPoints - 1)
-                {
-                  good = false;
-                }
-                else if(row + k < 0)
-                {
-                  good = false;
-                }
-                else if(row + k > yPoints - 1)
-                {
-                  good = false;
-                }
-                else if(col + l < 0)
-                {
-                  good = false;
-                }
-                else if(col + l > xPoints - 1)
-                {
-                  good = false;
-                }
-                if(good && m_FeatureIds[point] == m_FeatureIds[neighbor])
-                {
-                  w = std::numeric_limits<float>::max();
-                  QuaternionMathF::Copy(quats[neighbor], q2);
-                  phase2 = m_CrystalStructures[m_CellPhases[neighbor]];
-                  w = m_OrientationOps[phase1]->getMisoQuat(q1, q2, n1, n2, n3);
-                  w = w * (180.0f / SIMPLib::Constants::k_Pi);
-                  totalmisorientation = totalmisorientation + w;
-                  numVoxel++;
-                }
-              }
-            }
-          }
-          m_KernelAverageMisorientations[point] = totalmisorientation / (float)numVoxel;
-          if(numVoxel == 0)
-          {
-            m_KernelAverageMisorientations[point] = 0.0f;
-          }
-        }
-        if(m_FeatureIds[point] == 0 || m_CellPhases[point] == 0)
-        {
-          m_KernelAverageMisorientations[point] = 0.0f;
-        }
+        ops.getQuatSymOp(i, symOps[phase * k_MaxSymOps + i]);
       }
-    }
+    });
   }
 
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+#endif
+
+  FindKernelAvgMisorientationsImpl kernel(dims, getKernelSize(), m_FeatureIds, m_CellPhases, quats, symOps.data(), numSymOps.data(), numPhases, m_KernelAverageMisorientations);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(doParallel)
+  {
+    tbb::parallel_for(tbb::blocked_range<int64_t>(0, zPoints), kernel, tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    kernel.compute(0, zPoints);
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -183,8 +183,6 @@ class OrientationAnalysis_EXPORT FindKernelAvgMisorientations : public AbstractF
     void initialize();
 
   private:
-    QVector<LaueOps::Pointer> m_OrientationOps;
-
     DEFINE_DATAARRAY_VARIABLE(int32_t, FeatureIds)
     DEFINE_DATAARRAY_VARIABLE(int32_t, CellPhases)
     DEFINE_DATAARRAY_VARIABLE(float, Quats)
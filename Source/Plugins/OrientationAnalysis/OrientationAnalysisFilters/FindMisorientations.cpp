@@ -36,6 +36,7 @@
 #include "FindMisorientations.h"
 
 #include <cmath>
+#include <vector>
 
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
@@ -242,40 +243,40 @@ void FindMisorientations::execute()
 
   std::vector<std::vector<float>> misorientationlists;
 
-  float n1 = 0.0f, n2 = 0.0f, n3 = 0.0f;
-  float w = 0.0f;
   size_t tempMisoList = 0;
-  QuatF q1 = QuaternionMathF::New();
-  QuatF q2 = QuaternionMathF::New();
   QuatF* avgQuats = reinterpret_cast<QuatF*>(m_AvgQuats);
 
   uint32_t xtalType1 = 0, xtalType2 = 0;
   int32_t nname = 0;
 
+  // Scratch space so all the valid neighbors of a feature go through a single batched
+  // misorientation call instead of one virtual call per neighbor
+  std::vector<QuatF> q1s;
+  std::vector<QuatF> q2s;
+  std::vector<size_t> neighborIndices;
+  std::vector<float> angles;
+
   misorientationlists.resize(totalFeatures);
   for(size_t i = 1; i < totalFeatures; i++)
   {
-    QuaternionMathF::Copy(avgQuats[i], q1);
     xtalType1 = m_CrystalStructures[m_FeaturePhases[i]];
     NeighborList<int32_t>::VectorType& featureNeighborList = neighborlist[i];
 
     misorientationlists[i].assign(featureNeighborList.size(), -1.0);
+    tempMisoList = featureNeighborList.size();
 
+    q1s.clear();
+    q2s.clear();
+    neighborIndices.clear();
     for(size_t j = 0; j < featureNeighborList.size(); j++)
     {
-      w = std::numeric_limits<float>::max();
       nname = featureNeighborList[j];
-      QuaternionMathF::Copy(avgQuats[nname], q2);
       xtalType2 = m_CrystalStructures[m_FeaturePhases[nname]];
-      tempMisoList = featureNeighborList.size();
       if(xtalType1 == xtalType2 && static_cast<int64_t>(xtalType1) < static_cast<int64_t>(m_OrientationOps.size()))
       {
-        w = m_OrientationOps[xtalType1]->getMisoQuat(q1, q2, n1, n2, n3);
-        misorientationlists[i][j] = w * SIMPLib::Constants::k_180OverPi;
-        if(m_FindAvgMisors)
-        {
-          m_AvgMisorientations[i] += misorientationlists[i][j];
-        }
+        q1s.push_back(avgQuats[i]);
+        q2s.push_back(avgQuats[nname]);
+        neighborIndices.push_back(j);
       }
       else
       {
@@ -286,6 +287,22 @@ void FindMisorientations::execute()
         misorientationlists[i][j] = NAN;
       }
     }
+
+    if(!neighborIndices.empty())
+    {
+      angles.resize(neighborIndices.size());
+      m_OrientationOps[xtalType1]->getMisoQuatBatch(q1s.data(), q2s.data(), neighborIndices.size(), angles.data(), nullptr);
+      for(size_t k = 0; k < neighborIndices.size(); k++)
+      {
+        size_t j = neighborIndices[k];
+        misorientationlists[i][j] = angles[k] * SIMPLib::Constants::k_180OverPi;
+        if(m_FindAvgMisors)
+        {
+          m_AvgMisorientations[i] += misorientationlists[i][j];
+        }
+      }
+    }
+
     if(m_FindAvgMisors)
     {
       if(tempMisoList != 0)
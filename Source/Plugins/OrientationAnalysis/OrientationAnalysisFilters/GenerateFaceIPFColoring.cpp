@@ -35,6 +35,8 @@
 
 #include "GenerateFaceIPFColoring.h"
 
+#include <vector>
+
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_for.h>
@@ -108,82 +110,56 @@ public:
     ops.push_back(TrigonalLowOps::New());
     ops.push_back(TrigonalOps::New());
 
-    double refDir[3] = {0.0, 0.0, 0.0};
-    double dEuler[3] = {0.0, 0.0, 0.0};
-    SIMPL::Rgb argb = 0x00000000;
+    // Gather both sides of every face in this block by Laue class so each class
+    // colors all of its faces in a single batched call. The second feature sees
+    // the face from the other side so its direction is the negated normal.
+    size_t numLaueClasses = static_cast<size_t>(ops.size());
+    std::vector<std::vector<float>> eulers(numLaueClasses);
+    std::vector<std::vector<double>> refDirs(numLaueClasses);
+    std::vector<std::vector<size_t>> targets(numLaueClasses);
 
-    int32_t feature1 = 0, feature2 = 0, phase1 = 0, phase2 = 0;
+    int32_t feature = 0, phase = 0;
     for(size_t i = start; i < end; i++)
     {
-      feature1 = m_Labels[2 * i];
-      feature2 = m_Labels[2 * i + 1];
-      if(feature1 > 0)
-      {
-        phase1 = m_Phases[feature1];
-      }
-      else
+      for(size_t side = 0; side < 2; side++)
       {
-        phase1 = 0;
-      }
-
-      if(feature2 > 0)
-      {
-        phase2 = m_Phases[feature2];
-      }
-      else
-      {
-        phase2 = 0;
-      }
+        m_Colors[6 * i + 3 * side] = 0;
+        m_Colors[6 * i + 3 * side + 1] = 0;
+        m_Colors[6 * i + 3 * side + 2] = 0;
 
-      if(phase1 > 0)
-      {
+        feature = m_Labels[2 * i + side];
+        phase = (feature > 0) ? m_Phases[feature] : 0;
         // Make sure we are using a valid Euler Angles with valid crystal symmetry
-        if(m_CrystalStructures[phase1] < Ebsd::CrystalStructure::LaueGroupEnd)
+        if(phase <= 0 || m_CrystalStructures[phase] >= Ebsd::CrystalStructure::LaueGroupEnd)
         {
-          dEuler[0] = m_Eulers[3 * feature1 + 0];
-          dEuler[1] = m_Eulers[3 * feature1 + 1];
-          dEuler[2] = m_Eulers[3 * feature1 + 2];
-          refDir[0] = m_Normals[3 * i + 0];
-          refDir[1] = m_Normals[3 * i + 1];
-          refDir[2] = m_Normals[3 * i + 2];
-
-          argb = ops[m_CrystalStructures[phase1]]->generateIPFColor(dEuler, refDir, false);
-          m_Colors[6 * i] = RgbColor::dRed(argb);
-          m_Colors[6 * i + 1] = RgbColor::dGreen(argb);
-          m_Colors[6 * i + 2] = RgbColor::dBlue(argb);
+          continue;
         }
+        uint32_t laueClass = m_CrystalStructures[phase];
+        double sign = (side == 0) ? 1.0 : -1.0;
+        eulers[laueClass].insert(eulers[laueClass].end(), m_Eulers + 3 * feature, m_Eulers + 3 * feature + 3);
+        refDirs[laueClass].push_back(sign * m_Normals[3 * i + 0]);
+        refDirs[laueClass].push_back(sign * m_Normals[3 * i + 1]);
+        refDirs[laueClass].push_back(sign * m_Normals[3 * i + 2]);
+        targets[laueClass].push_back(6 * i + 3 * side);
       }
-      else // Phase 1 was Zero so assign a black color
-      {
-        m_Colors[6 * i + 0] = 0;
-        m_Colors[6 * i + 1] = 0;
-        m_Colors[6 * i + 2] = 0;
-      }
+    }
 
-      // Now compute for Phase 2
-      if(phase2 > 0)
+    std::vector<uint8_t> colors;
+    for(size_t laueClass = 0; laueClass < numLaueClasses; laueClass++)
+    {
+      size_t count = targets[laueClass].size();
+      if(count == 0)
       {
-        // Make sure we are using a valid Euler Angles with valid crystal symmetry
-        if(m_CrystalStructures[phase1] < Ebsd::CrystalStructure::LaueGroupEnd)
-        {
-          dEuler[0] = m_Eulers[3 * feature2 + 0];
-          dEuler[1] = m_Eulers[3 * feature2 + 1];
-          dEuler[2] = m_Eulers[3 * feature2 + 2];
-          refDir[0] = -m_Normals[3 * i + 0];
-          refDir[1] = -m_Normals[3 * i + 1];
-          refDir[2] = -m_Normals[3 * i + 2];
-
-          argb = ops[m_CrystalStructures[phase1]]->generateIPFColor(dEuler, refDir, false);
-          m_Colors[6 * i + 3] = RgbColor::dRed(argb);
-          m_Colors[6 * i + 4] = RgbColor::dGreen(argb);
-          m_Colors[6 * i + 5] = RgbColor::dBlue(argb);
-        }
+        continue;
       }
-      else
+      colors.resize(count * 3);
+      ops[laueClass]->generateIPFColors(eulers[laueClass].data(), refDirs[laueClass].data(), count, false, colors.data());
+      for(size_t k = 0; k < count; k++)
       {
-        m_Colors[6 * i + 3] = 0;
-        m_Colors[6 * i + 4] = 0;
-        m_Colors[6 * i + 5] = 0;
+        size_t index = targets[laueClass][k];
+        m_Colors[index] = colors[3 * k];
+        m_Colors[index + 1] = colors[3 * k + 1];
+        m_Colors[index + 2] = colors[3 * k + 2];
       }
     }
   }
@@ -84,41 +84,32 @@ public:
   {
     QVector<LaueOps::Pointer> ops = LaueOps::getOrientationOpsQVector();
     double refDir[3] = {m_ReferenceDir[0], m_ReferenceDir[1], m_ReferenceDir[2]};
-    double dEuler[3] = {0.0, 0.0, 0.0};
-    SIMPL::Rgb argb = 0x00000000;
-    int32_t phase = 0;
-    bool calcIPF = false;
     size_t index = 0;
     for(size_t i = start; i < end; i++)
     {
-      phase = m_CellPhases[i];
       index = i * 3;
       m_CellIPFColors[index] = 0;
       m_CellIPFColors[index + 1] = 0;
       m_CellIPFColors[index + 2] = 0;
-      dEuler[0] = m_CellEulerAngles[index];
-      dEuler[1] = m_CellEulerAngles[index + 1];
-      dEuler[2] = m_CellEulerAngles[index + 2];
 
-      // Make sure we are using a valid Euler Angles with valid crystal symmetry
-      calcIPF = true;
-      if(nullptr != m_GoodVoxels)
-      {
-        calcIPF = m_GoodVoxels[i];
-      }
       // Sanity check the phase data to make sure we do not walk off the end of the array
-      if(phase >= m_NumPhases)
+      if(m_CellPhases[i] >= m_NumPhases)
       {
         m_Filter->incrementPhaseWarningCount();
       }
+    }
 
-      if(phase < m_NumPhases && calcIPF && m_CrystalStructures[phase] < Ebsd::CrystalStructure::LaueGroupEnd)
+    // Color the block one phase at a time so each Laue class works on the whole
+    // block in a single batched call. Elements of other phases, bad voxels and
+    // phases without a valid crystal symmetry are left black.
+    const bool* goodVoxels = (nullptr != m_GoodVoxels) ? m_GoodVoxels + start : nullptr;
+    for(int32_t phase = 0; phase < m_NumPhases; phase++)
+    {
+      if(m_CrystalStructures[phase] >= Ebsd::CrystalStructure::LaueGroupEnd)
       {
-        argb = ops[m_CrystalStructures[phase]]->generateIPFColor(dEuler, refDir, false);
-        m_CellIPFColors[index] = static_cast<uint8_t>(RgbColor::dRed(argb));
-        m_CellIPFColors[index + 1] = static_cast<uint8_t>(RgbColor::dGreen(argb));
-        m_CellIPFColors[index + 2] = static_cast<uint8_t>(RgbColor::dBlue(argb));
+        continue;
       }
+      ops[m_CrystalStructures[phase]]->generateIPFColors(m_CellEulerAngles + start * 3, m_CellPhases + start, phase, goodVoxels, end - start, refDir, false, m_CellIPFColors + start * 3);
     }
   }
 
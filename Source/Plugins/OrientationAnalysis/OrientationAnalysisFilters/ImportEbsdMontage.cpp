@@ -32,16 +32,32 @@
 
 #include "ImportEbsdMontage.h"
 
+#include <array>
+#include <utility>
+#include <vector>
+
 #include <QtCore/QDateTime>
 #include <QtCore/QFileInfo>
 
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_scheduler_init.h>
+#endif
+
 #include "EbsdLib/HKL/CtfFields.h"
 #include "EbsdLib/HKL/CtfReader.h"
 #include "EbsdLib/TSL/AngFields.h"
 #include "EbsdLib/TSL/AngReader.h"
 
 #include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/DataArrays/StringDataArray.h"
+#include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
+#include "SIMPLib/FilterParameters/ChoiceFilterParameter.h"
+#include "SIMPLib/FilterParameters/DataContainerCreationFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
@@ -54,6 +70,13 @@
 #include "OrientationAnalysis/OrientationAnalysisFilters/ReadCtfData.h"
 #include "OrientationAnalysis/OrientationAnalysisVersion.h"
 
+enum createdPathID : RenameDataPath::DataID_t
+{
+  AttributeMatrixID21 = 21,
+
+  DataContainerID = 1
+};
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -61,6 +84,10 @@ ImportEbsdMontage::ImportEbsdMontage()
 : m_DataContainerName("OIM Data Container")
 , m_CellEnsembleAttributeMatrixName("Phase Data")
 , m_CellAttributeMatrixName("Scan Data")
+, m_ReadTilesInParallel(true)
+, m_TileOverlap(0)
+, m_StitchTiles(false)
+, m_OverlapMethod(static_cast<int>(OverlapMethodType::SplitOverlap))
 {
   initialize();
 }
@@ -88,7 +115,15 @@ void ImportEbsdMontage::setupFilterParameters()
   FilterParameterVectorType parameters;
 
   parameters.push_back(SIMPL_NEW_EbsdMontageListInfo_FP("Input File List", InputFileListInfo, FilterParameter::Parameter, ImportEbsdMontage));
-  // parameters.push_back(SIMPL_NEW_DC_CREATION_FP("Data Container", DataContainerName, FilterParameter::CreatedArray, ImportEbsdMontage));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Read Tiles in Parallel", ReadTilesInParallel, FilterParameter::Parameter, ImportEbsdMontage));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Tile Overlap (Pixels)", TileOverlap, FilterParameter::Parameter, ImportEbsdMontage));
+  QStringList linkedProps = {"DataContainerName", "OverlapMethod"};
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Stitch Tiles into a Single Image", StitchTiles, FilterParameter::Parameter, ImportEbsdMontage, linkedProps));
+  {
+    QVector<QString> choices = {"Keep First Tile", "Keep Last Tile", "Split Overlap Evenly"};
+    parameters.push_back(SIMPL_NEW_CHOICE_FP("Overlap Handling", OverlapMethod, FilterParameter::Parameter, ImportEbsdMontage, choices, false));
+  }
+  parameters.push_back(SIMPL_NEW_DC_CREATION_FP("Data Container", DataContainerName, FilterParameter::CreatedArray, ImportEbsdMontage));
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::CreatedArray));
   parameters.push_back(SIMPL_NEW_STRING_FP("Cell Attribute Matrix", CellAttributeMatrixName, FilterParameter::CreatedArray, ImportEbsdMontage));
   parameters.push_back(SIMPL_NEW_STRING_FP("Cell Ensemble Attribute Matrix", CellEnsembleAttributeMatrixName, FilterParameter::CreatedArray, ImportEbsdMontage));
@@ -96,55 +131,229 @@ void ImportEbsdMontage::setupFilterParameters()
   setFilterParameters(parameters);
 }
 
+namespace
+{
+/**
+ * @brief One tile of the montage and the reader filter that imports it into a DataContainerArray of its own
+ */
+struct EbsdTile
+{
+  QString fileName;
+  QString dataContainerName;
+  AbstractFilter::Pointer reader;
+  DataContainerArray::Pointer dca;
+};
+using EbsdTileRow = std::vector<EbsdTile>;
+
+/**
+ * @brief Returns the number of cells a tile leaves to its neighbors at its leading and trailing edges
+ * so that every cell of an overlap is taken from exactly one tile
+ */
+std::pair<size_t, size_t> overlapTrim(ImportEbsdMontage::OverlapMethodType method, size_t overlap)
+{
+  switch(method)
+  {
+  case ImportEbsdMontage::OverlapMethodType::KeepFirstTile:
+    return {overlap, 0};
+  case ImportEbsdMontage::OverlapMethodType::KeepLastTile:
+    return {0, overlap};
+  case ImportEbsdMontage::OverlapMethodType::SplitOverlap:
+    break;
+  }
+  return {overlap / 2, overlap - overlap / 2};
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 template <class EbsdReaderClass>
-void readEbsdFile(ImportEbsdMontage* filter, const QString& fileName, std::map<QString, AbstractFilter::Pointer>& prevFilterCache, std::map<QString, AbstractFilter::Pointer>& newFilterCache)
+AbstractFilter::Pointer createTileReader(ImportEbsdMontage* filter, const EbsdTile& tile, std::map<QString, AbstractFilter::Pointer>& prevFilterCache)
 {
-  QFileInfo fi(fileName);
-  QString fname = fi.completeBaseName();
-  if(filter->getDataContainerArray()->doesDataContainerExist(fname))
-  {
-    QString msg = QString("Error: DataContainer '%1' already exists in the DataContainerArray.").arg(fname);
-    filter->setErrorCondition(-74000, msg);
-    return;
-  }
-
-  DataContainerArray::Pointer dca = DataContainerArray::New();
-
   typename EbsdReaderClass::Pointer reader = EbsdReaderClass::NullPointer();
-  if(prevFilterCache.find(fileName) != prevFilterCache.end())
+  if(prevFilterCache.find(tile.fileName) != prevFilterCache.end())
   {
-    reader = std::dynamic_pointer_cast<EbsdReaderClass>(prevFilterCache[fileName]);
+    reader = std::dynamic_pointer_cast<EbsdReaderClass>(prevFilterCache[tile.fileName]);
   }
   else
   {
     reader = EbsdReaderClass::New();
-    reader->setInputFile(fileName);
-    reader->setDataContainerName(fname);
+    reader->setInputFile(tile.fileName);
+    reader->setDataContainerName(tile.dataContainerName);
   }
-  newFilterCache[fileName] = reader;
-  reader->setDataContainerArray(dca);
   reader->setCellEnsembleAttributeMatrixName(filter->getCellEnsembleAttributeMatrixName());
   reader->setCellAttributeMatrixName(filter->getCellAttributeMatrixName());
+  return reader;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void readEbsdFile(ImportEbsdMontage* filter, EbsdTile& tile)
+{
+  // Every tile is read into a DataContainerArray of its own so that tiles can be read at the same time
+  tile.dca = DataContainerArray::New();
+  tile.reader->setDataContainerArray(tile.dca);
   if(filter->getInPreflight())
   {
-    reader->preflight();
+    tile.reader->preflight();
   }
   else
   {
-    reader->execute();
+    tile.reader->execute();
   }
-  if(reader->getErrorCondition() < 0)
+  // The cached reader must not keep the tile data alive
+  tile.reader->setDataContainerArray(DataContainerArray::New());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void stitchTiles(ImportEbsdMontage* filter, std::vector<EbsdTileRow>& tileRows)
+{
+  DataContainer::Pointer firstDc = tileRows[0][0].dca->getDataContainer(tileRows[0][0].dataContainerName);
+  ImageGeom::Pointer firstGeom = firstDc->getGeometryAs<ImageGeom>();
+  SizeVec3Type tileDims = firstGeom->getDimensions();
+  FloatVec3Type spacing = firstGeom->getSpacing();
+  size_t overlap = static_cast<size_t>(filter->getTileOverlap());
+
+  // The tiles are laid out on a regular grid so every tile must have the same size
+  for(const EbsdTileRow& tileRow : tileRows)
+  {
+    for(const EbsdTile& tile : tileRow)
+    {
+      ImageGeom::Pointer imageGeom = tile.dca->getDataContainer(tile.dataContainerName)->getGeometryAs<ImageGeom>();
+      SizeVec3Type dims = imageGeom->getDimensions();
+      FloatVec3Type res = imageGeom->getSpacing();
+      if(dims[0] != tileDims[0] || dims[1] != tileDims[1] || res[0] != spacing[0] || res[1] != spacing[1])
+      {
+        QString msg = QString("All tiles must have the same dimensions and resolution to be stitched. Tile '%1' is %2 x %3 but the first tile is %4 x %5.")
+                          .arg(tile.fileName)
+                          .arg(dims[0])
+                          .arg(dims[1])
+                          .arg(tileDims[0])
+                          .arg(tileDims[1]);
+        filter->setErrorCondition(-74002, msg);
+        return;
+      }
+    }
+  }
+  if(overlap >= tileDims[0] || overlap >= tileDims[1])
+  {
+    QString msg = QString("The tile overlap (%1) must be smaller than the tiles, which are %2 x %3.").arg(overlap).arg(tileDims[0]).arg(tileDims[1]);
+    filter->setErrorCondition(-74003, msg);
+    return;
+  }
+
+  // The stitched image keeps the ensemble data of the first tile, so every tile must index the same phases.
+  // The phases are only read when the filter executes.
+  if(!filter->getInPreflight())
+  {
+    AttributeMatrix::Pointer firstEnsembleAttrMat = firstDc->getAttributeMatrix(filter->getCellEnsembleAttributeMatrixName());
+    UInt32ArrayType::Pointer firstCrystalStructures = firstEnsembleAttrMat->getAttributeArrayAs<UInt32ArrayType>(SIMPL::EnsembleData::CrystalStructures);
+    for(const EbsdTileRow& tileRow : tileRows)
+    {
+      for(const EbsdTile& tile : tileRow)
+      {
+        AttributeMatrix::Pointer ensembleAttrMat = tile.dca->getDataContainer(tile.dataContainerName)->getAttributeMatrix(filter->getCellEnsembleAttributeMatrixName());
+        UInt32ArrayType::Pointer crystalStructures = ensembleAttrMat->getAttributeArrayAs<UInt32ArrayType>(SIMPL::EnsembleData::CrystalStructures);
+        bool samePhases = (nullptr != firstCrystalStructures && nullptr != crystalStructures && crystalStructures->getNumberOfTuples() == firstCrystalStructures->getNumberOfTuples());
+        for(size_t i = 0; samePhases && i < crystalStructures->getNumberOfTuples(); i++)
+        {
+          samePhases = (crystalStructures->getValue(i) == firstCrystalStructures->getValue(i));
+        }
+        if(!samePhases)
+        {
+          QString msg = QString("All tiles must have the same phases to be stitched. The phases or crystal structures of tile '%1' do not match those of the first tile '%2'.")
+                            .arg(tile.fileName)
+                            .arg(tileRows[0][0].fileName);
+          filter->setErrorCondition(-74005, msg);
+          return;
+        }
+      }
+    }
+  }
+
+  size_t numRows = tileRows.size();
+  size_t numCols = tileRows[0].size();
+  size_t xStep = tileDims[0] - overlap;
+  size_t yStep = tileDims[1] - overlap;
+  SizeVec3Type dims(numCols * xStep + overlap, numRows * yStep + overlap, 1);
+
+  DataContainer::Pointer m = filter->getDataContainerArray()->createNonPrereqDataContainer<AbstractFilter>(filter, filter->getDataContainerName(), DataContainerID);
+  if(filter->getErrorCode() < 0)
+  {
+    return;
+  }
+  ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+  image->setDimensions(dims);
+  image->setSpacing(spacing);
+  image->setOrigin(firstGeom->getOrigin());
+  image->setUnits(firstGeom->getUnits());
+  m->setGeometry(image);
+
+  QVector<size_t> tDims = {dims[0], dims[1], dims[2]};
+  AttributeMatrix::Pointer cellAttrMat = m->createNonPrereqAttributeMatrix(filter, filter->getCellAttributeMatrixName(), tDims, AttributeMatrix::Type::Cell, AttributeMatrixID21);
+  if(filter->getErrorCode() < 0)
   {
-    QString msg = QString("Sub filter (%1) caused an error during preflight.").arg(reader->getHumanLabel());
-    filter->setErrorCondition(reader->getErrorCondition(), msg);
     return;
   }
+  // The stitched image gets every cell array of the tiles and the phases of the first tile
+  AttributeMatrix::Pointer firstCellAttrMat = firstDc->getAttributeMatrix(filter->getCellAttributeMatrixName());
+  QList<QString> arrayNames = firstCellAttrMat->getAttributeArrayNames();
+  for(const QString& name : arrayNames)
+  {
+    IDataArray::Pointer tileArray = firstCellAttrMat->getAttributeArray(name);
+    cellAttrMat->insertOrAssign(tileArray->createNewArray(cellAttrMat->getNumberOfTuples(), tileArray->getComponentDimensions(), name, !filter->getInPreflight()));
+  }
+  m->addOrReplaceAttributeMatrix(firstDc->getAttributeMatrix(filter->getCellEnsembleAttributeMatrixName()));
+
+  if(filter->getInPreflight())
+  {
+    return;
+  }
+
+  std::pair<size_t, size_t> trim = overlapTrim(static_cast<ImportEbsdMontage::OverlapMethodType>(filter->getOverlapMethod()), overlap);
 
-  DataContainer::Pointer dc = dca->getDataContainer(fname);
-  filter->getDataContainerArray()->addDataContainer(dc);
+  // Every cell of the stitched image comes from exactly one tile so the tiles can be copied at the same time
+  auto copyTile = [&](size_t tileIndex) {
+    size_t row = tileIndex / numCols;
+    size_t col = tileIndex % numCols;
+    EbsdTile& tile = tileRows[row][col];
+    AttributeMatrix::Pointer tileCellAttrMat = tile.dca->getDataContainer(tile.dataContainerName)->getAttributeMatrix(filter->getCellAttributeMatrixName());
+
+    size_t xBegin = col > 0 ? trim.first : 0;
+    size_t xEnd = col + 1 < numCols ? tileDims[0] - trim.second : tileDims[0];
+    size_t yBegin = row > 0 ? trim.first : 0;
+    size_t yEnd = row + 1 < numRows ? tileDims[1] - trim.second : tileDims[1];
+    for(const QString& name : arrayNames)
+    {
+      IDataArray::Pointer destArray = cellAttrMat->getAttributeArray(name);
+      IDataArray::Pointer tileArray = tileCellAttrMat->getAttributeArray(name);
+      for(size_t y = yBegin; y < yEnd; y++)
+      {
+        size_t destTuple = (row * yStep + y) * dims[0] + col * xStep + xBegin;
+        destArray->copyFromArray(destTuple, tileArray, y * tileDims[0] + xBegin, xEnd - xBegin);
+      }
+    }
+    // The tile is not needed any more once it is part of the stitched image
+    tile.dca = DataContainerArray::NullPointer();
+  };
+
+  size_t numTiles = numRows * numCols;
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, numTiles, 1), [&copyTile](const tbb::blocked_range<size_t>& r) {
+    for(size_t tileIndex = r.begin(); tileIndex < r.end(); tileIndex++)
+    {
+      copyTile(tileIndex);
+    }
+  });
+#else
+  for(size_t tileIndex = 0; tileIndex < numTiles; tileIndex++)
+  {
+    copyTile(tileIndex);
+  }
+#endif
 }
 
 // -----------------------------------------------------------------------------
@@ -154,7 +363,6 @@ void ImportEbsdMontage::dataCheck()
 {
   clearErrorCode();
   clearWarningCode();
-  clearWarningCode();
 
   DataArrayPath tempPath;
   QString ss;
@@ -191,70 +399,151 @@ void ImportEbsdMontage::dataCheck()
     return;
   }
 
+  if(m_TileOverlap < 0)
+  {
+    ss = QObject::tr("The tile overlap must be zero or greater");
+    setErrorCondition(-74004, ss);
+    return;
+  }
+
   int32_t numRows = tileLayout2d.size();
   int32_t numCols = tileLayout2d[0].size();
   int32_t totalTiles = numRows * numCols;
   int32_t tilesRead = 0;
 
-  std::array<double, 2> globalTileOrigin = {{0.0, 0.0}};
-
-  std::map<QString, AbstractFilter::Pointer> oldCache = m_FilterCache;
-
   std::map<QString, AbstractFilter::Pointer> newFilterCache;
 
+  // Set up a reader for every tile. This is quick and is done one tile at a time.
+  std::vector<EbsdTileRow> tileRows;
   for(const FilePathGenerator::TileRCIndexRow2D& tileRow2D : tileLayout2d)
   {
-    globalTileOrigin[0] = 0.0; // Reset the X Coord back to Zero for each row.
-    double tileHeight = 0.0;
+    EbsdTileRow tileRow;
     for(const FilePathGenerator::TileRCIndex2D& tile2D : tileRow2D)
     {
-      QFileInfo fi(tile2D.FileName);
-      QString fname = fi.completeBaseName();
+      EbsdTile tile;
+      tile.fileName = tile2D.FileName;
+      tile.dataContainerName = QFileInfo(tile2D.FileName).completeBaseName();
+      if(!m_StitchTiles && getDataContainerArray()->doesDataContainerExist(tile.dataContainerName))
+      {
+        QString msg = QString("Error: DataContainer '%1' already exists in the DataContainerArray.").arg(tile.dataContainerName);
+        setErrorCondition(-74000, msg);
+        return;
+      }
 
       if(m_InputFileListInfo.FileExtension == Ebsd::Ang::FileExt)
       {
-        readEbsdFile<ReadAngData>(this, tile2D.FileName, m_FilterCache, newFilterCache);
+        tile.reader = createTileReader<ReadAngData>(this, tile, m_FilterCache);
       }
-      if(m_InputFileListInfo.FileExtension == Ebsd::Ctf::FileExt)
+      else if(m_InputFileListInfo.FileExtension == Ebsd::Ctf::FileExt)
       {
-        readEbsdFile<ReadCtfData>(this, tile2D.FileName, m_FilterCache, newFilterCache);
+        tile.reader = createTileReader<ReadCtfData>(this, tile, m_FilterCache);
       }
-      if(getErrorCondition() >= 0)
+      else
       {
-        DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(fname);
-        ImageGeom::Pointer imageGeom = dc->getGeometryAs<ImageGeom>();
-
-        std::array<size_t, 3> dims = {{0, 0, 0}};
-        std::tie(dims[0], dims[1], dims[2]) = imageGeom->getDimensions();
-        std::array<float, 3> res = {{0.0f, 0.0f, 0.0f}};
-        std::tie(res[0], res[1], res[2]) = imageGeom->getResolution();
-        std::array<float, 3> origin = {{0.0f, 0.0f, 0.0f}};
-        std::tie(origin[0], origin[1], origin[2]) = imageGeom->getOrigin();
-
-        //
-        origin[0] = globalTileOrigin[0];
-        origin[1] = globalTileOrigin[1];
-        imageGeom->setOrigin(origin.data());
-
-        // Now update the globalTileOrigin values
-        globalTileOrigin[0] += origin[0] + (dims[0] * res[0]);
-        tileHeight = (dims[1] * res[1]);
-
-        if(getCancel())
-        {
-          return;
-        }
-        tilesRead++;
-        if(!getInPreflight())
-        {
-          QString msg = QString("==> [%1/%2] %3").arg(tilesRead).arg(totalTiles).arg(tile2D.FileName);
-          notifyStatusMessage(msg);
-        }
+        QString msg = QString("Error: Files with the extension '%1' can not be imported. The files must be .%2 or .%3 files.")
+                          .arg(m_InputFileListInfo.FileExtension)
+                          .arg(Ebsd::Ang::FileExt)
+                          .arg(Ebsd::Ctf::FileExt);
+        setErrorCondition(-74001, msg);
+        return;
+      }
+      newFilterCache[tile.fileName] = tile.reader;
+      tileRow.push_back(tile);
+    }
+    tileRows.push_back(tileRow);
+  }
+
+  // Read the tiles. The tiles are independent of each other so they can be read at the same time.
+  std::vector<EbsdTile*> tiles;
+  for(EbsdTileRow& tileRow : tileRows)
+  {
+    for(EbsdTile& tile : tileRow)
+    {
+      tiles.push_back(&tile);
+    }
+  }
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  if(m_ReadTilesInParallel)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, tiles.size(), 1), [this, &tiles](const tbb::blocked_range<size_t>& r) {
+      for(size_t i = r.begin(); i < r.end() && !getCancel(); i++)
+      {
+        readEbsdFile(this, *tiles[i]);
+      }
+    });
+  }
+  else
+#endif
+  {
+    for(EbsdTile* tile : tiles)
+    {
+      readEbsdFile(this, *tile);
+      if(getCancel())
+      {
+        return;
+      }
+    }
+  }
+  if(getCancel())
+  {
+    return;
+  }
+
+  // Place the tiles in the global reference frame, one after the other
+  std::array<float, 2> globalTileOrigin = {{0.0f, 0.0f}};
+  for(EbsdTileRow& tileRow : tileRows)
+  {
+    globalTileOrigin[0] = 0.0f; // Reset the X Coord back to Zero for each row.
+    float tileHeight = 0.0f;
+    for(EbsdTile& tile : tileRow)
+    {
+      if(tile.reader->getErrorCode() < 0)
+      {
+        QString msg = QString("Sub filter (%1) caused an error during preflight.").arg(tile.reader->getHumanLabel());
+        setErrorCondition(tile.reader->getErrorCode(), msg);
+        return;
+      }
+
+      DataContainer::Pointer dc = tile.dca->getDataContainer(tile.dataContainerName);
+      ImageGeom::Pointer imageGeom = dc->getGeometryAs<ImageGeom>();
+
+      SizeVec3Type dims = imageGeom->getDimensions();
+      FloatVec3Type res = imageGeom->getSpacing();
+      FloatVec3Type origin = imageGeom->getOrigin();
+
+      origin[0] = globalTileOrigin[0];
+      origin[1] = globalTileOrigin[1];
+      imageGeom->setOrigin(origin);
+
+      // Now update the globalTileOrigin values. Neighboring tiles share TileOverlap cells.
+      globalTileOrigin[0] += (dims[0] - m_TileOverlap) * res[0];
+      tileHeight = (dims[1] - m_TileOverlap) * res[1];
+
+      if(!m_StitchTiles)
+      {
+        getDataContainerArray()->addDataContainer(dc);
+      }
+
+      tilesRead++;
+      if(!getInPreflight())
+      {
+        QString msg = QString("==> [%1/%2] %3").arg(tilesRead).arg(totalTiles).arg(tile.fileName);
+        notifyStatusMessage(msg);
       }
     }
     globalTileOrigin[1] += tileHeight;
   }
 
+  if(m_StitchTiles)
+  {
+    stitchTiles(this, tileRows);
+    if(getErrorCode() < 0)
+    {
+      return;
+    }
+  }
+
   m_FilterCache = newFilterCache; // Swap our maps. This dumps any previous instantiations of the reader filter that are not used any more.
   clearWarningCode();
 }
@@ -72,6 +72,28 @@ public:
   SIMPL_FILTER_PARAMETER(EbsdMontageListInfo_t, InputFileListInfo)
   Q_PROPERTY(EbsdMontageListInfo_t InputFileListInfo READ getInputFileListInfo WRITE setInputFileListInfo)
 
+  SIMPL_FILTER_PARAMETER(bool, ReadTilesInParallel)
+  Q_PROPERTY(bool ReadTilesInParallel READ getReadTilesInParallel WRITE setReadTilesInParallel)
+
+  SIMPL_FILTER_PARAMETER(int, TileOverlap)
+  Q_PROPERTY(int TileOverlap READ getTileOverlap WRITE setTileOverlap)
+
+  SIMPL_FILTER_PARAMETER(bool, StitchTiles)
+  Q_PROPERTY(bool StitchTiles READ getStitchTiles WRITE setStitchTiles)
+
+  SIMPL_FILTER_PARAMETER(int, OverlapMethod)
+  Q_PROPERTY(int OverlapMethod READ getOverlapMethod WRITE setOverlapMethod)
+
+  /**
+   * @brief The ways the cells where two tiles overlap are filled in when the tiles are stitched
+   */
+  enum class OverlapMethodType : int
+  {
+    KeepFirstTile = 0,
+    KeepLastTile = 1,
+    SplitOverlap = 2
+  };
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
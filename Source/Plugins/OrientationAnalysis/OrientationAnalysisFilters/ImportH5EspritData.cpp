@@ -144,31 +144,14 @@ void ImportH5EspritData::execute()
     return;
   }
 
-  H5EspritReader::Pointer reader = H5EspritReader::New();
-  reader->setFileName(getInputFile());
-  QVector<size_t> tDims(3, 0);
-  QVector<size_t> cDims(1, 1);
   DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getDataContainerName());
   AttributeMatrix::Pointer ebsdAttrMat = m->getAttributeMatrix(getCellAttributeMatrixName());
   ebsdAttrMat->setType(AttributeMatrix::Type::Cell);
 
-  QStringList scanNames = getSelectedScanNames();
-
-  for(int index = 0; index < scanNames.size(); index++)
+  readScans();
+  if(getErrorCode() < 0 || getCancel())
   {
-    QString currentScanName = scanNames[index];
-
-    readDataFile(reader.get(), m.get(), tDims, currentScanName, ANG_FULL_FILE);
-    if(getErrorCode() < 0)
-    {
-      return;
-    }
-
-    copyRawEbsdData(reader.get(), tDims, cDims, index);
-    if(getErrorCode() < 0)
-    {
-      return;
-    }
+    return;
   }
 
   // Set the file name and time stamp into the cache, if we are reading from the file and after all the reading has been done
@@ -459,7 +442,9 @@ void ImportH5EspritData::readDataFile(EbsdReader* ebsdReader, DataContainer* m,
     float xOrigin = getOrigin()[0];
     float yOrigin = getOrigin()[1];
     float zOrigin = getOrigin()[2];
-    reader->setReadPatternData(getReadPatternData());
+    // The patterns themselves are streamed from the file in copyRawEbsdData() so the reader only
+    // needs to know about them while reading the header
+    reader->setReadPatternData(getReadPatternData() && flag == ANG_HEADER_ONLY);
 
     // If the user has already set a Scan Name to read then we are good to go.
     reader->setHDF5Path(scanName);
@@ -621,8 +606,15 @@ template <typename T, class Reader>
 void copyPointerData(Reader* reader, const QString& name, const IDataArray::Pointer& dataArray, size_t offset, size_t totalPoints, AttributeMatrix::Pointer& ebsdAttrMat)
 {
   using DataArrayType = DataArray<T>;
-  // Copy Array from Reader into DataArray<>
   T* ptr = reinterpret_cast<T*>(reader->getPointerByName(name));
+  // Several scans are copied into their slices of arrays that hold the whole volume
+  typename DataArrayType::Pointer volumeArray = std::dynamic_pointer_cast<DataArrayType>(ebsdAttrMat->getAttributeArray(dataArray->getName()));
+  if(nullptr != volumeArray)
+  {
+    ::memcpy(volumeArray->getTuplePointer(offset), ptr, sizeof(T) * totalPoints * volumeArray->getNumberOfComponents());
+    return;
+  }
+  // Copy Array from Reader into DataArray<>
   typename DataArrayType::Pointer fArray = std::dynamic_pointer_cast<DataArrayType>(dataArray);
   typename DataArrayType::Pointer freshArray = DataArrayType::WrapPointer(ptr, totalPoints, fArray->getComponentDimensions(), fArray->getName(), true);
   reader->releaseOwnership(name);
@@ -638,25 +630,8 @@ void ImportH5EspritData::copyRawEbsdData(EbsdReader* ebsdReader, QVector<size_t>
   DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getDataContainerName());
   AttributeMatrix::Pointer ebsdAttrMat = m->getAttributeMatrix(getCellAttributeMatrixName());
 
-  ImageGeom::Pointer imageGeom = m->getGeometryAs<ImageGeom>();
-  size_t totalPoints = imageGeom->getXPoints() * imageGeom->getYPoints();
-
-  // Prepare the Cell Attribute Matrix with the correct number of tuples based on the total points being read from the file.
-  tDims.resize(3);
-  tDims[0] = imageGeom->getXPoints();
-  tDims[1] = imageGeom->getYPoints();
-  tDims[2] = imageGeom->getZPoints();
-
-  // Temporarily pull out all the attribute Arrays. This will save us doubling up on memory
-  QList<QString> arrayNames = ebsdAttrMat->getAttributeArrayNames();
-  std::map<QString, IDataArray::Pointer> arrays;
-  for(const auto& name : arrayNames)
-  {
-    arrays[name] = ebsdAttrMat->removeAttributeArray(name);
-  }
-
-  // Now resize the AttributeMatrix.
-  ebsdAttrMat->resizeAttributeArrays(tDims);
+  // Only the dimensions read with this scan are used, the geometry holds those of the whole volume
+  size_t totalPoints = tDims[0] * tDims[1];
 
   size_t offset = index * totalPoints;
 
@@ -688,7 +663,10 @@ void ImportH5EspritData::copyRawEbsdData(EbsdReader* ebsdReader, QVector<size_t>
       cellEulerAngles[3 * i + 1] = f2[i] * degToRad;
       cellEulerAngles[3 * i + 2] = f3[i] * degToRad;
     }
-    ebsdAttrMat->insertOrAssign(fArray);
+    if(nullptr == ebsdAttrMat->getAttributeArray(fArray->getName()))
+    {
+      ebsdAttrMat->insertOrAssign(fArray);
+    }
   }
   else
   {
@@ -698,9 +676,9 @@ void ImportH5EspritData::copyRawEbsdData(EbsdReader* ebsdReader, QVector<size_t>
     auto f3 = reinterpret_cast<float*>(reader->getPointerByName(Ebsd::H5Esprit::phi2));
     for(size_t i = 0; i < totalPoints; i++)
     {
-      f1[3 * i] = f1[i] * degToRad;
-      f2[3 * i + 1] = f2[i] * degToRad;
-      f3[3 * i + 2] = f3[i] * degToRad;
+      f1[i] = f1[i] * degToRad;
+      f2[i] = f2[i] * degToRad;
+      f3[i] = f3[i] * degToRad;
     }
 
     copyPointerData<Ebsd::H5Esprit::phi1_t, H5EspritReader>(reader, Ebsd::H5Esprit::phi1, ebsdArrayMap.value(Ebsd::H5Esprit::phi1), offset, totalPoints, ebsdAttrMat);
@@ -724,9 +702,98 @@ void ImportH5EspritData::copyRawEbsdData(EbsdReader* ebsdReader, QVector<size_t>
   copyPointerData<Ebsd::H5Esprit::YBEAM_t, H5EspritReader>(reader, Ebsd::H5Esprit::YBEAM, ebsdArrayMap.value(Ebsd::H5Esprit::YBEAM), offset, totalPoints, ebsdAttrMat);
   // copyPointerData<Ebsd::H5Esprit::XSAMPLE_t, H5EspritReader>(reader, Ebsd::H5Esprit::XSAMPLE, ebsdArrayMap.value(Ebsd::H5Esprit::XSAMPLE), offset, totalPoints, ebsdAttrMat);
   // copyPointerData<Ebsd::H5Esprit::YSAMPLE_t, H5EspritReader>(reader, Ebsd::H5Esprit::YSAMPLE, ebsdArrayMap.value(Ebsd::H5Esprit::YSAMPLE), offset, totalPoints, ebsdAttrMat);
+}
 
-  if(getReadPatternData()) // Get the pattern Data from the
+// -----------------------------------------------------------------------------
+EbsdReader::Pointer ImportH5EspritData::createScanReader() const
+{
+  H5EspritReader::Pointer reader = H5EspritReader::New();
+  reader->setFileName(getInputFile());
+  return reader;
+}
+
+// -----------------------------------------------------------------------------
+void ImportH5EspritData::prepareCellArrays()
+{
+  DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getDataContainerName());
+  AttributeMatrix::Pointer ebsdAttrMat = m->getAttributeMatrix(getCellAttributeMatrixName());
+  ImageGeom::Pointer imageGeom = m->getGeometryAs<ImageGeom>();
+
+  // Prepare the Cell Attribute Matrix with the correct number of tuples for all of the scans
+  QVector<size_t> tDims(3, 0);
+  tDims[0] = imageGeom->getXPoints();
+  tDims[1] = imageGeom->getYPoints();
+  tDims[2] = imageGeom->getZPoints();
+
+  // Temporarily pull out all the attribute Arrays. This will save us doubling up on memory
+  QList<QString> arrayNames = ebsdAttrMat->getAttributeArrayNames();
+  std::map<QString, IDataArray::Pointer> arrays;
+  for(const auto& name : arrayNames)
   {
-    copyPointerData<Ebsd::H5Esprit::RawPatterns_t, H5EspritReader>(reader, Ebsd::H5Esprit::RawPatterns, ebsdArrayMap.value(Ebsd::H5Esprit::RawPatterns), offset, totalPoints, ebsdAttrMat);
+    arrays[name] = ebsdAttrMat->removeAttributeArray(name);
+  }
+
+  // Now resize the AttributeMatrix.
+  ebsdAttrMat->resizeAttributeArrays(tDims);
+
+  // A single scan is handed over from its reader in copyRawEbsdData()
+  if(getSelectedScanNames().size() < 2)
+  {
+    return;
+  }
+
+  // Several scans are copied into their slices of arrays that hold the whole volume
+  size_t numTuples = tDims[0] * tDims[1] * tDims[2];
+  for(const auto& array : arrays)
+  {
+    IDataArray::Pointer volumeArray = array.second;
+    if(!volumeArray->isAllocated())
+    {
+      volumeArray = volumeArray->createNewArray(numTuples, volumeArray->getComponentDimensions(), volumeArray->getName(), true);
+    }
+    ebsdAttrMat->insertOrAssign(volumeArray);
+  }
+}
+
+// -----------------------------------------------------------------------------
+void ImportH5EspritData::copyPatternData(EbsdReader* ebsdReader, int index)
+{
+  if(!getReadPatternData())
+  {
+    return;
+  }
+  UInt8ArrayType::Pointer patternArray = std::dynamic_pointer_cast<UInt8ArrayType>(getEbsdArrayMap().value(Ebsd::H5Esprit::RawPatterns));
+  if(nullptr == patternArray)
+  {
+    return;
+  }
+
+  auto reader = dynamic_cast<H5EspritReader*>(ebsdReader);
+  DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getDataContainerName());
+  AttributeMatrix::Pointer ebsdAttrMat = m->getAttributeMatrix(getCellAttributeMatrixName());
+  ImageGeom::Pointer imageGeom = m->getGeometryAs<ImageGeom>();
+  size_t totalPoints = imageGeom->getXPoints() * imageGeom->getYPoints();
+
+  // Stream the pattern data from the file into the pattern array
+  H5EbsdPatternReader::Pointer patternReader = reader->openPatternData();
+  if(nullptr == patternReader)
+  {
+    setErrorCondition(reader->getErrorCode(), reader->getErrorMessage());
+    return;
+  }
+
+  // Several scans are read into their slices of the volume pattern array, a single scan into a fresh array
+  UInt8ArrayType::Pointer patternData = std::dynamic_pointer_cast<UInt8ArrayType>(ebsdAttrMat->getAttributeArray(patternArray->getName()));
+  size_t offset = index * totalPoints;
+  if(nullptr == patternData)
+  {
+    patternData = UInt8ArrayType::CreateArray(totalPoints, patternArray->getComponentDimensions(), patternArray->getName(), true);
+    offset = 0;
+  }
+  int32_t err = readPatternData(patternReader.get(), patternData->getTuplePointer(offset), patternData->getNumberOfComponents(), totalPoints);
+  if(err < 0)
+  {
+    return;
   }
+  ebsdAttrMat->insertOrAssign(patternData);
 }
@@ -125,6 +125,22 @@ protected:
    */
   void copyRawEbsdData(EbsdReader* ebsdReader, QVector<size_t>& tDims, QVector<size_t>& cDims, int index) override;
 
+  /**
+   * @brief createScanReader Reimplemented from @see ImportH5OimData class
+   */
+  EbsdReader::Pointer createScanReader() const override;
+
+  /**
+   * @brief prepareCellArrays Reimplemented from @see ImportH5OimData class. A single scan is handed over
+   * from its reader without a copy so only several scans need arrays that hold the whole volume.
+   */
+  void prepareCellArrays() override;
+
+  /**
+   * @brief copyPatternData Reimplemented from @see ImportH5OimData class
+   */
+  void copyPatternData(EbsdReader* ebsdReader, int index) override;
+
   /**
    * @brief loadMaterialInfo Reads the values for the phase type, crystal structure
    * and precipitate fractions from the EBSD file
@@ -35,6 +35,8 @@
 
 #include "ImportH5OimData.h"
 
+#include <algorithm>
+
 #include <QtCore/QDateTime>
 #include <QtCore/QFileInfo>
 
@@ -44,6 +46,7 @@
 #include "H5Support/QH5Lite.h"
 
 #include "EbsdLib/BrukerNano/EspritConstants.h"
+#include "EbsdLib/H5EbsdPatternReader.h"
 #include "EbsdLib/TSL/AngFields.h"
 #include "EbsdLib/TSL/H5OIMReader.h"
 
@@ -284,7 +287,9 @@ void ImportH5OimData::readDataFile(EbsdReader* ebsdReader, DataContainer* m, QVe
   if(m_InputFile != getInputFile_Cache() || !getTimeStamp_Cache().isValid() || getTimeStamp_Cache() < timeStamp)
   {
     float zStep = static_cast<float>(getZSpacing()), xOrigin = getOrigin()[0], yOrigin = getOrigin()[1], zOrigin = getOrigin()[2];
-    reader->setReadPatternData(getReadPatternData());
+    // The patterns themselves are streamed from the file in copyRawEbsdData() so the reader only
+    // needs to know about them while reading the header
+    reader->setReadPatternData(getReadPatternData() && flag == ANG_HEADER_ONLY);
 
     // If the user has already set a Scan Name to read then we are good to go.
     reader->setHDF5Path(scanName);
@@ -457,19 +462,8 @@ void ImportH5OimData::copyRawEbsdData(EbsdReader* ebsdReader, QVector<size_t>& t
   FloatArrayType::Pointer fArray = FloatArrayType::NullPointer();
   Int32ArrayType::Pointer iArray = Int32ArrayType::NullPointer();
 
-  DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getDataContainerName());
-  AttributeMatrix::Pointer ebsdAttrMat = m->getAttributeMatrix(getCellAttributeMatrixName());
-
-  ImageGeom::Pointer imageGeom = m->getGeometryAs<ImageGeom>();
-
-  size_t totalPoints = imageGeom->getXPoints() * imageGeom->getYPoints();
-
-  // Prepare the Cell Attribute Matrix with the correct number of tuples based on the total points being read from the file.
-  tDims.resize(3);
-  tDims[0] = imageGeom->getXPoints();
-  tDims[1] = imageGeom->getYPoints();
-  tDims[2] = imageGeom->getZPoints();
-  ebsdAttrMat->resizeAttributeArrays(tDims);
+  // Only the dimensions read with this scan are used, the geometry holds those of the whole volume
+  size_t totalPoints = tDims[0] * tDims[1];
 
   size_t offset = index * totalPoints;
 
@@ -484,7 +478,6 @@ void ImportH5OimData::copyRawEbsdData(EbsdReader* ebsdReader, QVector<size_t>& t
   }
   iArray = std::dynamic_pointer_cast<Int32ArrayType>(m_EbsdArrayMap.value(SIMPL::CellData::Phases));
   ::memcpy(iArray->getPointer(offset), phasePtr, sizeof(int32_t) * totalPoints);
-  ebsdAttrMat->insertOrAssign(iArray);
 
   // Condense the Euler Angles from 3 separate arrays into a single 1x3 array
   {
@@ -501,7 +494,6 @@ void ImportH5OimData::copyRawEbsdData(EbsdReader* ebsdReader, QVector<size_t>& t
       cellEulerAngles[3 * i + 1] = f2[i];
       cellEulerAngles[3 * i + 2] = f3[i];
     }
-    ebsdAttrMat->insertOrAssign(fArray);
   }
 
   cDims[0] = 1;
@@ -509,95 +501,189 @@ void ImportH5OimData::copyRawEbsdData(EbsdReader* ebsdReader, QVector<size_t>& t
     f1 = reinterpret_cast<float*>(reader->getPointerByName(Ebsd::Ang::ImageQuality));
     fArray = std::dynamic_pointer_cast<FloatArrayType>(m_EbsdArrayMap.value(Ebsd::Ang::ImageQuality));
     ::memcpy(fArray->getPointer(offset), f1, sizeof(float) * totalPoints);
-    ebsdAttrMat->insertOrAssign(fArray);
   }
 
   {
     f1 = reinterpret_cast<float*>(reader->getPointerByName(Ebsd::Ang::ConfidenceIndex));
     fArray = std::dynamic_pointer_cast<FloatArrayType>(m_EbsdArrayMap.value(Ebsd::Ang::ConfidenceIndex));
     ::memcpy(fArray->getPointer(offset), f1, sizeof(float) * totalPoints);
-    ebsdAttrMat->insertOrAssign(fArray);
   }
 
   {
     f1 = reinterpret_cast<float*>(reader->getPointerByName(Ebsd::Ang::SEMSignal));
     fArray = std::dynamic_pointer_cast<FloatArrayType>(m_EbsdArrayMap.value(Ebsd::Ang::SEMSignal));
     ::memcpy(fArray->getPointer(offset), f1, sizeof(float) * totalPoints);
-    ebsdAttrMat->insertOrAssign(fArray);
   }
 
   {
     f1 = reinterpret_cast<float*>(reader->getPointerByName(Ebsd::Ang::Fit));
     fArray = std::dynamic_pointer_cast<FloatArrayType>(m_EbsdArrayMap.value(Ebsd::Ang::Fit));
     ::memcpy(fArray->getPointer(offset), f1, sizeof(float) * totalPoints);
-    ebsdAttrMat->insertOrAssign(fArray);
   }
 
-  if(getReadPatternData()) // Get the pattern Data from the
-  {
-    uint8_t* ptr = reader->getPatternData();
-    std::array<int32_t, 2> pDims = {{0, 0}};
-    reader->getPatternDims(pDims);
+}
 
-    if(pDims[0] != 0 && pDims[1] != 0)
-    {
-      QVector<size_t> pDimsV(2);
-      pDimsV[0] = pDims[0];
-      pDimsV[1] = pDims[1];
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+EbsdReader::Pointer ImportH5OimData::createScanReader() const
+{
+  H5OIMReader::Pointer reader = H5OIMReader::New();
+  reader->setFileName(m_InputFile);
+  return reader;
+}
 
-      UInt8ArrayType::Pointer patternData = std::dynamic_pointer_cast<UInt8ArrayType>(m_EbsdArrayMap.value(Ebsd::Ang::PatternData));
-      ::memcpy(patternData->getPointer(offset), ptr, sizeof(uint8_t) * totalPoints);
-      ebsdAttrMat->insertOrAssign(patternData);
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ImportH5OimData::prepareCellArrays()
+{
+  DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getDataContainerName());
+  AttributeMatrix::Pointer ebsdAttrMat = m->getAttributeMatrix(getCellAttributeMatrixName());
+  ImageGeom::Pointer imageGeom = m->getGeometryAs<ImageGeom>();
 
-      // Remove the current PatternData array
-      ebsdAttrMat->removeAttributeArray(Ebsd::Ang::PatternData);
+  // Prepare the Cell Attribute Matrix with the correct number of tuples for all of the scans
+  QVector<size_t> tDims(3, 0);
+  tDims[0] = imageGeom->getXPoints();
+  tDims[1] = imageGeom->getYPoints();
+  tDims[2] = imageGeom->getZPoints();
+  ebsdAttrMat->resizeAttributeArrays(tDims);
+}
 
-      // Push in our own PatternData array
-      ebsdAttrMat->insertOrAssign(patternData);
-      // Set the readers pattern data pointer to nullptr so that reader does not "free" the memory
-      reader->setPatternData(nullptr);
-    }
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ImportH5OimData::copyPatternData(EbsdReader* ebsdReader, int index)
+{
+  if(!getReadPatternData())
+  {
+    return;
+  }
+  UInt8ArrayType::Pointer patternData = std::dynamic_pointer_cast<UInt8ArrayType>(m_EbsdArrayMap.value(Ebsd::Ang::PatternData));
+  if(nullptr == patternData)
+  {
+    return;
+  }
+
+  auto reader = dynamic_cast<H5OIMReader*>(ebsdReader);
+  ImageGeom::Pointer imageGeom = getDataContainerArray()->getDataContainer(getDataContainerName())->getGeometryAs<ImageGeom>();
+  size_t totalPoints = imageGeom->getXPoints() * imageGeom->getYPoints();
+
+  // Stream the pattern data from the file into the pattern array
+  H5EbsdPatternReader::Pointer patternReader = reader->openPatternData();
+  if(nullptr == patternReader)
+  {
+    setErrorCondition(reader->getErrorCode(), reader->getErrorMessage());
+    return;
   }
+  readPatternData(patternReader.get(), patternData->getTuplePointer(index * totalPoints), patternData->getNumberOfComponents(), totalPoints);
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void ImportH5OimData::execute()
+void ImportH5OimData::readScans()
 {
-  clearErrorCode();
-  clearWarningCode();
-  dataCheck();
+  DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getDataContainerName());
+  QStringList scanNames = getSelectedScanNames();
+
+  prepareCellArrays();
   if(getErrorCode() < 0)
   {
     return;
   }
 
-  H5OIMReader::Pointer reader = H5OIMReader::New();
-  reader->setFileName(m_InputFile);
+  EbsdReader::Pointer reader = createScanReader();
   QVector<size_t> tDims(3, 0);
   QVector<size_t> cDims(1, 1);
-  DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getDataContainerName());
-  AttributeMatrix::Pointer ebsdAttrMat = m->getAttributeMatrix(getCellAttributeMatrixName());
-  ebsdAttrMat->setType(AttributeMatrix::Type::Cell);
-
-  QStringList scanNames = getSelectedScanNames();
-
   for(int index = 0; index < scanNames.size(); index++)
   {
-    QString currentScanName = scanNames[index];
-
-    readDataFile(reader.get(), m.get(), tDims, currentScanName, ANG_FULL_FILE);
+    QString ss = QObject::tr("Reading Scan %1 of %2: %3").arg(index + 1).arg(scanNames.size()).arg(scanNames[index]);
+    notifyStatusMessage(ss);
+    readDataFile(reader.get(), m.get(), tDims, scanNames[index], ANG_FULL_FILE);
     if(getErrorCode() < 0)
     {
       return;
     }
-
     copyRawEbsdData(reader.get(), tDims, cDims, index);
     if(getErrorCode() < 0)
     {
       return;
     }
+    copyPatternData(reader.get(), index);
+    if(getErrorCode() < 0 || getCancel())
+    {
+      return;
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t ImportH5OimData::readPatternData(H5EbsdPatternReader* patternReader, uint8_t* patterns, size_t patternSize, size_t totalPoints)
+{
+  if(patternReader->getPatternSize() != patternSize || patternReader->getNumberOfPatterns() < totalPoints)
+  {
+    QString ss = QObject::tr("The pattern data holds %1 patterns of %2 values but %3 patterns of %4 values were expected")
+                     .arg(patternReader->getNumberOfPatterns())
+                     .arg(patternReader->getPatternSize())
+                     .arg(totalPoints)
+                     .arg(patternSize);
+    setErrorCondition(-385, ss);
+    return getErrorCode();
+  }
+
+  // Read about 64MB of patterns at a time. For chunked data sets the batch is a whole number of
+  // chunks so that every chunk is decompressed only once.
+  const size_t batchBytes = 64 * 1024 * 1024;
+  size_t batchSize = std::max(batchBytes / std::max(patternSize, static_cast<size_t>(1)), static_cast<size_t>(1));
+  size_t patternsPerChunk = patternReader->getPatternsPerChunk();
+  if(patternsPerChunk > 0)
+  {
+    batchSize = std::max(batchSize / patternsPerChunk, static_cast<size_t>(1)) * patternsPerChunk;
+  }
+
+  for(size_t first = 0; first < totalPoints; first += batchSize)
+  {
+    if(getCancel())
+    {
+      return -1;
+    }
+    size_t count = std::min(batchSize, totalPoints - first);
+    int32_t err = patternReader->readPatterns(first, count, patterns + first * patternSize);
+    if(err < 0)
+    {
+      setErrorCondition(-386, patternReader->getErrorMessage());
+      return getErrorCode();
+    }
+    QString ss = QObject::tr("Reading Patterns %1 of %2").arg(first + count).arg(totalPoints);
+    notifyStatusMessage(ss);
+  }
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ImportH5OimData::execute()
+{
+  clearErrorCode();
+  clearWarningCode();
+  dataCheck();
+  if(getErrorCode() < 0)
+  {
+    return;
+  }
+
+  DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getDataContainerName());
+  AttributeMatrix::Pointer ebsdAttrMat = m->getAttributeMatrix(getCellAttributeMatrixName());
+  ebsdAttrMat->setType(AttributeMatrix::Type::Cell);
+
+  readScans();
+  if(getErrorCode() < 0 || getCancel())
+  {
+    return;
   }
 
   // Set the file name and time stamp into the cache, if we are reading from the file and after all the reading has been done
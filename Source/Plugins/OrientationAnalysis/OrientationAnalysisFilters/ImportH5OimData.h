@@ -42,13 +42,14 @@
 #include "SIMPLib/SIMPLib.h"
 
 #include "EbsdLib/EbsdConstants.h"
+#include "EbsdLib/EbsdReader.h"
 #include "EbsdLib/TSL/AngConstants.h"
 #include "EbsdLib/TSL/AngPhase.h"
 
 #include "OrientationAnalysis/OrientationAnalysisConstants.h"
 #include "OrientationAnalysis/OrientationAnalysisDLLExport.h"
 
-class EbsdReader;
+class H5EbsdPatternReader;
 
 // our PIMPL private class
 class ImportH5OimDataPrivate;
@@ -244,12 +245,46 @@ protected:
   /**
    * @brief copyRawEbsdData Reads the H5OIM file and puts the data into the data container
    * @param reader H5OIMReader instance pointer
-   * @param tDims Tuple dimensions
+   * @param tDims Tuple dimensions that readDataFile() returned for this scan
    * @param cDims Component dimensions
    * @param index Current slice index
    */
   virtual void copyRawEbsdData(EbsdReader* reader, QVector<size_t>& tDims, QVector<size_t>& cDims, int index);
 
+  /**
+   * @brief createScanReader Creates the reader that reads the selected scans from the input file
+   * @return The new reader
+   */
+  virtual EbsdReader::Pointer createScanReader() const;
+
+  /**
+   * @brief prepareCellArrays Sizes the cell arrays for all of the selected scans before any scan is copied
+   */
+  virtual void prepareCellArrays();
+
+  /**
+   * @brief copyPatternData Reads the patterns of a scan into its slice of the pattern array
+   * @param reader Reader that has read the scan
+   * @param index Current slice index
+   */
+  virtual void copyPatternData(EbsdReader* reader, int index);
+
+  /**
+   * @brief readScans Reads the selected scans one after the other into their slices of the cell arrays
+   */
+  void readScans();
+
+  /**
+   * @brief readPatternData Streams the patterns of the current scan into the pattern array in batches
+   * so that the reader never holds all of the patterns of a scan in memory at once
+   * @param patternReader The open pattern data set of the current scan
+   * @param patterns Destination for the patterns of the current scan
+   * @param patternSize Number of values in each pattern
+   * @param totalPoints Number of scan points in the current scan
+   * @return Integer error value
+   */
+  int32_t readPatternData(H5EbsdPatternReader* patternReader, uint8_t* patterns, size_t patternSize, size_t totalPoints);
+
   /**
    * @brief loadMaterialInfo Reads the values for the phase type, crystal structure
    * and precipitate fractions from the EBSD file
@@ -77,6 +77,11 @@ ReadH5Ebsd::ReadH5Ebsd()
 , m_InputFile("")
 , m_ZStartIndex(0)
 , m_ZEndIndex(0)
+, m_UseRegionOfInterest(false)
+, m_XStartIndex(0)
+, m_XEndIndex(0)
+, m_YStartIndex(0)
+, m_YEndIndex(0)
 , m_UseTransformations(true)
 , m_AngleRepresentation(Ebsd::AngleRepresentation::Radians)
 , m_RefFrameZDir(SIMPL::RefFrameZDir::UnknownRefFrameZDirection)
@@ -131,6 +136,11 @@ void ReadH5Ebsd::readFilterParameters(AbstractFilterParametersReader* reader, in
   setRefFrameZDir((reader->readValue("RefFrameZDir", getRefFrameZDir())));
   setZStartIndex(reader->readValue("ZStartIndex", getZStartIndex()));
   setZEndIndex(reader->readValue("ZEndIndex", getZEndIndex()));
+  setUseRegionOfInterest(reader->readValue("UseRegionOfInterest", getUseRegionOfInterest()));
+  setXStartIndex(reader->readValue("XStartIndex", getXStartIndex()));
+  setXEndIndex(reader->readValue("XEndIndex", getXEndIndex()));
+  setYStartIndex(reader->readValue("YStartIndex", getYStartIndex()));
+  setYEndIndex(reader->readValue("YEndIndex", getYEndIndex()));
   setUseTransformations(reader->readValue("UseTransformations", getUseTransformations()));
   setSelectedArrayNames(reader->readArraySelections("SelectedArrayNames", getSelectedArrayNames()));
   setAngleRepresentation(reader->readValue("AngleRepresentation", getAngleRepresentation()));
@@ -344,9 +354,28 @@ void ReadH5Ebsd::dataCheck()
     return;
   }
 
+  if(m_UseRegionOfInterest &&
+     (m_XStartIndex < 0 || m_XEndIndex < m_XStartIndex || m_XEndIndex >= dims[0] || m_YStartIndex < 0 || m_YEndIndex < m_YStartIndex || m_YEndIndex >= dims[1]))
+  {
+    QString ss = QObject::tr("The region of interest X [%1, %2] Y [%3, %4] must lie inside the %5 x %6 voxels of the slices.")
+                     .arg(m_XStartIndex)
+                     .arg(m_XEndIndex)
+                     .arg(m_YStartIndex)
+                     .arg(m_YEndIndex)
+                     .arg(dims[0])
+                     .arg(dims[1]);
+    setErrorCondition(-13, ss);
+    return;
+  }
+
   size_t dcDims[3] = {static_cast<size_t>(dims[0]), static_cast<size_t>(dims[1]), static_cast<size_t>(dims[2])};
   // Now Calculate our "subvolume" of slices, ie, those start and end values that the user selected from the GUI
   dcDims[2] = m_ZEndIndex - m_ZStartIndex + 1;
+  if(m_UseRegionOfInterest)
+  {
+    dcDims[0] = m_XEndIndex - m_XStartIndex + 1;
+    dcDims[1] = m_YEndIndex - m_YStartIndex + 1;
+  }
   m->getGeometryAs<ImageGeom>()->setDimensions(dcDims);
   m->getGeometryAs<ImageGeom>()->setSpacing(res);
 
@@ -477,6 +506,7 @@ void ReadH5Ebsd::execute()
   DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getDataContainerName());
 
   QString manufacturer;
+  int64_t fullDims[2] = {0, 0};
   // Get the Size and Spacing of the Volume
   {
     H5EbsdVolumeInfo::Pointer volumeInfoReader = H5EbsdVolumeInfo::New();
@@ -492,6 +522,13 @@ void ReadH5Ebsd::execute()
     m->getGeometryAs<ImageGeom>()->setSpacing(res);
     // Now Calculate our "subvolume" of slices, ie, those start and end values that the user selected from the GUI
     dcDims[2] = m_ZEndIndex - m_ZStartIndex + 1;
+    fullDims[0] = dims[0];
+    fullDims[1] = dims[1];
+    if(m_UseRegionOfInterest)
+    {
+      dcDims[0] = m_XEndIndex - m_XStartIndex + 1;
+      dcDims[1] = m_YEndIndex - m_YStartIndex + 1;
+    }
     m->getGeometryAs<ImageGeom>()->setDimensions(dcDims);
     manufacturer = volumeInfoReader->getManufacturer();
     m_RefFrameZDir = volumeInfoReader->getStackingOrder();
@@ -540,9 +577,27 @@ void ReadH5Ebsd::execute()
   }
   ebsdReader->setSliceStart(m_ZStartIndex);
   ebsdReader->setSliceEnd(m_ZEndIndex);
+  // Only the rows and columns of the region are read out of each slice
+  if(m_UseRegionOfInterest)
+  {
+    ebsdReader->setRegionOfInterest(fullDims[0], fullDims[1], m_XStartIndex, m_YStartIndex);
+  }
   ebsdReader->readAllArrays(false);
   ebsdReader->setArraysToRead(m_SelectedArrayNames);
+
+  // Hand the cell arrays to the reader so each slice is read straight into its final location
+  if(manufacturer.compare(Ebsd::Ang::Manufacturer) == 0)
+  {
+    bindTSLArrays(ebsdReader.get());
+  }
+  else if(manufacturer.compare(Ebsd::Ctf::Manufacturer) == 0)
+  {
+    bindHKLArrays(ebsdReader.get());
+  }
+
   int err = ebsdReader->loadData(m->getGeometryAs<ImageGeom>()->getXPoints(), m->getGeometryAs<ImageGeom>()->getYPoints(), m->getGeometryAs<ImageGeom>()->getZPoints(), m_RefFrameZDir);
+  // The cell arrays stay with the data container; the reader only releases its own scratch arrays
+  ebsdReader->clearDestinations();
   if(err < 0)
   {
     setErrorCondition(err, ebsdReader->getErrorMessage());
@@ -550,16 +605,15 @@ void ReadH5Ebsd::execute()
     return;
   }
 
-  // Copy the data from the pointers embedded in the reader object into our data container (Cell array).
+  // Convert the Euler angles that were read in place in the cell arrays
   if(manufacturer.compare(Ebsd::Ang::Manufacturer) == 0)
   {
-    copyTSLArrays(ebsdReader.get());
+    finishTSLArrays();
   }
   else if(manufacturer.compare(Ebsd::Ctf::Manufacturer) == 0)
   {
-    copyHKLArrays(ebsdReader.get());
+    finishHKLArrays();
   }
-
   else
   {
     QString ss =
@@ -767,226 +821,154 @@ H5EbsdVolumeReader::Pointer ReadH5Ebsd::initHKLEbsdVolumeReader()
     m_SelectedArrayNames.insert(Ebsd::Ctf::Euler2);
     m_SelectedArrayNames.insert(Ebsd::Ctf::Euler3);
   }
-  if(m_SelectedArrayNames.find(m_CellPhasesArrayName) != m_SelectedArrayNames.end())
-  {
-    m_SelectedArrayNames.insert(Ebsd::Ctf::Phase);
-  }
+  // The phases are always needed to correct the hexagonal Euler angles
+  m_SelectedArrayNames.insert(Ebsd::Ctf::Phase);
   return ebsdReader;
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void ReadH5Ebsd::copyTSLArrays(H5EbsdVolumeReader* ebsdReader)
+AttributeMatrix::Pointer ReadH5Ebsd::resizeCellAttributeMatrix()
 {
-  float* f1 = nullptr;
-  float* f2 = nullptr;
-  float* f3 = nullptr;
-  int32_t* phasePtr = nullptr;
-
-  FloatArrayType::Pointer fArray = FloatArrayType::NullPointer();
-  Int32ArrayType::Pointer iArray = Int32ArrayType::NullPointer();
   DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getDataContainerName());
-
   AttributeMatrix::Pointer cellAttrMatrix = m->getAttributeMatrix(getCellAttributeMatrixName());
   QVector<size_t> tDims(3, 0);
   tDims[0] = m->getGeometryAs<ImageGeom>()->getXPoints();
   tDims[1] = m->getGeometryAs<ImageGeom>()->getYPoints();
   tDims[2] = m->getGeometryAs<ImageGeom>()->getZPoints();
   cellAttrMatrix->resizeAttributeArrays(tDims); // Resize the attribute Matrix to the proper dimensions
+  return cellAttrMatrix;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ReadH5Ebsd::bindTSLArrays(H5EbsdVolumeReader* ebsdReader)
+{
+  AttributeMatrix::Pointer cellAttrMatrix = resizeCellAttributeMatrix();
+  m_CellPhasesPtr.reset();
+  m_CellPhases = nullptr;
+  m_CellEulerAnglesPtr.reset();
+  m_CellEulerAngles = nullptr;
 
-  size_t totalPoints = m->getGeometryAs<ImageGeom>()->getNumberOfElements();
-  QVector<size_t> cDims(1, 1);
   if(m_SelectedArrayNames.find(m_CellPhasesArrayName) != m_SelectedArrayNames.end())
   {
-    phasePtr = reinterpret_cast<int32_t*>(ebsdReader->getPointerByName(Ebsd::Ang::PhaseData));
-    iArray = Int32ArrayType::CreateArray(tDims, cDims, SIMPL::CellData::Phases);
-    ::memcpy(iArray->getPointer(0), phasePtr, sizeof(int32_t) * totalPoints);
-    cellAttrMatrix->insertOrAssign(iArray);
+    Int32ArrayType::Pointer iArray = getOrCreateCellArray<int32_t>(cellAttrMatrix, getCellPhasesArrayName(), 1);
+    m_CellPhasesPtr = iArray;
+    m_CellPhases = iArray->getPointer(0);
+    ebsdReader->setDestination(Ebsd::Ang::PhaseData, m_CellPhases);
   }
 
   if(m_SelectedArrayNames.find(m_CellEulerAnglesArrayName) != m_SelectedArrayNames.end())
   {
-    f1 = reinterpret_cast<float*>(ebsdReader->getPointerByName(Ebsd::Ang::Phi1));
-    f2 = reinterpret_cast<float*>(ebsdReader->getPointerByName(Ebsd::Ang::Phi));
-    f3 = reinterpret_cast<float*>(ebsdReader->getPointerByName(Ebsd::Ang::Phi2));
-    cDims[0] = 3;
-    fArray = FloatArrayType::CreateArray(tDims, cDims, SIMPL::CellData::EulerAngles);
-    float* cellEulerAngles = fArray->getPointer(0);
-    float degToRad = 1.0f;
-    if(m_AngleRepresentation != Ebsd::AngleRepresentation::Radians && m_UseTransformations)
-    {
-      degToRad = SIMPLib::Constants::k_PiOver180;
-    }
-    for(size_t i = 0; i < totalPoints; i++)
-    {
-      cellEulerAngles[3 * i] = f1[i] * degToRad;
-      cellEulerAngles[3 * i + 1] = f2[i] * degToRad;
-      cellEulerAngles[3 * i + 2] = f3[i] * degToRad;
-    }
-    cellAttrMatrix->insertOrAssign(fArray);
-  }
-
-  // Reset this back to 1 for the rest of the arrays
-  cDims[0] = 1;
-
-  if(m_SelectedArrayNames.find(Ebsd::Ang::ImageQuality) != m_SelectedArrayNames.end())
-  {
-    f1 = reinterpret_cast<float*>(ebsdReader->getPointerByName(Ebsd::Ang::ImageQuality));
-    fArray = FloatArrayType::CreateArray(tDims, cDims, Ebsd::Ang::ImageQuality);
-    ::memcpy(fArray->getPointer(0), f1, sizeof(float) * totalPoints);
-    cellAttrMatrix->insertOrAssign(fArray);
-  }
-
-  if(m_SelectedArrayNames.find(Ebsd::Ang::ConfidenceIndex) != m_SelectedArrayNames.end())
-  {
-    f1 = reinterpret_cast<float*>(ebsdReader->getPointerByName(Ebsd::Ang::ConfidenceIndex));
-    fArray = FloatArrayType::CreateArray(tDims, cDims, Ebsd::Ang::ConfidenceIndex);
-    ::memcpy(fArray->getPointer(0), f1, sizeof(float) * totalPoints);
-    cellAttrMatrix->insertOrAssign(fArray);
-  }
-
-  if(m_SelectedArrayNames.find(Ebsd::Ang::SEMSignal) != m_SelectedArrayNames.end())
-  {
-    f1 = reinterpret_cast<float*>(ebsdReader->getPointerByName(Ebsd::Ang::SEMSignal));
-    fArray = FloatArrayType::CreateArray(tDims, cDims, Ebsd::Ang::SEMSignal);
-    ::memcpy(fArray->getPointer(0), f1, sizeof(float) * totalPoints);
-    cellAttrMatrix->insertOrAssign(fArray);
-  }
-
-  if(m_SelectedArrayNames.find(Ebsd::Ang::Fit) != m_SelectedArrayNames.end())
-  {
-    f1 = reinterpret_cast<float*>(ebsdReader->getPointerByName(Ebsd::Ang::Fit));
-    fArray = FloatArrayType::CreateArray(tDims, cDims, Ebsd::Ang::Fit);
-    ::memcpy(fArray->getPointer(0), f1, sizeof(float) * totalPoints);
-    cellAttrMatrix->insertOrAssign(fArray);
-  }
-
-  if(m_SelectedArrayNames.find(Ebsd::Ang::XPosition) != m_SelectedArrayNames.end())
-  {
-    f1 = reinterpret_cast<float*>(ebsdReader->getPointerByName(Ebsd::Ang::XPosition));
-    fArray = FloatArrayType::CreateArray(tDims, cDims, Ebsd::Ang::XPosition);
-    ::memcpy(fArray->getPointer(0), f1, sizeof(float) * totalPoints);
-    cellAttrMatrix->insertOrAssign(fArray);
+    // The three angles are read straight into their component of the interleaved array
+    FloatArrayType::Pointer fArray = getOrCreateCellArray<float>(cellAttrMatrix, getCellEulerAnglesArrayName(), 3);
+    m_CellEulerAnglesPtr = fArray;
+    m_CellEulerAngles = fArray->getPointer(0);
+    ebsdReader->setDestination(Ebsd::Ang::Phi1, m_CellEulerAngles, 3, 0);
+    ebsdReader->setDestination(Ebsd::Ang::Phi, m_CellEulerAngles, 3, 1);
+    ebsdReader->setDestination(Ebsd::Ang::Phi2, m_CellEulerAngles, 3, 2);
   }
 
-  if(m_SelectedArrayNames.find(Ebsd::Ang::YPosition) != m_SelectedArrayNames.end())
+  QVector<QString> floatNames = {Ebsd::Ang::ImageQuality, Ebsd::Ang::ConfidenceIndex, Ebsd::Ang::SEMSignal, Ebsd::Ang::Fit, Ebsd::Ang::XPosition, Ebsd::Ang::YPosition};
+  for(const QString& name : floatNames)
   {
-    f1 = reinterpret_cast<float*>(ebsdReader->getPointerByName(Ebsd::Ang::YPosition));
-    fArray = FloatArrayType::CreateArray(tDims, cDims, Ebsd::Ang::YPosition);
-    ::memcpy(fArray->getPointer(0), f1, sizeof(float) * totalPoints);
-    cellAttrMatrix->insertOrAssign(fArray);
+    if(m_SelectedArrayNames.find(name) != m_SelectedArrayNames.end())
+    {
+      FloatArrayType::Pointer fArray = getOrCreateCellArray<float>(cellAttrMatrix, name, 1);
+      ebsdReader->setDestination(name, fArray->getPointer(0));
+    }
   }
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void ReadH5Ebsd::copyHKLArrays(H5EbsdVolumeReader* ebsdReader)
+void ReadH5Ebsd::bindHKLArrays(H5EbsdVolumeReader* ebsdReader)
 {
-  float* f1 = nullptr;
-  float* f2 = nullptr;
-  float* f3 = nullptr;
-  int32_t* phasePtr = nullptr;
+  AttributeMatrix::Pointer cellAttrMatrix = resizeCellAttributeMatrix();
+  m_CellEulerAnglesPtr.reset();
+  m_CellEulerAngles = nullptr;
 
-  FloatArrayType::Pointer fArray = FloatArrayType::NullPointer();
-  Int32ArrayType::Pointer iArray = Int32ArrayType::NullPointer();
-  DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getDataContainerName());
-  AttributeMatrix::Pointer cellAttrMatrix = m->getAttributeMatrix(getCellAttributeMatrixName());
-  QVector<size_t> tDims(3, 0);
-  tDims[0] = m->getGeometryAs<ImageGeom>()->getXPoints();
-  tDims[1] = m->getGeometryAs<ImageGeom>()->getYPoints();
-  tDims[2] = m->getGeometryAs<ImageGeom>()->getZPoints();
-  cellAttrMatrix->resizeAttributeArrays(tDims); // Resize the attribute Matrix to the proper dimensions
-
-  size_t totalPoints = m->getGeometryAs<ImageGeom>()->getNumberOfElements();
-  QVector<size_t> cDims(1, 1);
-  phasePtr = reinterpret_cast<int32_t*>(ebsdReader->getPointerByName(Ebsd::Ctf::Phase));
-  iArray = Int32ArrayType::CreateArray(tDims, cDims, SIMPL::CellData::Phases);
-  ::memcpy(iArray->getPointer(0), phasePtr, sizeof(int32_t) * totalPoints);
-  cellAttrMatrix->insertOrAssign(iArray);
+  Int32ArrayType::Pointer iArray = getOrCreateCellArray<int32_t>(cellAttrMatrix, getCellPhasesArrayName(), 1);
+  m_CellPhasesPtr = iArray;
+  m_CellPhases = iArray->getPointer(0);
+  ebsdReader->setDestination(Ebsd::Ctf::Phase, m_CellPhases);
 
   if(m_SelectedArrayNames.find(m_CellEulerAnglesArrayName) != m_SelectedArrayNames.end())
   {
-    //  radianconversion = M_PI / 180.0;
-    f1 = reinterpret_cast<float*>(ebsdReader->getPointerByName(Ebsd::Ctf::Euler1));
-    f2 = reinterpret_cast<float*>(ebsdReader->getPointerByName(Ebsd::Ctf::Euler2));
-    f3 = reinterpret_cast<float*>(ebsdReader->getPointerByName(Ebsd::Ctf::Euler3));
-    cDims[0] = 3;
-    fArray = FloatArrayType::CreateArray(tDims, cDims, SIMPL::CellData::EulerAngles);
-    float* cellEulerAngles = fArray->getPointer(0);
-    int32_t* cellPhases = iArray->getPointer(0);
-    float degToRad = 1.0f;
-    if(m_AngleRepresentation != Ebsd::AngleRepresentation::Radians && m_UseTransformations)
-    {
-      degToRad = SIMPLib::Constants::k_PiOver180;
-    }
-    for(size_t i = 0; i < totalPoints; i++)
-    {
-      cellEulerAngles[3 * i] = f1[i] * degToRad;
-      cellEulerAngles[3 * i + 1] = f2[i] * degToRad;
-      cellEulerAngles[3 * i + 2] = f3[i] * degToRad;
-      if(m_CrystalStructures[cellPhases[i]] == Ebsd::CrystalStructure::Hexagonal_High)
-      {
-        cellEulerAngles[3 * i + 2] = cellEulerAngles[3 * i + 2] + (30.0 * degToRad);
-      }
-    }
-    cellAttrMatrix->insertOrAssign(fArray);
+    // The three angles are read straight into their component of the interleaved array
+    FloatArrayType::Pointer fArray = getOrCreateCellArray<float>(cellAttrMatrix, getCellEulerAnglesArrayName(), 3);
+    m_CellEulerAnglesPtr = fArray;
+    m_CellEulerAngles = fArray->getPointer(0);
+    ebsdReader->setDestination(Ebsd::Ctf::Euler1, m_CellEulerAngles, 3, 0);
+    ebsdReader->setDestination(Ebsd::Ctf::Euler2, m_CellEulerAngles, 3, 1);
+    ebsdReader->setDestination(Ebsd::Ctf::Euler3, m_CellEulerAngles, 3, 2);
   }
 
-  cDims[0] = 1;
-  if(m_SelectedArrayNames.find(Ebsd::Ctf::Bands) != m_SelectedArrayNames.end())
+  QVector<QString> intNames = {Ebsd::Ctf::Bands, Ebsd::Ctf::Error, Ebsd::Ctf::BC, Ebsd::Ctf::BS};
+  for(const QString& name : intNames)
   {
-    phasePtr = reinterpret_cast<int32_t*>(ebsdReader->getPointerByName(Ebsd::Ctf::Bands));
-    iArray = Int32ArrayType::CreateArray(tDims, cDims, Ebsd::Ctf::Bands);
-    ::memcpy(iArray->getPointer(0), phasePtr, sizeof(int32_t) * totalPoints);
-    cellAttrMatrix->insertOrAssign(iArray);
+    if(m_SelectedArrayNames.find(name) != m_SelectedArrayNames.end())
+    {
+      Int32ArrayType::Pointer array = getOrCreateCellArray<int32_t>(cellAttrMatrix, name, 1);
+      ebsdReader->setDestination(name, array->getPointer(0));
+    }
   }
 
-  if(m_SelectedArrayNames.find(Ebsd::Ctf::Error) != m_SelectedArrayNames.end())
+  QVector<QString> floatNames = {Ebsd::Ctf::MAD, Ebsd::Ctf::X, Ebsd::Ctf::Y};
+  for(const QString& name : floatNames)
   {
-    phasePtr = reinterpret_cast<int32_t*>(ebsdReader->getPointerByName(Ebsd::Ctf::Error));
-    iArray = Int32ArrayType::CreateArray(tDims, cDims, Ebsd::Ctf::Error);
-    ::memcpy(iArray->getPointer(0), phasePtr, sizeof(int32_t) * totalPoints);
-    cellAttrMatrix->insertOrAssign(iArray);
+    if(m_SelectedArrayNames.find(name) != m_SelectedArrayNames.end())
+    {
+      FloatArrayType::Pointer array = getOrCreateCellArray<float>(cellAttrMatrix, name, 1);
+      ebsdReader->setDestination(name, array->getPointer(0));
+    }
   }
+}
 
-  if(m_SelectedArrayNames.find(Ebsd::Ctf::MAD) != m_SelectedArrayNames.end())
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ReadH5Ebsd::finishTSLArrays()
+{
+  if(nullptr == m_CellEulerAngles || m_AngleRepresentation == Ebsd::AngleRepresentation::Radians || !m_UseTransformations)
   {
-    f1 = reinterpret_cast<float*>(ebsdReader->getPointerByName(Ebsd::Ctf::MAD));
-    fArray = FloatArrayType::CreateArray(tDims, cDims, Ebsd::Ctf::MAD);
-    ::memcpy(fArray->getPointer(0), f1, sizeof(float) * totalPoints);
-    cellAttrMatrix->insertOrAssign(fArray);
+    return;
   }
-
-  if(m_SelectedArrayNames.find(Ebsd::Ctf::BC) != m_SelectedArrayNames.end())
+  float degToRad = SIMPLib::Constants::k_PiOver180;
+  size_t count = m_CellEulerAnglesPtr.lock()->getSize();
+  for(size_t i = 0; i < count; i++)
   {
-    phasePtr = reinterpret_cast<int32_t*>(ebsdReader->getPointerByName(Ebsd::Ctf::BC));
-    iArray = Int32ArrayType::CreateArray(tDims, cDims, Ebsd::Ctf::BC);
-    ::memcpy(iArray->getPointer(0), phasePtr, sizeof(int32_t) * totalPoints);
-    cellAttrMatrix->insertOrAssign(iArray);
+    m_CellEulerAngles[i] = m_CellEulerAngles[i] * degToRad;
   }
+}
 
-  if(m_SelectedArrayNames.find(Ebsd::Ctf::BS) != m_SelectedArrayNames.end())
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ReadH5Ebsd::finishHKLArrays()
+{
+  if(nullptr == m_CellEulerAngles)
   {
-    phasePtr = reinterpret_cast<int32_t*>(ebsdReader->getPointerByName(Ebsd::Ctf::BS));
-    iArray = Int32ArrayType::CreateArray(tDims, cDims, Ebsd::Ctf::BS);
-    ::memcpy(iArray->getPointer(0), phasePtr, sizeof(int32_t) * totalPoints);
-    cellAttrMatrix->insertOrAssign(iArray);
+    return;
   }
-  if(m_SelectedArrayNames.find(Ebsd::Ctf::X) != m_SelectedArrayNames.end())
+  float degToRad = 1.0f;
+  if(m_AngleRepresentation != Ebsd::AngleRepresentation::Radians && m_UseTransformations)
   {
-    f1 = reinterpret_cast<float*>(ebsdReader->getPointerByName(Ebsd::Ctf::X));
-    fArray = FloatArrayType::CreateArray(tDims, cDims, Ebsd::Ctf::X);
-    ::memcpy(fArray->getPointer(0), f1, sizeof(float) * totalPoints);
-    cellAttrMatrix->insertOrAssign(fArray);
+    degToRad = SIMPLib::Constants::k_PiOver180;
   }
-  if(m_SelectedArrayNames.find(Ebsd::Ctf::Y) != m_SelectedArrayNames.end())
+  size_t totalPoints = m_CellPhasesPtr.lock()->getNumberOfTuples();
+  for(size_t i = 0; i < totalPoints; i++)
   {
-    f1 = reinterpret_cast<float*>(ebsdReader->getPointerByName(Ebsd::Ctf::Y));
-    fArray = FloatArrayType::CreateArray(tDims, cDims, Ebsd::Ctf::Y);
-    ::memcpy(fArray->getPointer(0), f1, sizeof(float) * totalPoints);
-    cellAttrMatrix->insertOrAssign(fArray);
+    m_CellEulerAngles[3 * i] = m_CellEulerAngles[3 * i] * degToRad;
+    m_CellEulerAngles[3 * i + 1] = m_CellEulerAngles[3 * i + 1] * degToRad;
+    m_CellEulerAngles[3 * i + 2] = m_CellEulerAngles[3 * i + 2] * degToRad;
+    if(m_CrystalStructures[m_CellPhases[i]] == Ebsd::CrystalStructure::Hexagonal_High)
+    {
+      m_CellEulerAngles[3 * i + 2] = m_CellEulerAngles[3 * i + 2] + (30.0 * degToRad);
+    }
   }
 }
 
@@ -1010,6 +992,11 @@ AbstractFilter::Pointer ReadH5Ebsd::newFilterInstance(bool copyFilterParameters)
     filter->setInputFile(getInputFile());
     filter->setZStartIndex(getZStartIndex());
     filter->setZEndIndex(getZEndIndex());
+    filter->setUseRegionOfInterest(getUseRegionOfInterest());
+    filter->setXStartIndex(getXStartIndex());
+    filter->setXEndIndex(getXEndIndex());
+    filter->setYStartIndex(getYStartIndex());
+    filter->setYEndIndex(getYEndIndex());
     filter->setUseTransformations(getUseTransformations());
     filter->setSelectedArrayNames(getSelectedArrayNames());
     filter->setDataArrayNames(getDataArrayNames());
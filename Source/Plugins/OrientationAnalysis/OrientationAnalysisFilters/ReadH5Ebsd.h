@@ -60,6 +60,11 @@ class OrientationAnalysis_EXPORT ReadH5Ebsd : public AbstractFilter
     PYB11_PROPERTY(QString InputFile READ getInputFile WRITE setInputFile)
     PYB11_PROPERTY(int ZStartIndex READ getZStartIndex WRITE setZStartIndex)
     PYB11_PROPERTY(int ZEndIndex READ getZEndIndex WRITE setZEndIndex)
+    PYB11_PROPERTY(bool UseRegionOfInterest READ getUseRegionOfInterest WRITE setUseRegionOfInterest)
+    PYB11_PROPERTY(int XStartIndex READ getXStartIndex WRITE setXStartIndex)
+    PYB11_PROPERTY(int XEndIndex READ getXEndIndex WRITE setXEndIndex)
+    PYB11_PROPERTY(int YStartIndex READ getYStartIndex WRITE setYStartIndex)
+    PYB11_PROPERTY(int YEndIndex READ getYEndIndex WRITE setYEndIndex)
     PYB11_PROPERTY(bool UseTransformations READ getUseTransformations WRITE setUseTransformations)
     PYB11_PROPERTY(int AngleRepresentation READ getAngleRepresentation WRITE setAngleRepresentation)
     PYB11_PROPERTY(QSet<QString> SelectedArrayNames READ getSelectedArrayNames WRITE setSelectedArrayNames)
@@ -93,6 +98,24 @@ public:
   SIMPL_FILTER_PARAMETER(int, ZEndIndex)
   Q_PROPERTY(int ZEndIndex READ getZEndIndex WRITE setZEndIndex)
 
+  /**
+   * @brief Only read the voxels from XStartIndex to XEndIndex and YStartIndex to YEndIndex (inclusive) of each slice
+   */
+  SIMPL_FILTER_PARAMETER(bool, UseRegionOfInterest)
+  Q_PROPERTY(bool UseRegionOfInterest READ getUseRegionOfInterest WRITE setUseRegionOfInterest)
+
+  SIMPL_FILTER_PARAMETER(int, XStartIndex)
+  Q_PROPERTY(int XStartIndex READ getXStartIndex WRITE setXStartIndex)
+
+  SIMPL_FILTER_PARAMETER(int, XEndIndex)
+  Q_PROPERTY(int XEndIndex READ getXEndIndex WRITE setXEndIndex)
+
+  SIMPL_FILTER_PARAMETER(int, YStartIndex)
+  Q_PROPERTY(int YStartIndex READ getYStartIndex WRITE setYStartIndex)
+
+  SIMPL_FILTER_PARAMETER(int, YEndIndex)
+  Q_PROPERTY(int YEndIndex READ getYEndIndex WRITE setYEndIndex)
+
   SIMPL_FILTER_PARAMETER(bool, UseTransformations)
   Q_PROPERTY(bool UseTransformations READ getUseTransformations WRITE setUseTransformations)
 
@@ -245,16 +268,55 @@ protected:
   H5EbsdVolumeReader::Pointer initHKLEbsdVolumeReader();
 
   /**
-   * @brief copyTSLArrays Copies the read arrays into the data container structure (TSL variant)
+   * @brief resizeCellAttributeMatrix Resizes the cell Attribute Matrix to the dimensions of the volume being read
+   * @return The cell Attribute Matrix
+   */
+  AttributeMatrix::Pointer resizeCellAttributeMatrix();
+
+  /**
+   * @brief bindTSLArrays Creates the cell arrays and registers them with the reader as the
+   * destinations of the slice reads (TSL variant)
    * @param ebsdReader H5EbsdVolumeReader instance pointer
    */
-  void copyTSLArrays(H5EbsdVolumeReader* ebsdReader);
+  void bindTSLArrays(H5EbsdVolumeReader* ebsdReader);
 
   /**
-   * @brief copyHKLArrays Copies the read arrays into the data container structure (HKL variant)
+   * @brief bindHKLArrays Creates the cell arrays and registers them with the reader as the
+   * destinations of the slice reads (HKL variant)
    * @param ebsdReader H5EbsdVolumeReader instance pointer
    */
-  void copyHKLArrays(H5EbsdVolumeReader* ebsdReader);
+  void bindHKLArrays(H5EbsdVolumeReader* ebsdReader);
+
+  /**
+   * @brief finishTSLArrays Converts the Euler angles to radians in place after loading (TSL variant)
+   */
+  void finishTSLArrays();
+
+  /**
+   * @brief finishHKLArrays Converts the Euler angles to radians in place after loading and applies
+   * the 30 degree hexagonal offset (HKL variant)
+   */
+  void finishHKLArrays();
+
+  /**
+   * @brief getOrCreateCellArray Returns the cell array with the given name, creating it when it does
+   * not exist yet or does not have the expected shape
+   * @param cellAttrMatrix The cell Attribute Matrix, already resized to the volume
+   * @param name Name of the array
+   * @param numComponents Number of components per tuple
+   * @return The array
+   */
+  template <typename T> typename DataArray<T>::Pointer getOrCreateCellArray(const AttributeMatrix::Pointer& cellAttrMatrix, const QString& name, size_t numComponents)
+  {
+    typename DataArray<T>::Pointer array = cellAttrMatrix->getAttributeArrayAs<DataArray<T>>(name);
+    if(nullptr == array.get() || array->getNumberOfComponents() != numComponents || array->getNumberOfTuples() != cellAttrMatrix->getNumberOfTuples())
+    {
+      QVector<size_t> cDims(1, numComponents);
+      array = DataArray<T>::CreateArray(cellAttrMatrix->getTupleDimensions(), cDims, name, true);
+      cellAttrMatrix->insertOrAssign(array);
+    }
+    return array;
+  }
 
   /**
   * @brief loadInfo Reads the values for the phase type, crystal structure
@@ -0,0 +1,236 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <cstring>
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QFile>
+
+#include <hdf5.h>
+
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/SIMPLib.h"
+#include "UnitTestSupport.hpp"
+
+#include "EbsdLib/EbsdConstants.h"
+#include "EbsdLib/TSL/AngConstants.h"
+#include "EbsdLib/TSL/H5AngVolumeReader.h"
+
+#include "OrientationAnalysis/OrientationAnalysisFilters/EbsdToH5Ebsd.h"
+
+#include "OrientationAnalysisTestFileLocations.h"
+
+class EbsdToH5EbsdTest
+{
+
+public:
+  EbsdToH5EbsdTest() = default;
+  ~EbsdToH5EbsdTest() = default;
+
+  const QString k_FilePrefix = QString("EbsdToH5EbsdTest_");
+  const int k_NumSlices = 3;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  QString SliceFilePath(int z)
+  {
+    return QString("%1/%2%3.ang").arg(UnitTest::TestTempDir).arg(k_FilePrefix).arg(z);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RemoveTestFiles()
+  {
+#if REMOVE_TEST_FILES
+    for(int z = 1; z <= k_NumSlices; z++)
+    {
+      QFile::remove(SliceFilePath(z));
+    }
+    QFile::remove(UnitTest::EbsdToH5EbsdTest::UncompressedFile);
+    QFile::remove(UnitTest::EbsdToH5EbsdTest::CompressedFile);
+#endif
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void ConvertSlices(const QString& outputFile, int chunkSize, int compressionLevel, bool shuffle)
+  {
+    QFile::remove(outputFile);
+
+    EbsdToH5Ebsd::Pointer filter = EbsdToH5Ebsd::New();
+    filter->setInputPath(UnitTest::TestTempDir);
+    filter->setFilePrefix(k_FilePrefix);
+    filter->setFileSuffix(QString(""));
+    filter->setFileExtension(Ebsd::Ang::FileExt);
+    filter->setPaddingDigits(1);
+    filter->setZStartIndex(1);
+    filter->setZEndIndex(k_NumSlices);
+    filter->setZResolution(0.25f);
+    filter->setRefFrameZDir(SIMPL::RefFrameZDir::LowtoHigh);
+    filter->setOutputFile(outputFile);
+    filter->setChunkSize(chunkSize);
+    filter->setCompressionLevel(compressionLevel);
+    filter->setShuffle(shuffle);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  H5AngVolumeReader::Pointer LoadVolume(const QString& filePath)
+  {
+    H5AngVolumeReader::Pointer reader = H5AngVolumeReader::New();
+    reader->setFileName(filePath);
+    int err = reader->readVolumeInfo();
+    DREAM3D_REQUIRED(err, >=, 0)
+
+    int64_t dims[3] = {0, 0, 0};
+    float res[3] = {0.0f, 0.0f, 0.0f};
+    err = reader->getDimsAndResolution(dims[0], dims[1], dims[2], res[0], res[1], res[2]);
+    DREAM3D_REQUIRED(err, >=, 0)
+    DREAM3D_REQUIRE_EQUAL(dims[2], k_NumSlices)
+
+    reader->setSliceStart(reader->getZStart());
+    reader->setSliceEnd(reader->getZEnd());
+    reader->readAllArrays(true);
+    err = reader->loadData(dims[0], dims[1], dims[2], reader->getStackingOrder());
+    DREAM3D_REQUIRED(err, >=, 0)
+    return reader;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename T>
+  void CompareArray(H5AngVolumeReader* reader, H5AngVolumeReader* compressedReader, const QString& name)
+  {
+    T* values = static_cast<T*>(reader->getPointerByName(name));
+    T* compressedValues = static_cast<T*>(compressedReader->getPointerByName(name));
+    DREAM3D_REQUIRE_VALID_POINTER(values)
+    DREAM3D_REQUIRE_VALID_POINTER(compressedValues)
+    // Compared bit for bit so NaN values count as equal
+    DREAM3D_REQUIRE(::memcmp(values, compressedValues, reader->getNumberOfElements() * sizeof(T)) == 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void CheckDataArrayLayout(const QString& filePath, bool expectCompressed)
+  {
+    bool chunked = false;
+    bool deflate = false;
+    bool shuffle = false;
+
+    QString datasetPath = QString("1/%1/%2").arg(Ebsd::H5Ebsd::Data).arg(Ebsd::Ang::Phi1);
+    hid_t fileId = H5Fopen(filePath.toLatin1().constData(), H5F_ACC_RDONLY, H5P_DEFAULT);
+    DREAM3D_REQUIRED(fileId, >=, 0)
+    hid_t datasetId = H5Dopen2(fileId, datasetPath.toLatin1().constData(), H5P_DEFAULT);
+    if(datasetId >= 0)
+    {
+      hid_t dcpl = H5Dget_create_plist(datasetId);
+      chunked = (H5Pget_layout(dcpl) == H5D_CHUNKED);
+      int numFilters = H5Pget_nfilters(dcpl);
+      for(int i = 0; i < numFilters; i++)
+      {
+        unsigned int flags = 0;
+        size_t numValues = 0;
+        unsigned int filterConfig = 0;
+        H5Z_filter_t filter = H5Pget_filter2(dcpl, static_cast<unsigned>(i), &flags, &numValues, nullptr, 0, nullptr, &filterConfig);
+        deflate = deflate || (filter == H5Z_FILTER_DEFLATE);
+        shuffle = shuffle || (filter == H5Z_FILTER_SHUFFLE);
+      }
+      H5Pclose(dcpl);
+      H5Dclose(datasetId);
+    }
+    H5Fclose(fileId);
+
+    DREAM3D_REQUIRED(datasetId, >=, 0)
+    DREAM3D_REQUIRE_EQUAL(chunked, expectCompressed)
+    DREAM3D_REQUIRE_EQUAL(deflate, expectCompressed)
+    DREAM3D_REQUIRE_EQUAL(shuffle, expectCompressed)
+  }
+
+  // -----------------------------------------------------------------------------
+  // A chunked, deflated and shuffled .h5ebsd file must read back exactly like an uncompressed
+  // one. The chunk size does not divide the slice, so the last chunk of every slice is partial.
+  // -----------------------------------------------------------------------------
+  void TestCompressedRoundTrip()
+  {
+    for(int z = 1; z <= k_NumSlices; z++)
+    {
+      QFile::remove(SliceFilePath(z));
+      DREAM3D_REQUIRE(QFile::copy(UnitTest::EbsdToH5EbsdTest::InputFile, SliceFilePath(z)))
+    }
+
+    ConvertSlices(UnitTest::EbsdToH5EbsdTest::UncompressedFile, 0, 0, false);
+    ConvertSlices(UnitTest::EbsdToH5EbsdTest::CompressedFile, 37, 6, true);
+    CheckDataArrayLayout(UnitTest::EbsdToH5EbsdTest::UncompressedFile, false);
+    CheckDataArrayLayout(UnitTest::EbsdToH5EbsdTest::CompressedFile, true);
+
+    H5AngVolumeReader::Pointer reader = LoadVolume(UnitTest::EbsdToH5EbsdTest::UncompressedFile);
+    H5AngVolumeReader::Pointer compressedReader = LoadVolume(UnitTest::EbsdToH5EbsdTest::CompressedFile);
+    DREAM3D_REQUIRE_EQUAL(compressedReader->getNumberOfElements(), reader->getNumberOfElements())
+
+    CompareArray<float>(reader.get(), compressedReader.get(), Ebsd::Ang::Phi1);
+    CompareArray<float>(reader.get(), compressedReader.get(), Ebsd::Ang::Phi);
+    CompareArray<float>(reader.get(), compressedReader.get(), Ebsd::Ang::Phi2);
+    CompareArray<float>(reader.get(), compressedReader.get(), Ebsd::Ang::XPosition);
+    CompareArray<float>(reader.get(), compressedReader.get(), Ebsd::Ang::YPosition);
+    CompareArray<float>(reader.get(), compressedReader.get(), Ebsd::Ang::ImageQuality);
+    CompareArray<float>(reader.get(), compressedReader.get(), Ebsd::Ang::ConfidenceIndex);
+    CompareArray<int>(reader.get(), compressedReader.get(), Ebsd::Ang::PhaseData);
+    CompareArray<float>(reader.get(), compressedReader.get(), Ebsd::Ang::SEMSignal);
+    CompareArray<float>(reader.get(), compressedReader.get(), Ebsd::Ang::Fit);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+    std::cout << "#-- EbsdToH5EbsdTest Starting " << std::endl;
+
+    DREAM3D_REGISTER_TEST(TestCompressedRoundTrip())
+    DREAM3D_REGISTER_TEST(RemoveTestFiles())
+  }
+
+public:
+  EbsdToH5EbsdTest(const EbsdToH5EbsdTest&) = delete;            // Copy Constructor Not Implemented
+  EbsdToH5EbsdTest(EbsdToH5EbsdTest&&) = delete;                 // Move Constructor Not Implemented
+  EbsdToH5EbsdTest& operator=(const EbsdToH5EbsdTest&) = delete; // Copy Assignment Not Implemented
+  EbsdToH5EbsdTest& operator=(EbsdToH5EbsdTest&&) = delete;      // Move Assignment Not Implemented
+};
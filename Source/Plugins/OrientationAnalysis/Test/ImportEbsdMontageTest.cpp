@@ -1,25 +1,28 @@
 // -----------------------------------------------------------------------------
 // Insert your license & copyright information here
 // -----------------------------------------------------------------------------
-#pragma once
 
 #include <QtCore/QCoreApplication>
 #include <QtCore/QFile>
+#include <QtCore/QTextStream>
 
-#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/Filtering/FilterFactory.hpp"
 #include "SIMPLib/Filtering/FilterManager.h"
-#include "SIMPLib/Filtering/FilterPipeline.h"
-#include "SIMPLib/Plugin/ISIMPLibPlugin.h"
-#include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
 #include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Utilities/FilePathGenerator.h"
+#include "UnitTestSupport.hpp"
 
-#include "SIMPLib/Filtering/QMetaObjectUtilities.h"
+#include "EbsdLib/TSL/AngConstants.h"
 
-#include "UnitTestSupport.hpp"
+#include "OrientationAnalysis/OrientationAnalysisFilters/ImportEbsdMontage.h"
 
-#include "EbsdMontageTestFileLocations.h"
+#include "OrientationAnalysisTestFileLocations.h"
 
 class ImportEbsdMontageTest
 {
@@ -27,10 +30,125 @@ class ImportEbsdMontageTest
 public:
   ImportEbsdMontageTest() = default;
   ~ImportEbsdMontageTest() = default;
-  ImportEbsdMontageTest(const ImportEbsdMontageTest&) = delete;            // Copy Constructor
-  ImportEbsdMontageTest(ImportEbsdMontageTest&&) = delete;                 // Move Constructor
-  ImportEbsdMontageTest& operator=(const ImportEbsdMontageTest&) = delete; // Copy Assignment
-  ImportEbsdMontageTest& operator=(ImportEbsdMontageTest&&) = delete;      // Move Assignment
+
+  // A 2 x 2 montage of 6 x 5 cell tiles that overlap by 3 cells. The stitched image is
+  // (2 * (6 - 3) + 3) x (2 * (5 - 3) + 3) = 9 x 7 cells.
+  const int k_NumRows = 2;
+  const int k_NumCols = 2;
+  const size_t k_TileWidth = 6;
+  const size_t k_TileHeight = 5;
+  const int k_Overlap = 3;
+  const size_t k_StitchedWidth = 9;
+  const size_t k_StitchedHeight = 7;
+  const QString k_FilePrefix = QString("ImportEbsdMontageTest_");
+  const QString k_DataContainerName = QString("Montage");
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  EbsdMontageListInfo_t FileListInfo()
+  {
+    EbsdMontageListInfo_t info;
+    info.PaddingDigits = 1;
+    info.Ordering = 0;
+    info.RowStart = 0;
+    info.RowEnd = k_NumRows;
+    info.ColStart = 0;
+    info.ColEnd = k_NumCols;
+    info.IncrementIndex = 1;
+    info.InputPath = UnitTest::TestTempDir;
+    info.FilePrefix = k_FilePrefix;
+    info.FileSuffix = QString("");
+    info.FileExtension = Ebsd::Ang::FileExt;
+    return info;
+  }
+
+  // -----------------------------------------------------------------------------
+  // The tile files are named by the same generator the filter uses
+  // -----------------------------------------------------------------------------
+  QString TileFilePath(int row, int col)
+  {
+    EbsdMontageListInfo_t info = FileListInfo();
+    bool hasMissingFiles = false;
+    FilePathGenerator::TileRCIncexLayout2D tileLayout2d = FilePathGenerator::GenerateRCIndexMontageFileList(info.RowStart, info.RowEnd, info.ColStart, info.ColEnd, hasMissingFiles, true, info.InputPath,
+                                                                                                            info.FilePrefix, info.FileSuffix, info.FileExtension, info.PaddingDigits);
+    return tileLayout2d[row][col].FileName;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Every cell records which tile it came from and where it was in that tile
+  // -----------------------------------------------------------------------------
+  float CellValue(int tileIndex, size_t x, size_t y)
+  {
+    return static_cast<float>(tileIndex * 100 + y * 10 + x);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void WriteTile(int row, int col, const QVector<unsigned int>& phaseSymmetries)
+  {
+    QString filePath = TileFilePath(row, col);
+    QFile::remove(filePath);
+    QFile file(filePath);
+    DREAM3D_REQUIRE(file.open(QIODevice::WriteOnly | QIODevice::Text))
+    QTextStream out(&file);
+
+    out << "# TEM_PIXperUM          1.000000\n";
+    out << "# x-star                0.500000\n";
+    out << "# y-star                0.500000\n";
+    out << "# z-star                0.500000\n";
+    out << "# WorkingDistance       15.000000\n";
+    out << "#\n";
+    for(int i = 0; i < phaseSymmetries.size(); i++)
+    {
+      out << "# Phase " << (i + 1) << "\n";
+      out << "# MaterialName  \tPhase" << (i + 1) << "\n";
+      out << "# Formula     \tX\n";
+      out << "# Info \t\t\n";
+      out << "# Symmetry              " << phaseSymmetries[i] << "\n";
+      out << "# LatticeConstants      3.560 3.560 3.560  90.000  90.000  90.000\n";
+      out << "# NumberFamilies        0\n";
+      out << "#\n";
+    }
+    out << "# GRID: SqrGrid\n";
+    out << "# XSTEP: 0.500000\n";
+    out << "# YSTEP: 0.500000\n";
+    out << "# NCOLS_ODD: " << k_TileWidth << "\n";
+    out << "# NCOLS_EVEN: " << k_TileWidth << "\n";
+    out << "# NROWS: " << k_TileHeight << "\n";
+    out << "#\n";
+    out << "# OPERATOR: \t\n";
+    out << "#\n";
+    out << "# SAMPLEID: \t\n";
+    out << "#\n";
+    out << "# SCANID: \t\n";
+    out << "#\n";
+
+    // phi1 PHI phi2 x y IQ CI Phase SEM Fit
+    int tileIndex = row * k_NumCols + col;
+    for(size_t y = 0; y < k_TileHeight; y++)
+    {
+      for(size_t x = 0; x < k_TileWidth; x++)
+      {
+        out << "  " << tileIndex << " " << x << " " << y << " " << x * 0.5 << " " << y * 0.5 << " " << CellValue(tileIndex, x, y) << " " << tileIndex << " 1 0 0\n";
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void WriteTiles()
+  {
+    for(int row = 0; row < k_NumRows; row++)
+    {
+      for(int col = 0; col < k_NumCols; col++)
+      {
+        WriteTile(row, col, {Ebsd::Ang::PhaseSymmetry::Cubic});
+      }
+    }
+  }
 
   // -----------------------------------------------------------------------------
   //
@@ -38,8 +156,13 @@ public:
   void RemoveTestFiles()
   {
 #if REMOVE_TEST_FILES
-    QFile::remove(UnitTest::ImportEbsdMontageTest::TestFile1);
-    QFile::remove(UnitTest::ImportEbsdMontageTest::TestFile2);
+    for(int row = 0; row < k_NumRows; row++)
+    {
+      for(int col = 0; col < k_NumCols; col++)
+      {
+        QFile::remove(TileFilePath(row, col));
+      }
+    }
 #endif
   }
 
@@ -48,14 +171,14 @@ public:
   // -----------------------------------------------------------------------------
   int TestFilterAvailability()
   {
-    // Now instantiate the ImportEbsdMontageTest Filter from the FilterManager
+    // Now instantiate the ImportEbsdMontage Filter from the FilterManager
     QString filtName = "ImportEbsdMontage";
     FilterManager* fm = FilterManager::Instance();
     IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(filtName);
     if(nullptr == filterFactory.get())
     {
       std::stringstream ss;
-      ss << "The ImportEbsdMontageTest Requires the use of the " << filtName.toStdString() << " filter which is found in the EbsdMontage Plugin";
+      ss << "The ImportEbsdMontageTest Requires the use of the " << filtName.toStdString() << " filter which is found in the OrientationAnalysis Plugin";
       DREAM3D_TEST_THROW_EXCEPTION(ss.str())
     }
     return 0;
@@ -64,29 +187,103 @@ public:
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
-  int TestImportEbsdMontageTest()
+  ImportEbsdMontage::Pointer StitchTiles(ImportEbsdMontage::OverlapMethodType overlapMethod, const DataContainerArray::Pointer& dca)
+  {
+    ImportEbsdMontage::Pointer filter = ImportEbsdMontage::New();
+    filter->setDataContainerArray(dca);
+    filter->setInputFileListInfo(FileListInfo());
+    filter->setDataContainerName(DataArrayPath(k_DataContainerName, "", ""));
+    filter->setReadTilesInParallel(false);
+    filter->setStitchTiles(true);
+    filter->setTileOverlap(k_Overlap);
+    filter->setOverlapMethod(static_cast<int>(overlapMethod));
+    filter->execute();
+    return filter;
+  }
+
+  // -----------------------------------------------------------------------------
+  // The stitched cells before firstTileEnd[0] in X and firstTileEnd[1] in Y come from the
+  // first column and row of tiles, the others from the second. Tiles start every 3 cells in X
+  // and every 2 cells in Y.
+  // -----------------------------------------------------------------------------
+  void CheckOverlapHandling(ImportEbsdMontage::OverlapMethodType overlapMethod, size_t xFirstTileEnd, size_t yFirstTileEnd)
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    ImportEbsdMontage::Pointer filter = StitchTiles(overlapMethod, dca);
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+
+    DataContainer::Pointer dc = dca->getDataContainer(k_DataContainerName);
+    DREAM3D_REQUIRE_VALID_POINTER(dc.get())
+    SizeVec3Type dims = dc->getGeometryAs<ImageGeom>()->getDimensions();
+    DREAM3D_REQUIRE_EQUAL(dims[0], k_StitchedWidth)
+    DREAM3D_REQUIRE_EQUAL(dims[1], k_StitchedHeight)
+    DREAM3D_REQUIRE_EQUAL(dims[2], 1)
+
+    AttributeMatrix::Pointer cellAttrMat = dc->getAttributeMatrix(filter->getCellAttributeMatrixName());
+    DREAM3D_REQUIRE_VALID_POINTER(cellAttrMat.get())
+    FloatArrayType::Pointer imageQuality = cellAttrMat->getAttributeArrayAs<FloatArrayType>(Ebsd::Ang::ImageQuality);
+    FloatArrayType::Pointer confidenceIndex = cellAttrMat->getAttributeArrayAs<FloatArrayType>(Ebsd::Ang::ConfidenceIndex);
+    FloatArrayType::Pointer eulerAngles = cellAttrMat->getAttributeArrayAs<FloatArrayType>(SIMPL::CellData::EulerAngles);
+    DREAM3D_REQUIRE_VALID_POINTER(imageQuality.get())
+    DREAM3D_REQUIRE_VALID_POINTER(confidenceIndex.get())
+    DREAM3D_REQUIRE_VALID_POINTER(eulerAngles.get())
+
+    const size_t xStep = k_TileWidth - k_Overlap;
+    const size_t yStep = k_TileHeight - k_Overlap;
+    for(size_t y = 0; y < k_StitchedHeight; y++)
+    {
+      for(size_t x = 0; x < k_StitchedWidth; x++)
+      {
+        size_t col = (x < xFirstTileEnd) ? 0 : 1;
+        size_t row = (y < yFirstTileEnd) ? 0 : 1;
+        size_t tileX = x - col * xStep;
+        size_t tileY = y - row * yStep;
+        int tileIndex = static_cast<int>(row * k_NumCols + col);
+        size_t index = y * k_StitchedWidth + x;
+        DREAM3D_REQUIRE_EQUAL(imageQuality->getValue(index), CellValue(tileIndex, tileX, tileY))
+        DREAM3D_REQUIRE_EQUAL(confidenceIndex->getValue(index), static_cast<float>(tileIndex))
+        // The three components of each tuple are copied together
+        DREAM3D_REQUIRE_EQUAL(eulerAngles->getComponent(index, 0), static_cast<float>(tileIndex))
+        DREAM3D_REQUIRE_EQUAL(eulerAngles->getComponent(index, 1), static_cast<float>(tileX))
+        DREAM3D_REQUIRE_EQUAL(eulerAngles->getComponent(index, 2), static_cast<float>(tileY))
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  // With an overlap of 3 the first tile covers X 0..5 and Y 0..4 of the stitched image and the
+  // second tile starts at X 3 and Y 2. An odd overlap gives its extra cell to the second tile
+  // when it is split.
+  // -----------------------------------------------------------------------------
+  int TestOverlapHandling()
   {
-    //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-    /* Please write ImportEbsdMontageTest test code here.
-     *
-     * Your IO test files are:
-     * UnitTest::ImportEbsdMontageTest::TestFile1
-     * UnitTest::ImportEbsdMontageTest::TestFile2
-     *
-     * SIMPLib provides some macros that will throw exceptions when a test fails
-     * and thus report that during testing. These macros are located in the
-     * SIMPLib/Utilities/UnitTestSupport.hpp file. Some examples are:
-     *
-     * SIMPLib_REQUIRE_EQUAL(foo, 0)
-     * This means that if the variable foo is NOT equal to Zero then test will fail
-     * and the current test will exit immediately. If there are more tests registered
-     * with the SIMPLib_REGISTER_TEST() macro, the next test will execute. There are
-     * lots of examples in the SIMPLib/Test folder to look at.
-     */
-    //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-
-    int foo = -1;
-    DREAM3D_REQUIRE_EQUAL(foo, 0)
+    WriteTiles();
+    CheckOverlapHandling(ImportEbsdMontage::OverlapMethodType::KeepFirstTile, 6, 5);
+    CheckOverlapHandling(ImportEbsdMontage::OverlapMethodType::KeepLastTile, 3, 2);
+    CheckOverlapHandling(ImportEbsdMontage::OverlapMethodType::SplitOverlap, 4, 3);
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  // The stitched image keeps the ensemble data of the first tile, so a tile with other phases
+  // must stop the filter
+  // -----------------------------------------------------------------------------
+  int TestMismatchedPhases()
+  {
+    WriteTiles();
+    WriteTile(1, 1, {Ebsd::Ang::PhaseSymmetry::DiHexagonal});
+    {
+      DataContainerArray::Pointer dca = DataContainerArray::New();
+      ImportEbsdMontage::Pointer filter = StitchTiles(ImportEbsdMontage::OverlapMethodType::SplitOverlap, dca);
+      DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -74005)
+    }
+
+    WriteTile(1, 1, {Ebsd::Ang::PhaseSymmetry::Cubic, Ebsd::Ang::PhaseSymmetry::Cubic});
+    {
+      DataContainerArray::Pointer dca = DataContainerArray::New();
+      ImportEbsdMontage::Pointer filter = StitchTiles(ImportEbsdMontage::OverlapMethodType::SplitOverlap, dca);
+      DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -74005)
+    }
 
     return EXIT_SUCCESS;
   }
@@ -100,10 +297,15 @@ public:
 
     DREAM3D_REGISTER_TEST(TestFilterAvailability());
 
-    DREAM3D_REGISTER_TEST(TestImportEbsdMontageTest())
+    DREAM3D_REGISTER_TEST(TestOverlapHandling())
+    DREAM3D_REGISTER_TEST(TestMismatchedPhases())
 
     DREAM3D_REGISTER_TEST(RemoveTestFiles())
   }
 
-private:
+public:
+  ImportEbsdMontageTest(const ImportEbsdMontageTest&) = delete;            // Copy Constructor
+  ImportEbsdMontageTest(ImportEbsdMontageTest&&) = delete;                 // Move Constructor
+  ImportEbsdMontageTest& operator=(const ImportEbsdMontageTest&) = delete; // Copy Assignment
+  ImportEbsdMontageTest& operator=(ImportEbsdMontageTest&&) = delete;      // Move Assignment
 };
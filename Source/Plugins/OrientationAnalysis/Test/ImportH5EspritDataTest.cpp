@@ -36,11 +36,16 @@
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/CoreFilters/DataContainerWriter.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataArrayPath.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/JsonFilterParametersReader.h"
 #include "SIMPLib/Filtering/FilterFactory.hpp"
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Filtering/FilterPipeline.h"
 #include "SIMPLib/Filtering/QMetaObjectUtilities.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
 #include "SIMPLib/Plugin/ISIMPLibPlugin.h"
 #include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
 #include "SIMPLib/SIMPLib.h"
@@ -140,6 +145,103 @@ public:
     return EXIT_SUCCESS;
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  AttributeMatrix::Pointer ImportScans(const QStringList& scanNames, ImageGeom::Pointer& imageGeom)
+  {
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(m_FiltName);
+    DREAM3D_REQUIRE_VALID_POINTER(filterFactory.get());
+    AbstractFilter::Pointer filter = filterFactory->create();
+    DREAM3D_REQUIRE_VALID_POINTER(filter.get())
+
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    filter->setDataContainerArray(dca);
+
+    bool propWasSet = filter->setProperty("InputFile", UnitTest::ImportH5EspritDataTest::InputFile);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    propWasSet = filter->setProperty("SelectedScanNames", scanNames);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    propWasSet = filter->setProperty("ZSpacing", 1.0f);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    propWasSet = filter->setProperty("ReadPatternData", false);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+
+    DataArrayPath dcPath = filter->property("DataContainerName").value<DataArrayPath>();
+    QString cellAttrMatName = filter->property("CellAttributeMatrixName").toString();
+    DataContainer::Pointer m = dca->getDataContainer(dcPath);
+    DREAM3D_REQUIRE_VALID_POINTER(m.get())
+    imageGeom = m->getGeometryAs<ImageGeom>();
+    DREAM3D_REQUIRE_VALID_POINTER(imageGeom.get())
+    return m->getAttributeMatrix(cellAttrMatName);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename T>
+  bool CompareSlice(const IDataArray::Pointer& scanArray, const IDataArray::Pointer& volumeArray, size_t slice)
+  {
+    typename DataArray<T>::Pointer scan = std::dynamic_pointer_cast<DataArray<T>>(scanArray);
+    typename DataArray<T>::Pointer volume = std::dynamic_pointer_cast<DataArray<T>>(volumeArray);
+    if(nullptr == scan || nullptr == volume)
+    {
+      return false;
+    }
+    size_t numValues = scan->getNumberOfTuples() * scan->getNumberOfComponents();
+    T* volumeSlice = volume->getPointer(slice * numValues);
+    for(size_t i = 0; i < numValues; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(volumeSlice[i], scan->getValue(i))
+    }
+    return true;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Reads the same scan into both slices of a two scan volume, which must then hold the values of a
+  // single scan import in each of its slices
+  // -----------------------------------------------------------------------------
+  int TestImportMultipleScans()
+  {
+    ImageGeom::Pointer scanGeom;
+    AttributeMatrix::Pointer scanAttrMat = ImportScans(QStringList(k_HDF5Path), scanGeom);
+    DREAM3D_REQUIRE_VALID_POINTER(scanAttrMat.get())
+
+    ImageGeom::Pointer volumeGeom;
+    AttributeMatrix::Pointer volumeAttrMat = ImportScans(QStringList() << k_HDF5Path << k_HDF5Path, volumeGeom);
+    DREAM3D_REQUIRE_VALID_POINTER(volumeAttrMat.get())
+
+    DREAM3D_REQUIRE_EQUAL(volumeGeom->getXPoints(), scanGeom->getXPoints())
+    DREAM3D_REQUIRE_EQUAL(volumeGeom->getYPoints(), scanGeom->getYPoints())
+    DREAM3D_REQUIRE_EQUAL(scanGeom->getZPoints(), 1)
+    DREAM3D_REQUIRE_EQUAL(volumeGeom->getZPoints(), 2)
+
+    size_t scanTuples = scanAttrMat->getNumberOfTuples();
+    DREAM3D_REQUIRE_EQUAL(volumeAttrMat->getNumberOfTuples(), 2 * scanTuples)
+
+    QList<QString> arrayNames = scanAttrMat->getAttributeArrayNames();
+    DREAM3D_REQUIRE(!arrayNames.isEmpty())
+    for(const QString& name : arrayNames)
+    {
+      IDataArray::Pointer scanArray = scanAttrMat->getAttributeArray(name);
+      IDataArray::Pointer volumeArray = volumeAttrMat->getAttributeArray(name);
+      DREAM3D_REQUIRE_VALID_POINTER(volumeArray.get())
+      DREAM3D_REQUIRE_EQUAL(volumeArray->getNumberOfTuples(), 2 * scanTuples)
+      DREAM3D_REQUIRE_EQUAL(volumeArray->getNumberOfComponents(), scanArray->getNumberOfComponents())
+      for(size_t slice = 0; slice < 2; slice++)
+      {
+        bool compared = CompareSlice<float>(scanArray, volumeArray, slice) || CompareSlice<int32_t>(scanArray, volumeArray, slice) || CompareSlice<uint8_t>(scanArray, volumeArray, slice);
+        DREAM3D_REQUIRE(compared)
+      }
+    }
+
+    return EXIT_SUCCESS;
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -150,6 +252,7 @@ public:
     DREAM3D_REGISTER_TEST(TestFilterAvailability());
 
     DREAM3D_REGISTER_TEST(TestImportH5EspritDataTest())
+    DREAM3D_REGISTER_TEST(TestImportMultipleScans())
 
     DREAM3D_REGISTER_TEST(RemoveTestFiles())
   }
@@ -0,0 +1,267 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include <cstring>
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QFile>
+
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/FilterFactory.hpp"
+#include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/SIMPLib.h"
+#include "UnitTestSupport.hpp"
+
+#include "EbsdLib/EbsdConstants.h"
+#include "EbsdLib/TSL/AngConstants.h"
+
+#include "OrientationAnalysis/OrientationAnalysisFilters/EbsdToH5Ebsd.h"
+#include "OrientationAnalysis/OrientationAnalysisFilters/ReadH5Ebsd.h"
+
+#include "OrientationAnalysisTestFileLocations.h"
+
+class ReadH5EbsdTest
+{
+
+public:
+  ReadH5EbsdTest() = default;
+  ~ReadH5EbsdTest() = default;
+
+  const QString k_FilePrefix = QString("ReadH5EbsdTest_");
+  const int k_NumSlices = 3;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  QString SliceFilePath(int z)
+  {
+    return QString("%1/%2%3.ang").arg(UnitTest::TestTempDir).arg(k_FilePrefix).arg(z);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RemoveTestFiles()
+  {
+#if REMOVE_TEST_FILES
+    for(int z = 1; z <= k_NumSlices; z++)
+    {
+      QFile::remove(SliceFilePath(z));
+    }
+    QFile::remove(UnitTest::ReadH5EbsdTest::H5EbsdFile);
+#endif
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void CreateH5EbsdFile()
+  {
+    for(int z = 1; z <= k_NumSlices; z++)
+    {
+      QFile::remove(SliceFilePath(z));
+      DREAM3D_REQUIRE(QFile::copy(UnitTest::ReadH5EbsdTest::InputFile, SliceFilePath(z)))
+    }
+    QFile::remove(UnitTest::ReadH5EbsdTest::H5EbsdFile);
+
+    EbsdToH5Ebsd::Pointer filter = EbsdToH5Ebsd::New();
+    filter->setInputPath(UnitTest::TestTempDir);
+    filter->setFilePrefix(k_FilePrefix);
+    filter->setFileSuffix(QString(""));
+    filter->setFileExtension(Ebsd::Ang::FileExt);
+    filter->setPaddingDigits(1);
+    filter->setZStartIndex(1);
+    filter->setZEndIndex(k_NumSlices);
+    filter->setZResolution(0.25f);
+    filter->setRefFrameZDir(SIMPL::RefFrameZDir::LowtoHigh);
+    filter->setOutputFile(UnitTest::ReadH5EbsdTest::H5EbsdFile);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  // The region of interest is given in the Cells of the file, so the transformations stay off
+  // to keep the X and Y axes of the volume those of the file.
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer ReadVolume(bool useRegionOfInterest, int xStart, int xEnd, int yStart, int yEnd)
+  {
+    QSet<QString> arrayNames;
+    arrayNames.insert(SIMPL::CellData::Phases);
+    arrayNames.insert(SIMPL::CellData::EulerAngles);
+    arrayNames.insert(Ebsd::Ang::ImageQuality);
+    arrayNames.insert(Ebsd::Ang::ConfidenceIndex);
+    arrayNames.insert(Ebsd::Ang::SEMSignal);
+    arrayNames.insert(Ebsd::Ang::Fit);
+    arrayNames.insert(Ebsd::Ang::XPosition);
+    arrayNames.insert(Ebsd::Ang::YPosition);
+
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    ReadH5Ebsd::Pointer filter = ReadH5Ebsd::New();
+    filter->setDataContainerArray(dca);
+    filter->setInputFile(UnitTest::ReadH5EbsdTest::H5EbsdFile);
+    filter->setZStartIndex(1);
+    filter->setZEndIndex(k_NumSlices);
+    filter->setUseTransformations(false);
+    filter->setSelectedArrayNames(arrayNames);
+    filter->setUseRegionOfInterest(useRegionOfInterest);
+    filter->setXStartIndex(xStart);
+    filter->setXEndIndex(xEnd);
+    filter->setYStartIndex(yStart);
+    filter->setYEndIndex(yEnd);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void CropVolume(const DataContainerArray::Pointer& dca, int xStart, int xEnd, int yStart, int yEnd)
+  {
+    QString filtName = "CropImageGeometry";
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(filtName);
+    if(nullptr == filterFactory.get())
+    {
+      std::stringstream ss;
+      ss << "The ReadH5EbsdTest Requires the use of the " << filtName.toStdString() << " filter";
+      DREAM3D_TEST_THROW_EXCEPTION(ss.str())
+    }
+
+    AbstractFilter::Pointer cropVolume = filterFactory->create();
+    cropVolume->setDataContainerArray(dca);
+
+    QVariant var;
+    var.setValue(DataArrayPath(SIMPL::Defaults::ImageDataContainerName, SIMPL::Defaults::CellAttributeMatrixName, ""));
+    DREAM3D_REQUIRE_EQUAL(cropVolume->setProperty("CellAttributeMatrixPath", var), true)
+    var.setValue(xStart);
+    DREAM3D_REQUIRE_EQUAL(cropVolume->setProperty("XMin", var), true)
+    var.setValue(xEnd);
+    DREAM3D_REQUIRE_EQUAL(cropVolume->setProperty("XMax", var), true)
+    var.setValue(yStart);
+    DREAM3D_REQUIRE_EQUAL(cropVolume->setProperty("YMin", var), true)
+    var.setValue(yEnd);
+    DREAM3D_REQUIRE_EQUAL(cropVolume->setProperty("YMax", var), true)
+    var.setValue(0);
+    DREAM3D_REQUIRE_EQUAL(cropVolume->setProperty("ZMin", var), true)
+    var.setValue(k_NumSlices - 1);
+    DREAM3D_REQUIRE_EQUAL(cropVolume->setProperty("ZMax", var), true)
+    var.setValue(false);
+    DREAM3D_REQUIRE_EQUAL(cropVolume->setProperty("SaveAsNewDataContainer", var), true)
+    var.setValue(false);
+    DREAM3D_REQUIRE_EQUAL(cropVolume->setProperty("RenumberFeatures", var), true)
+
+    cropVolume->execute();
+    DREAM3D_REQUIRED(cropVolume->getErrorCode(), >=, 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  // Reading a region of interest must give exactly the Cells that cropping the whole volume
+  // to the same X and Y index range gives. The region touches neither edge of the slices.
+  // -----------------------------------------------------------------------------
+  void TestRegionOfInterest()
+  {
+    CreateH5EbsdFile();
+
+    DataContainerArray::Pointer fullDca = ReadVolume(false, 0, 0, 0, 0);
+    DataContainer::Pointer fullDc = fullDca->getDataContainer(SIMPL::Defaults::ImageDataContainerName);
+    DREAM3D_REQUIRE_VALID_POINTER(fullDc.get())
+    SizeVec3Type fullDims = fullDc->getGeometryAs<ImageGeom>()->getDimensions();
+    DREAM3D_REQUIRED(fullDims[0], >=, 3)
+    DREAM3D_REQUIRED(fullDims[1], >=, 3)
+    DREAM3D_REQUIRE_EQUAL(fullDims[2], k_NumSlices)
+
+    int xStart = 1;
+    int xEnd = static_cast<int>(fullDims[0]) / 2;
+    int yStart = static_cast<int>(fullDims[1]) / 3;
+    int yEnd = static_cast<int>(fullDims[1]) - 2;
+
+    CropVolume(fullDca, xStart, xEnd, yStart, yEnd);
+    DataContainerArray::Pointer roiDca = ReadVolume(true, xStart, xEnd, yStart, yEnd);
+
+    DataContainer::Pointer croppedDc = fullDca->getDataContainer(SIMPL::Defaults::ImageDataContainerName);
+    DataContainer::Pointer roiDc = roiDca->getDataContainer(SIMPL::Defaults::ImageDataContainerName);
+    DREAM3D_REQUIRE_VALID_POINTER(croppedDc.get())
+    DREAM3D_REQUIRE_VALID_POINTER(roiDc.get())
+
+    SizeVec3Type croppedDims = croppedDc->getGeometryAs<ImageGeom>()->getDimensions();
+    SizeVec3Type roiDims = roiDc->getGeometryAs<ImageGeom>()->getDimensions();
+    DREAM3D_REQUIRE_EQUAL(roiDims[0], static_cast<size_t>(xEnd - xStart + 1))
+    DREAM3D_REQUIRE_EQUAL(roiDims[1], static_cast<size_t>(yEnd - yStart + 1))
+    DREAM3D_REQUIRE_EQUAL(roiDims[2], croppedDims[2])
+    DREAM3D_REQUIRE_EQUAL(roiDims[0], croppedDims[0])
+    DREAM3D_REQUIRE_EQUAL(roiDims[1], croppedDims[1])
+
+    AttributeMatrix::Pointer croppedAM = croppedDc->getAttributeMatrix(SIMPL::Defaults::CellAttributeMatrixName);
+    AttributeMatrix::Pointer roiAM = roiDc->getAttributeMatrix(SIMPL::Defaults::CellAttributeMatrixName);
+    DREAM3D_REQUIRE_VALID_POINTER(croppedAM.get())
+    DREAM3D_REQUIRE_VALID_POINTER(roiAM.get())
+    DREAM3D_REQUIRE_EQUAL(roiAM->getNumberOfTuples(), croppedAM->getNumberOfTuples())
+
+    QList<QString> names = croppedAM->getAttributeArrayNames();
+    DREAM3D_REQUIRE_EQUAL(roiAM->getAttributeArrayNames().size(), names.size())
+    for(const QString& name : names)
+    {
+      IDataArray::Pointer croppedArray = croppedAM->getAttributeArray(name);
+      IDataArray::Pointer roiArray = roiAM->getAttributeArray(name);
+      DREAM3D_REQUIRE_VALID_POINTER(roiArray.get())
+      DREAM3D_REQUIRE_EQUAL(roiArray->getTypeAsString(), croppedArray->getTypeAsString())
+      DREAM3D_REQUIRE_EQUAL(roiArray->getNumberOfComponents(), croppedArray->getNumberOfComponents())
+      DREAM3D_REQUIRE_EQUAL(roiArray->getSize(), croppedArray->getSize())
+      // Compared bit for bit so NaN values count as equal
+      DREAM3D_REQUIRE(::memcmp(roiArray->getVoidPointer(0), croppedArray->getVoidPointer(0), croppedArray->getSize() * croppedArray->getTypeSize()) == 0)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+    std::cout << "#-- ReadH5EbsdTest Starting " << std::endl;
+
+    DREAM3D_REGISTER_TEST(TestRegionOfInterest())
+    DREAM3D_REGISTER_TEST(RemoveTestFiles())
+  }
+
+public:
+  ReadH5EbsdTest(const ReadH5EbsdTest&) = delete;            // Copy Constructor Not Implemented
+  ReadH5EbsdTest(ReadH5EbsdTest&&) = delete;                 // Move Constructor Not Implemented
+  ReadH5EbsdTest& operator=(const ReadH5EbsdTest&) = delete; // Copy Assignment Not Implemented
+  ReadH5EbsdTest& operator=(ReadH5EbsdTest&&) = delete;      // Move Assignment Not Implemented
+};
@@ -33,8 +33,15 @@
 *
 * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_scheduler_init.h>
+#endif
+
 #include "AlignSectionsMisorientation.h"
 
+#include <algorithm>
 #include <fstream>
 
 #include <QtCore/QDateTime>
@@ -235,138 +242,180 @@ void AlignSectionsMisorientation::find_shifts(std::vector<int64_t>& xshifts, std
       static_cast<int64_t>(udims[0]), static_cast<int64_t>(udims[1]), static_cast<int64_t>(udims[2]),
   };
 
-  float disorientation = 0.0f;
-  float mindisorientation = std::numeric_limits<float>::max();
-  int64_t newxshift = 0;
-  int64_t newyshift = 0;
-  int64_t oldxshift = 0;
-  int64_t oldyshift = 0;
-  float count = 0.0f;
-  int64_t slice = 0;
-  float w = 0.0f;
-  float n1 = 0.0f, n2 = 0.0f, n3 = 0.0f;
-  QuatF q1 = QuaternionMathF::New();
-  QuatF q2 = QuaternionMathF::New();
-  int64_t refposition = 0;
-  int64_t curposition = 0;
   QuatF* quats = reinterpret_cast<QuatF*>(m_Quats);
-
-  uint32_t phase1 = 0, phase2 = 0;
-  int64_t progInt = 0;
-
-  // Allocate a 2D Array which will be reused from slice to slice
-  BoolArrayType::Pointer misorientsPtr = BoolArrayType::CreateArray(dims[0] * dims[1], "_INTERNAL_USE_ONLY_Misorients");
-  misorientsPtr->initializeWithValue(false);
-  bool* misorients = misorientsPtr->getPointer(0); // Get the raw pointer to use in our calculations for speed.
-
-  int64_t idx = 0; // This will be used to compute the index into the flat array
-  int64_t xIdx = 0;
-  int64_t yIdx = 0;
+  const QVector<LaueOps::Pointer>& orientationOps = m_OrientationOps;
 
   const int64_t halfDim0 = static_cast<int64_t>(dims[0] * 0.5f);
   const int64_t halfDim1 = static_cast<int64_t>(dims[1] * 0.5f);
-
-  // Loop over the Z Direction
-  for(int64_t iter = 1; iter < dims[2]; iter++)
-  {
-    progInt = ((float)iter / dims[2]) * 100.0f;
-    QString ss = QObject::tr("Aligning Sections || Determining Shifts || %1% Complete").arg(progInt);
-    notifyStatusMessage(ss);
-    if(getCancel())
+  const float misorientationTolerance = m_MisorientationTolerance * SIMPLib::Constants::k_Pif / 180.0f;
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+#endif
+
+  // Fraction of every fourth Cell in X and Y that is misoriented between slice + 1 and
+  // slice when slice is shifted by (xShift, yShift)
+  auto misalignment = [&](int64_t slice, int64_t xShift, int64_t yShift) {
+    float disorientation = 0.0f;
+    float count = 0.0f;
+    float w = 0.0f;
+    float n1 = 0.0f, n2 = 0.0f, n3 = 0.0f;
+    QuatF q1 = QuaternionMathF::New();
+    QuatF q2 = QuaternionMathF::New();
+    uint32_t phase1 = 0, phase2 = 0;
+    for(int64_t l = 0; l < dims[1]; l = l + 4)
     {
-      return;
+      for(int64_t n = 0; n < dims[0]; n = n + 4)
+      {
+        if((l + yShift) >= 0 && (l + yShift) < dims[1] && (n + xShift) >= 0 && (n + xShift) < dims[0])
+        {
+          count++;
+          int64_t refposition = ((slice + 1) * dims[0] * dims[1]) + (l * dims[0]) + n;
+          int64_t curposition = (slice * dims[0] * dims[1]) + ((l + yShift) * dims[0]) + (n + xShift);
+          if(!m_UseGoodVoxels || (m_GoodVoxels[refposition] && m_GoodVoxels[curposition]))
+          {
+            w = std::numeric_limits<float>::max();
+            if(m_CellPhases[refposition] > 0 && m_CellPhases[curposition] > 0)
+            {
+              QuaternionMathF::Copy(quats[refposition], q1);
+              phase1 = m_CrystalStructures[m_CellPhases[refposition]];
+              QuaternionMathF::Copy(quats[curposition], q2);
+              phase2 = m_CrystalStructures[m_CellPhases[curposition]];
+              if(phase1 == phase2 && phase1 < static_cast<uint32_t>(orientationOps.size()))
+              {
+                w = orientationOps[phase1]->getMisoQuat(q1, q2, n1, n2, n3);
+              }
+            }
+            if(w > misorientationTolerance)
+            {
+              disorientation++;
+            }
+          }
+          if(m_UseGoodVoxels)
+          {
+            if(m_GoodVoxels[refposition] && !m_GoodVoxels[curposition])
+            {
+              disorientation++;
+            }
+            if(!m_GoodVoxels[refposition] && m_GoodVoxels[curposition])
+            {
+              disorientation++;
+            }
+          }
+        }
+      }
     }
-    mindisorientation = std::numeric_limits<float>::max();
-    slice = (dims[2] - 1) - iter;
-    oldxshift = -1;
-    oldyshift = -1;
+    return disorientation / count;
+  };
+
+  // Hill climbs from a zero shift in steps of up to 3 Cells until the best shift stops moving.
+  // The candidates of one step are scored in parallel and then compared in the original scan
+  // order, so ties resolve exactly as they would serially
+  auto findShift = [&](int64_t slice, int64_t& newxshift, int64_t& newyshift) {
+    std::vector<bool> misorients(static_cast<size_t>(dims[0] * dims[1]), false);
+    std::vector<int64_t> candidateXShifts;
+    std::vector<int64_t> candidateYShifts;
+    std::vector<float> candidateCosts;
+    float mindisorientation = std::numeric_limits<float>::max();
+    int64_t oldxshift = -1;
+    int64_t oldyshift = -1;
     newxshift = 0;
     newyshift = 0;
-
-    misorientsPtr->initializeWithValue(false); // Initialize everything to false
-
-    float misorientationTolerance = m_MisorientationTolerance * SIMPLib::Constants::k_Pif / 180.0f;
-
     while(newxshift != oldxshift || newyshift != oldyshift)
     {
       oldxshift = newxshift;
       oldyshift = newyshift;
+      candidateXShifts.clear();
+      candidateYShifts.clear();
       for(int32_t j = -3; j < 4; j++)
       {
         for(int32_t k = -3; k < 4; k++)
         {
-          disorientation = 0.0f;
-          count = 0.0f;
-          xIdx = k + oldxshift + halfDim0;
-          yIdx = j + oldyshift + halfDim1;
-          idx = (dims[0] * yIdx) + xIdx;
-          if(!misorients[idx] && llabs(k + oldxshift) < halfDim0 && llabs(j + oldyshift) < halfDim1)
+          if(llabs(k + oldxshift) < halfDim0 && llabs(j + oldyshift) < halfDim1 && !misorients[(dims[0] * (j + oldyshift + halfDim1)) + (k + oldxshift + halfDim0)])
           {
-            for(int64_t l = 0; l < dims[1]; l = l + 4)
-            {
-              for(int64_t n = 0; n < dims[0]; n = n + 4)
-              {
-                if((l + j + oldyshift) >= 0 && (l + j + oldyshift) < dims[1] && (n + k + oldxshift) >= 0 && (n + k + oldxshift) < dims[0])
-                {
-                  count++;
-                  refposition = ((slice + 1) * dims[0] * dims[1]) + (l * dims[0]) + n;
-                  curposition = (slice * dims[0] * dims[1]) + ((l + j + oldyshift) * dims[0]) + (n + k + oldxshift);
-                  if(!m_UseGoodVoxels || (m_GoodVoxels[refposition] && m_GoodVoxels[curposition]))
-                  {
-                    w = std::numeric_limits<float>::max();
-                    if(m_CellPhases[refposition] > 0 && m_CellPhases[curposition] > 0)
-                    {
-                      QuaternionMathF::Copy(quats[refposition], q1);
-                      phase1 = m_CrystalStructures[m_CellPhases[refposition]];
-                      QuaternionMathF::Copy(quats[curposition], q2);
-                      phase2 = m_CrystalStructures[m_CellPhases[curposition]];
-                      if(phase1 == phase2 && phase1 < static_cast<uint32_t>(m_OrientationOps.size()))
-                      {
-                        w = m_OrientationOps[phase1]->getMisoQuat(q1, q2, n1, n2, n3);
-                      }
-                    }
-                    if(w > misorientationTolerance)
-                    {
-                      disorientation++;
-                    }
-                  }
-                  if(m_UseGoodVoxels)
-                  {
-                    if(m_GoodVoxels[refposition] && !m_GoodVoxels[curposition])
-                    {
-                      disorientation++;
-                    }
-                    if(!m_GoodVoxels[refposition] && m_GoodVoxels[curposition])
-                    {
-                      disorientation++;
-                    }
-                  }
-                }
-                else
-                {
-                }
-              }
-            }
-            disorientation = disorientation / count;
-            xIdx = k + oldxshift + halfDim0;
-            yIdx = j + oldyshift + halfDim1;
-            idx = (dims[0] * yIdx) + xIdx;
-            misorients[idx] = true;
-            if(disorientation < mindisorientation || (disorientation == mindisorientation && ((llabs(k + oldxshift) < llabs(newxshift)) || (llabs(j + oldyshift) < llabs(newyshift)))))
-            {
-              newxshift = k + oldxshift;
-              newyshift = j + oldyshift;
-              mindisorientation = disorientation;
-            }
+            candidateXShifts.push_back(k + oldxshift);
+            candidateYShifts.push_back(j + oldyshift);
           }
         }
       }
+
+      size_t numCandidates = candidateXShifts.size();
+      candidateCosts.resize(numCandidates);
+      auto scoreCandidates = [&](size_t start, size_t end) {
+        for(size_t c = start; c < end; c++)
+        {
+          candidateCosts[c] = misalignment(slice, candidateXShifts[c], candidateYShifts[c]);
+        }
+      };
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+      if(doParallel)
+      {
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, numCandidates, 1), [&](const tbb::blocked_range<size_t>& r) { scoreCandidates(r.begin(), r.end()); });
+      }
+      else
+#endif
+      {
+        scoreCandidates(0, numCandidates);
+      }
+
+      for(size_t c = 0; c < numCandidates; c++)
+      {
+        int64_t xShift = candidateXShifts[c];
+        int64_t yShift = candidateYShifts[c];
+        float disorientation = candidateCosts[c];
+        misorients[(dims[0] * (yShift + halfDim1)) + (xShift + halfDim0)] = true;
+        if(disorientation < mindisorientation || (disorientation == mindisorientation && ((llabs(xShift) < llabs(newxshift)) || (llabs(yShift) < llabs(newyshift)))))
+        {
+          newxshift = xShift;
+          newyshift = yShift;
+          mindisorientation = disorientation;
+        }
+      }
     }
-    xshifts[iter] = xshifts[iter - 1] + newxshift;
-    yshifts[iter] = yshifts[iter - 1] + newyshift;
+  };
+
+  // Each pair of neighboring slices is registered on its own, so the pairs are searched in
+  // parallel a chunk at a time and the cumulative shifts are summed up afterwards
+  std::vector<int64_t> pairXShifts(dims[2], 0);
+  std::vector<int64_t> pairYShifts(dims[2], 0);
+  const int64_t pairChunkSize = 32;
+  for(int64_t chunkStart = 1; chunkStart < dims[2]; chunkStart += pairChunkSize)
+  {
+    int64_t progInt = static_cast<int64_t>(((float)chunkStart / dims[2]) * 100.0f);
+    QString ss = QObject::tr("Aligning Sections || Determining Shifts || %1% Complete").arg(progInt);
+    notifyStatusMessage(ss);
+    if(getCancel())
+    {
+      return;
+    }
+    int64_t chunkEnd = std::min(chunkStart + pairChunkSize, dims[2]);
+    auto searchPairs = [&](int64_t start, int64_t end) {
+      for(int64_t iter = start; iter < end; iter++)
+      {
+        findShift((dims[2] - 1) - iter, pairXShifts[iter], pairYShifts[iter]);
+      }
+    };
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    if(doParallel)
+    {
+      tbb::parallel_for(tbb::blocked_range<int64_t>(chunkStart, chunkEnd, 1), [&](const tbb::blocked_range<int64_t>& r) { searchPairs(r.begin(), r.end()); });
+    }
+    else
+#endif
+    {
+      searchPairs(chunkStart, chunkEnd);
+    }
+  }
+
+  for(int64_t iter = 1; iter < dims[2]; iter++)
+  {
+    int64_t slice = (dims[2] - 1) - iter;
+    xshifts[iter] = xshifts[iter - 1] + pairXShifts[iter];
+    yshifts[iter] = yshifts[iter - 1] + pairYShifts[iter];
     if(getWriteAlignmentShifts())
     {
-      outFile << slice << "	" << slice + 1 << "	" << newxshift << "	" << newyshift << "	" << xshifts[iter] << "	" << yshifts[iter] << "\n";
+      outFile << slice << "	" << slice + 1 << "	" << pairXShifts[iter] << "	" << pairYShifts[iter] << "	" << xshifts[iter] << "	" << yshifts[iter] << "\n";
     }
   }
   if(getWriteAlignmentShifts())
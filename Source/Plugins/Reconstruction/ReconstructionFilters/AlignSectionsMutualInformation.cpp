@@ -32,8 +32,15 @@
 *    United States Prime Contract Navy N00173-07-C-2068
 *
 * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_scheduler_init.h>
+#endif
+
 #include "AlignSectionsMutualInformation.h"
 
+#include <algorithm>
 #include <fstream>
 
 #include "SIMPLib/Common/Constants.h"
@@ -238,180 +245,178 @@ void AlignSectionsMutualInformation::find_shifts(std::vector<int64_t>& xshifts,
       static_cast<int64_t>(udims[0]), static_cast<int64_t>(udims[1]), static_cast<int64_t>(udims[2]),
   };
 
-  float disorientation = 0.0f;
-  float mindisorientation = std::numeric_limits<float>::max();
-  float** mutualinfo12 = nullptr;
-  float* mutualinfo1 = nullptr;
-  float* mutualinfo2 = nullptr;
-  int32_t featurecount1 = 0, featurecount2 = 0;
-  int64_t newxshift = 0;
-  int64_t newyshift = 0;
-  int64_t oldxshift = 0;
-  int64_t oldyshift = 0;
-  float count = 0.0f;
-  int64_t slice = 0;
-
-  int32_t refgnum = 0, curgnum = 0;
-  int64_t refposition = 0;
-  int64_t curposition = 0;
-
   form_features_sections();
 
-  std::vector<std::vector<float>> misorients;
-  misorients.resize(dims[0]);
-  for(int64_t a = 0; a < dims[0]; a++)
-  {
-    misorients[a].assign(dims[1], 0.0f);
-  }
-
-  for(int64_t iter = 1; iter < dims[2]; iter++)
-  {
-    float prog = ((float)iter / dims[2]) * 100;
-    QString ss = QObject::tr("Aligning Sections || Determining Shifts || %1% Complete").arg(QString::number(prog, 'f', 0));
-    notifyStatusMessage(ss);
-    mindisorientation = std::numeric_limits<float>::max();
-    slice = (dims[2] - 1) - iter;
-    featurecount1 = featurecounts[slice];
-    featurecount2 = featurecounts[slice + 1];
-    mutualinfo12 = new float*[featurecount1];
-    mutualinfo1 = new float[featurecount1];
-    mutualinfo2 = new float[featurecount2];
-
-    for(int32_t a = 0; a < featurecount1; a++)
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+#endif
+
+  // Inverse of the mutual information between the section Features of slice + 1 and slice
+  // when slice is shifted by (xShift, yShift), sampled at every fourth Cell in X and Y. The
+  // histograms are local to the call so candidate shifts can be scored concurrently
+  auto misalignment = [&](int64_t slice, int64_t xShift, int64_t yShift) {
+    int32_t featurecount1 = featurecounts[slice];
+    int32_t featurecount2 = featurecounts[slice + 1];
+    std::vector<float> mutualinfo12(static_cast<size_t>(featurecount1) * featurecount2, 0.0f);
+    std::vector<float> mutualinfo1(featurecount1, 0.0f);
+    std::vector<float> mutualinfo2(featurecount2, 0.0f);
+    float disorientation = 0.0f;
+    float count = 0.0f;
+    for(int64_t l = 0; l < dims[1]; l = l + 4)
     {
-      mutualinfo1[a] = 0.0f;
-      mutualinfo12[a] = new float[featurecount2];
-      for(int32_t b = 0; b < featurecount2; b++)
+      for(int64_t n = 0; n < dims[0]; n = n + 4)
       {
-        mutualinfo12[a][b] = 0.0f;
-        mutualinfo2[b] = 0.0f;
+        if((l + yShift) >= 0 && (l + yShift) < dims[1] && (n + xShift) >= 0 && (n + xShift) < dims[0])
+        {
+          int64_t refposition = ((slice + 1) * dims[0] * dims[1]) + (l * dims[0]) + n;
+          int64_t curposition = (slice * dims[0] * dims[1]) + ((l + yShift) * dims[0]) + (n + xShift);
+          int32_t refgnum = miFeatureIds[refposition];
+          int32_t curgnum = miFeatureIds[curposition];
+          if(curgnum >= 0 && refgnum >= 0)
+          {
+            mutualinfo12[curgnum * featurecount2 + refgnum]++;
+            mutualinfo1[curgnum]++;
+            mutualinfo2[refgnum]++;
+            count++;
+          }
+        }
+        else
+        {
+          mutualinfo12[0]++;
+          mutualinfo1[0]++;
+          mutualinfo2[0]++;
+        }
       }
     }
-    oldxshift = -1;
-    oldyshift = -1;
-    newxshift = 0;
-    newyshift = 0;
-    for(int64_t a = 0; a < dims[0]; a++)
+    for(int32_t b = 0; b < featurecount1; b++)
     {
-      for(int64_t b = 0; b < dims[1]; b++)
+      mutualinfo1[b] = mutualinfo1[b] / count;
+    }
+    for(int32_t c = 0; c < featurecount2; c++)
+    {
+      mutualinfo2[c] = mutualinfo2[c] / float(count);
+    }
+    for(int32_t b = 0; b < featurecount1; b++)
+    {
+      for(int32_t c = 0; c < featurecount2; c++)
       {
-        misorients[a][b] = 0;
+        float joint = mutualinfo12[b * featurecount2 + c] / count;
+        float value = 0.0f;
+        if(mutualinfo1[b] > 0 && mutualinfo2[c] > 0)
+        {
+          value = (joint / (mutualinfo1[b] * mutualinfo2[c]));
+        }
+        if(value != 0)
+        {
+          disorientation = disorientation + (joint * logf(value));
+        }
       }
     }
+    return 1.0f / disorientation;
+  };
+
+  // Hill climbs from a zero shift in steps of up to 3 Cells until the best shift stops moving.
+  // The candidates of one step are scored in parallel and then compared in the original scan
+  // order, so the result is the same as a serial search
+  auto findShift = [&](int64_t slice, int64_t& newxshift, int64_t& newyshift) {
+    std::vector<bool> misorients(static_cast<size_t>(dims[0] * dims[1]), false);
+    std::vector<int64_t> candidateXShifts;
+    std::vector<int64_t> candidateYShifts;
+    std::vector<float> candidateCosts;
+    float mindisorientation = std::numeric_limits<float>::max();
+    int64_t oldxshift = -1;
+    int64_t oldyshift = -1;
+    newxshift = 0;
+    newyshift = 0;
     while(newxshift != oldxshift || newyshift != oldyshift)
     {
       oldxshift = newxshift;
       oldyshift = newyshift;
+      candidateXShifts.clear();
+      candidateYShifts.clear();
       for(int32_t j = -3; j < 4; j++)
       {
         for(int32_t k = -3; k < 4; k++)
         {
-          disorientation = 0;
-          count = 0;
-          if(misorients[k + oldxshift + dims[0] / 2][j + oldyshift + dims[1] / 2] == 0 && llabs(k + oldxshift) < (dims[0] / 2) && (j + oldyshift) < (dims[1] / 2))
+          if(llabs(k + oldxshift) < (dims[0] / 2) && llabs(j + oldyshift) < (dims[1] / 2) && !misorients[(dims[0] * (j + oldyshift + dims[1] / 2)) + (k + oldxshift + dims[0] / 2)])
           {
-            for(int64_t l = 0; l < dims[1]; l = l + 4)
-            {
-              for(int64_t n = 0; n < dims[0]; n = n + 4)
-              {
-                if((l + j + oldyshift) >= 0 && (l + j + oldyshift) < dims[1] && (n + k + oldxshift) >= 0 && (n + k + oldxshift) < dims[0])
-                {
-                  refposition = ((slice + 1) * dims[0] * dims[1]) + (l * dims[0]) + n;
-                  curposition = (slice * dims[0] * dims[1]) + ((l + j + oldyshift) * dims[0]) + (n + k + oldxshift);
-                  refgnum = miFeatureIds[refposition];
-                  curgnum = miFeatureIds[curposition];
-                  if(curgnum >= 0 && refgnum >= 0)
-                  {
-                    mutualinfo12[curgnum][refgnum]++;
-                    mutualinfo1[curgnum]++;
-                    mutualinfo2[refgnum]++;
-                    count++;
-                  }
-                }
-                else
-                {
-                  mutualinfo12[0][0]++;
-                  mutualinfo1[0]++;
-                  mutualinfo2[0]++;
-                }
-              }
-            }
-            float ha = 0.0f;
-            float hb = 0.0f;
-            float hab = 0.0f;
-            for(int32_t b = 0; b < featurecount1; b++)
-            {
-              mutualinfo1[b] = mutualinfo1[b] / count;
-              if(mutualinfo1[b] != 0)
-              {
-                ha = ha + mutualinfo1[b] * logf(mutualinfo1[b]);
-              }
-            }
-            for(int32_t c = 0; c < featurecount2; c++)
-            {
-              mutualinfo2[c] = mutualinfo2[c] / float(count);
-              if(mutualinfo2[c] != 0)
-              {
-                hb = hb + mutualinfo2[c] * logf(mutualinfo2[c]);
-              }
-            }
-            for(int32_t b = 0; b < featurecount1; b++)
-            {
-              for(int32_t c = 0; c < featurecount2; c++)
-              {
-                mutualinfo12[b][c] = mutualinfo12[b][c] / count;
-                if(mutualinfo12[b][c] != 0)
-                {
-                  hab = hab + mutualinfo12[b][c] * logf(mutualinfo12[b][c]);
-                }
-                float value = 0.0f;
-                if(mutualinfo1[b] > 0 && mutualinfo2[c] > 0)
-                {
-                  value = (mutualinfo12[b][c] / (mutualinfo1[b] * mutualinfo2[c]));
-                }
-                if(value != 0)
-                {
-                  disorientation = disorientation + (mutualinfo12[b][c] * logf(value));
-                }
-              }
-            }
-            for(int32_t b = 0; b < featurecount1; b++)
-            {
-              for(int32_t c = 0; c < featurecount2; c++)
-              {
-                mutualinfo12[b][c] = 0.0f;
-                mutualinfo1[b] = 0.0f;
-                mutualinfo2[c] = 0.0f;
-              }
-            }
-            disorientation = 1.0f / disorientation;
-            misorients[k + oldxshift + dims[0] / 2][j + oldyshift + dims[1] / 2] = disorientation;
-            if(disorientation < mindisorientation)
-            {
-              newxshift = k + oldxshift;
-              newyshift = j + oldyshift;
-              mindisorientation = disorientation;
-            }
+            candidateXShifts.push_back(k + oldxshift);
+            candidateYShifts.push_back(j + oldyshift);
           }
         }
       }
+
+      size_t numCandidates = candidateXShifts.size();
+      candidateCosts.resize(numCandidates);
+      auto scoreCandidates = [&](size_t start, size_t end) {
+        for(size_t c = start; c < end; c++)
+        {
+          candidateCosts[c] = misalignment(slice, candidateXShifts[c], candidateYShifts[c]);
+        }
+      };
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+      if(doParallel)
+      {
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, numCandidates, 1), [&](const tbb::blocked_range<size_t>& r) { scoreCandidates(r.begin(), r.end()); });
+      }
+      else
+#endif
+      {
+        scoreCandidates(0, numCandidates);
+      }
+
+      for(size_t c = 0; c < numCandidates; c++)
+      {
+        misorients[(dims[0] * (candidateYShifts[c] + dims[1] / 2)) + (candidateXShifts[c] + dims[0] / 2)] = true;
+        if(candidateCosts[c] < mindisorientation)
+        {
+          newxshift = candidateXShifts[c];
+          newyshift = candidateYShifts[c];
+          mindisorientation = candidateCosts[c];
+        }
+      }
     }
-    xshifts[iter] = xshifts[iter - 1] + newxshift;
-    yshifts[iter] = yshifts[iter - 1] + newyshift;
-    if(getWriteAlignmentShifts())
+  };
+
+  // Each pair of neighboring slices is registered on its own, so the pairs are searched in
+  // parallel a chunk at a time and the cumulative shifts are summed up afterwards
+  std::vector<int64_t> pairXShifts(dims[2], 0);
+  std::vector<int64_t> pairYShifts(dims[2], 0);
+  const int64_t pairChunkSize = 32;
+  for(int64_t chunkStart = 1; chunkStart < dims[2] && !getCancel(); chunkStart += pairChunkSize)
+  {
+    float prog = ((float)chunkStart / dims[2]) * 100;
+    QString ss = QObject::tr("Aligning Sections || Determining Shifts || %1% Complete").arg(QString::number(prog, 'f', 0));
+    notifyStatusMessage(ss);
+    int64_t chunkEnd = std::min(chunkStart + pairChunkSize, dims[2]);
+    auto searchPairs = [&](int64_t start, int64_t end) {
+      for(int64_t iter = start; iter < end; iter++)
+      {
+        findShift((dims[2] - 1) - iter, pairXShifts[iter], pairYShifts[iter]);
+      }
+    };
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    if(doParallel)
+    {
+      tbb::parallel_for(tbb::blocked_range<int64_t>(chunkStart, chunkEnd, 1), [&](const tbb::blocked_range<int64_t>& r) { searchPairs(r.begin(), r.end()); });
+    }
+    else
+#endif
     {
-      outFile << slice << "	" << slice + 1 << "	" << newxshift << "	" << newyshift << "	" << xshifts[iter] << "	" << yshifts[iter] << "\n";
+      searchPairs(chunkStart, chunkEnd);
     }
-    delete[] mutualinfo1;
-    delete[] mutualinfo2;
-    for(int32_t i = 0; i < featurecount1; i++)
+  }
+
+  for(int64_t iter = 1; iter < dims[2]; iter++)
+  {
+    int64_t slice = (dims[2] - 1) - iter;
+    xshifts[iter] = xshifts[iter - 1] + pairXShifts[iter];
+    yshifts[iter] = yshifts[iter - 1] + pairYShifts[iter];
+    if(getWriteAlignmentShifts())
     {
-      delete mutualinfo12[i];
+      outFile << slice << "	" << slice + 1 << "	" << pairXShifts[iter] << "	" << pairYShifts[iter] << "	" << xshifts[iter] << "	" << yshifts[iter] << "\n";
     }
-    delete[] mutualinfo12;
-    mutualinfo1 = nullptr;
-    mutualinfo2 = nullptr;
-    mutualinfo12 = nullptr;
   }
 
   m->getAttributeMatrix(getCellAttributeMatrixName())->removeAttributeArray(SIMPL::CellData::FeatureIds);
@@ -172,6 +172,8 @@ protected:
    */
   void form_features_sections();
 
+  Int32ArrayType::Pointer m_MIFeaturesPtr;
+
 private:
   // DEFINE_DATAARRAY_VARIABLE(int32_t, FeatureIds)
   DEFINE_DATAARRAY_VARIABLE(float, Quats)
@@ -181,7 +183,6 @@ private:
 
   QVector<LaueOps::Pointer> m_OrientationOps;
 
-  Int32ArrayType::Pointer m_MIFeaturesPtr;
   uint64_t m_RandomSeed;
 
 public:
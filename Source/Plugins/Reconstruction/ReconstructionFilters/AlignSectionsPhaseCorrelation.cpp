@@ -0,0 +1,541 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_scheduler_init.h>
+#endif
+
+#include "AlignSectionsPhaseCorrelation.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <limits>
+
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/Common/TemplateHelpers.h"
+#include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
+#include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
+#include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+
+#include "Reconstruction/ReconstructionConstants.h"
+#include "Reconstruction/ReconstructionFilters/util/FastFourierTransform.h"
+#include "Reconstruction/ReconstructionVersion.h"
+
+namespace Detail
+{
+using SliceReader = std::function<void(size_t, size_t, float*)>;
+
+/**
+ * @brief CreateSliceReader Creates a function that copies count values of the selected array starting
+ * at offset into a float buffer, so the rest of the filter does not need to be templated on the array type
+ * @param inputArrayPtr
+ * @param reader
+ */
+template <typename T> void CreateSliceReader(IDataArray::Pointer inputArrayPtr, SliceReader& reader)
+{
+  T* data = std::dynamic_pointer_cast<DataArray<T>>(inputArrayPtr)->getPointer(0);
+  reader = [data](size_t offset, size_t count, float* values) {
+    for(size_t i = 0; i < count; i++)
+    {
+      values[i] = static_cast<float>(data[offset + i]);
+    }
+  };
+}
+
+/**
+ * @brief HannWindow Returns the Hann window of length n, which tapers a slice to zero at its edges so
+ * that the periodic boundaries the FFT assumes do not dominate the correlation
+ * @param n
+ * @return
+ */
+std::vector<float> HannWindow(int64_t n)
+{
+  std::vector<float> window(n, 1.0f);
+  for(int64_t i = 0; i < n && n > 1; i++)
+  {
+    window[i] = static_cast<float>(0.5 - 0.5 * std::cos(2.0 * SIMPLib::Constants::k_Pi * static_cast<double>(i) / static_cast<double>(n - 1)));
+  }
+  return window;
+}
+
+/**
+ * @brief PeakOffset Returns the subpixel offset of a phase correlation peak from the samples on either side
+ * of it. The peak of a shifted delta is a sampled sinc, for which the offset follows from the ratio of the
+ * larger neighbor to the peak (H. Foroosh et al., IEEE Trans. Image Processing 11(3), 2002)
+ * @param left
+ * @param center
+ * @param right
+ * @return
+ */
+float PeakOffset(float left, float center, float right)
+{
+  if(right >= left && right > 0.0f)
+  {
+    return right / (right + center);
+  }
+  if(left > right && left > 0.0f)
+  {
+    return -left / (left + center);
+  }
+  return 0.0f;
+}
+} // namespace Detail
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+AlignSectionsPhaseCorrelation::AlignSectionsPhaseCorrelation()
+: m_SubpixelShifts(false)
+, m_UseGoodVoxels(false)
+, m_SelectedArrayPath(SIMPL::Defaults::ImageDataContainerName, SIMPL::Defaults::CellAttributeMatrixName, "")
+, m_GoodVoxelsArrayPath(SIMPL::Defaults::ImageDataContainerName, SIMPL::Defaults::CellAttributeMatrixName, SIMPL::CellData::Mask)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+AlignSectionsPhaseCorrelation::~AlignSectionsPhaseCorrelation() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void AlignSectionsPhaseCorrelation::setupFilterParameters()
+{
+  // getting the current parameters that were set by the parent and adding to it before resetting it
+  AlignSections::setupFilterParameters();
+  FilterParameterVectorType parameters = getFilterParameters();
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Subpixel Shifts", SubpixelShifts, FilterParameter::Parameter, AlignSectionsPhaseCorrelation));
+  QStringList linkedProps("GoodVoxelsArrayPath");
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Use Mask Array", UseGoodVoxels, FilterParameter::Parameter, AlignSectionsPhaseCorrelation, linkedProps));
+  parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
+  {
+    DataArraySelectionFilterParameter::RequirementType req =
+        DataArraySelectionFilterParameter::CreateRequirement(SIMPL::Defaults::AnyPrimitive, 1, AttributeMatrix::Type::Cell, IGeometry::Type::Image);
+    parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Alignment Array", SelectedArrayPath, FilterParameter::RequiredArray, AlignSectionsPhaseCorrelation, req));
+  }
+  {
+    DataArraySelectionFilterParameter::RequirementType req =
+        DataArraySelectionFilterParameter::CreateRequirement(SIMPL::TypeNames::Bool, 1, AttributeMatrix::Type::Cell, IGeometry::Type::Image);
+    parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Mask", GoodVoxelsArrayPath, FilterParameter::RequiredArray, AlignSectionsPhaseCorrelation, req));
+  }
+  setFilterParameters(parameters);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void AlignSectionsPhaseCorrelation::readFilterParameters(AbstractFilterParametersReader* reader, int index)
+{
+  AlignSections::readFilterParameters(reader, index);
+  reader->openFilterGroup(this, index);
+  setSubpixelShifts(reader->readValue("SubpixelShifts", getSubpixelShifts()));
+  setUseGoodVoxels(reader->readValue("UseGoodVoxels", getUseGoodVoxels()));
+  setSelectedArrayPath(reader->readDataArrayPath("SelectedArrayPath", getSelectedArrayPath()));
+  setGoodVoxelsArrayPath(reader->readDataArrayPath("GoodVoxelsArrayPath", getGoodVoxelsArrayPath()));
+  reader->closeFilterGroup();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void AlignSectionsPhaseCorrelation::initialize()
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void AlignSectionsPhaseCorrelation::dataCheck()
+{
+  clearErrorCode();
+  clearWarningCode();
+  initialize();
+
+  // Set the DataContainerName and AttributematrixName for the Parent Class (AlignSections) to Use.
+  setDataContainerName(DataArrayPath(m_SelectedArrayPath.getDataContainerName(), "", ""));
+  setCellAttributeMatrixName(m_SelectedArrayPath.getAttributeMatrixName());
+
+  AlignSections::dataCheck();
+  if(getErrorCode() < 0)
+  {
+    return;
+  }
+
+  QVector<DataArrayPath> dataArrayPaths;
+
+  m_SelectedArrayPtr = getDataContainerArray()->getPrereqIDataArrayFromPath<IDataArray, AbstractFilter>(this, getSelectedArrayPath());
+  if(nullptr != m_SelectedArrayPtr.lock())
+  {
+    m_SelectedArray = m_SelectedArrayPtr.lock()->getVoidPointer(0);
+    if(m_SelectedArrayPtr.lock()->getNumberOfComponents() != 1)
+    {
+      QString ss = QObject::tr("The selected array is not a scalar array. The number of components is %1").arg(m_SelectedArrayPtr.lock()->getNumberOfComponents());
+      setErrorCondition(-3011, ss);
+    }
+  }
+  if(getErrorCode() >= 0)
+  {
+    dataArrayPaths.push_back(getSelectedArrayPath());
+  }
+
+  if(m_UseGoodVoxels)
+  {
+    QVector<size_t> cDims(1, 1);
+    m_GoodVoxelsPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<bool>, AbstractFilter>(this, getGoodVoxelsArrayPath(),
+                                                                                                       cDims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
+    if(nullptr != m_GoodVoxelsPtr.lock())                                                                      /* Validate the Weak Pointer wraps a non-nullptr pointer to a DataArray<T> object */
+    {
+      m_GoodVoxels = m_GoodVoxelsPtr.lock()->getPointer(0);
+    } /* Now assign the raw pointer to data from the DataArray<T> object */
+    if(getErrorCode() >= 0)
+    {
+      dataArrayPaths.push_back(getGoodVoxelsArrayPath());
+    }
+  }
+
+  getDataContainerArray()->validateNumberOfTuples<AbstractFilter>(this, dataArrayPaths);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void AlignSectionsPhaseCorrelation::preflight()
+{
+  setInPreflight(true);
+  emit preflightAboutToExecute();
+  emit updateFilterParameters(this);
+  dataCheck();
+  emit preflightExecuted();
+  setInPreflight(false);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void AlignSectionsPhaseCorrelation::find_shifts(std::vector<int64_t>& xshifts, std::vector<int64_t>& yshifts)
+{
+  using ComplexType = FastFourierTransform::ComplexType;
+
+  DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getDataContainerName());
+
+  SizeVec3Type udims = m->getGeometryAs<ImageGeom>()->getDimensions();
+
+  int64_t dims[3] = {
+      static_cast<int64_t>(udims[0]), static_cast<int64_t>(udims[1]), static_cast<int64_t>(udims[2]),
+  };
+
+  Detail::SliceReader readSlice;
+  EXECUTE_FUNCTION_TEMPLATE(this, Detail::CreateSliceReader, m_SelectedArrayPtr.lock(), m_SelectedArrayPtr.lock(), readSlice)
+  if(getErrorCode() < 0)
+  {
+    return;
+  }
+
+  std::ofstream outFile;
+  if(getWriteAlignmentShifts())
+  {
+    outFile.open(getAlignmentShiftFileName().toLatin1().data());
+  }
+
+  // Slices are zero padded to a power of two in each direction. The FFT correlates circularly, so
+  // the padding has to cover the slice extent plus the largest shift searched. With at least one and
+  // a half slice extents the overlap of a shift of less than half the slice never wraps around
+  const int64_t sliceSize = dims[0] * dims[1];
+  const int64_t paddedWidth = static_cast<int64_t>(FastFourierTransform::NextPowerOfTwo(static_cast<size_t>(dims[0] + dims[0] / 2)));
+  const int64_t paddedHeight = static_cast<int64_t>(FastFourierTransform::NextPowerOfTwo(static_cast<size_t>(dims[1] + dims[1] / 2)));
+  const int64_t paddedSize = paddedWidth * paddedHeight;
+  const int64_t halfDim0 = dims[0] / 2;
+  const int64_t halfDim1 = dims[1] / 2;
+  const std::vector<float> windowX = Detail::HannWindow(dims[0]);
+  const std::vector<float> windowY = Detail::HannWindow(dims[1]);
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+#endif
+
+  // Spectrum of one slice with its (masked) mean removed and a Hann window applied. Cells
+  // outside the mask are set to the mean so they do not contribute to the correlation
+  auto computeSpectrum = [&](int64_t slice, std::vector<ComplexType>& spectrum) {
+    const int64_t offset = slice * sliceSize;
+    std::vector<float> values(sliceSize, 0.0f);
+    readSlice(static_cast<size_t>(offset), static_cast<size_t>(sliceSize), values.data());
+    double sum = 0.0;
+    size_t count = 0;
+    for(int64_t i = 0; i < sliceSize; i++)
+    {
+      if(!m_UseGoodVoxels || m_GoodVoxels[offset + i])
+      {
+        sum += values[i];
+        count++;
+      }
+    }
+    const float mean = count > 0 ? static_cast<float>(sum / static_cast<double>(count)) : 0.0f;
+    spectrum.assign(paddedSize, ComplexType(0.0f, 0.0f));
+    for(int64_t y = 0; y < dims[1]; y++)
+    {
+      for(int64_t x = 0; x < dims[0]; x++)
+      {
+        int64_t index = y * dims[0] + x;
+        if(!m_UseGoodVoxels || m_GoodVoxels[offset + index])
+        {
+          spectrum[y * paddedWidth + x] = ComplexType((values[index] - mean) * windowX[x] * windowY[y], 0.0f);
+        }
+      }
+    }
+    FastFourierTransform::Transform2D(spectrum.data(), paddedWidth, paddedHeight, false);
+  };
+
+  // The normalized cross power spectrum of the two slices transforms back to a peak at the
+  // shift (xShift, yShift) for which current(x + xShift, y + yShift) best matches reference(x, y).
+  // Only shifts of less than half the slice are considered, like the other alignment filters
+  auto findShift = [&](const std::vector<ComplexType>& current, const std::vector<ComplexType>& reference, float& xShift, float& yShift) {
+    std::vector<ComplexType> correlation(paddedSize);
+    for(int64_t i = 0; i < paddedSize; i++)
+    {
+      ComplexType crossPower = current[i] * std::conj(reference[i]);
+      float magnitude = std::abs(crossPower);
+      correlation[i] = magnitude > 0.0f ? crossPower / magnitude : ComplexType(0.0f, 0.0f);
+    }
+    FastFourierTransform::Transform2D(correlation.data(), paddedWidth, paddedHeight, true);
+
+    int64_t peakX = 0;
+    int64_t peakY = 0;
+    float peakValue = -std::numeric_limits<float>::max();
+    for(int64_t y = 0; y < paddedHeight; y++)
+    {
+      int64_t dy = (y <= paddedHeight / 2) ? y : y - paddedHeight;
+      if(llabs(dy) >= halfDim1)
+      {
+        continue;
+      }
+      for(int64_t x = 0; x < paddedWidth; x++)
+      {
+        int64_t dx = (x <= paddedWidth / 2) ? x : x - paddedWidth;
+        if(llabs(dx) >= halfDim0)
+        {
+          continue;
+        }
+        float value = correlation[y * paddedWidth + x].real();
+        if(value > peakValue)
+        {
+          peakValue = value;
+          peakX = x;
+          peakY = y;
+        }
+      }
+    }
+
+    xShift = static_cast<float>((peakX <= paddedWidth / 2) ? peakX : peakX - paddedWidth);
+    yShift = static_cast<float>((peakY <= paddedHeight / 2) ? peakY : peakY - paddedHeight);
+    if(m_SubpixelShifts)
+    {
+      int64_t left = (peakX + paddedWidth - 1) % paddedWidth;
+      int64_t right = (peakX + 1) % paddedWidth;
+      int64_t below = (peakY + paddedHeight - 1) % paddedHeight;
+      int64_t above = (peakY + 1) % paddedHeight;
+      xShift += Detail::PeakOffset(correlation[peakY * paddedWidth + left].real(), peakValue, correlation[peakY * paddedWidth + right].real());
+      yShift += Detail::PeakOffset(correlation[below * paddedWidth + peakX].real(), peakValue, correlation[above * paddedWidth + peakX].real());
+    }
+  };
+
+  // Slice pairs are processed a chunk at a time. The spectra of the chunk's slices are computed in
+  // parallel and each one is shared by the two pairs it belongs to, then the pairs are correlated
+  // in parallel. The chunk size keeps the spectra held at once to roughly 256 MB
+  const int64_t spectrumBytes = paddedSize * static_cast<int64_t>(sizeof(ComplexType));
+  const int64_t pairChunkSize = std::max<int64_t>(1, std::min<int64_t>(32, (static_cast<int64_t>(256) << 20) / (2 * spectrumBytes)));
+  std::vector<float> pairXShifts(dims[2], 0.0f);
+  std::vector<float> pairYShifts(dims[2], 0.0f);
+  std::vector<std::vector<ComplexType>> spectra(pairChunkSize + 1);
+
+  for(int64_t chunkStart = 1; chunkStart < dims[2]; chunkStart += pairChunkSize)
+  {
+    float prog = ((float)chunkStart / dims[2]) * 100;
+    QString ss = QObject::tr("Aligning Sections || Determining Shifts || %1% Complete").arg(QString::number(prog, 'f', 0));
+    notifyStatusMessage(ss);
+    if(getCancel())
+    {
+      return;
+    }
+
+    // Pair iter compares slice (dims[2] - 1) - iter with the slice above it, so the chunk
+    // covers the slices from lowestSlice up to lowestSlice + numPairs
+    const int64_t chunkEnd = std::min(chunkStart + pairChunkSize, dims[2]);
+    const int64_t numPairs = chunkEnd - chunkStart;
+    const int64_t lowestSlice = (dims[2] - 1) - (chunkEnd - 1);
+
+    auto computeSpectra = [&](int64_t start, int64_t end) {
+      for(int64_t i = start; i < end; i++)
+      {
+        computeSpectrum(lowestSlice + i, spectra[i]);
+      }
+    };
+    auto correlatePairs = [&](int64_t start, int64_t end) {
+      for(int64_t iter = start; iter < end; iter++)
+      {
+        int64_t slice = (dims[2] - 1) - iter;
+        findShift(spectra[slice - lowestSlice], spectra[slice + 1 - lowestSlice], pairXShifts[iter], pairYShifts[iter]);
+      }
+    };
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    if(doParallel)
+    {
+      tbb::parallel_for(tbb::blocked_range<int64_t>(0, numPairs + 1, 1), [&](const tbb::blocked_range<int64_t>& r) { computeSpectra(r.begin(), r.end()); });
+      tbb::parallel_for(tbb::blocked_range<int64_t>(chunkStart, chunkEnd, 1), [&](const tbb::blocked_range<int64_t>& r) { correlatePairs(r.begin(), r.end()); });
+    }
+    else
+#endif
+    {
+      computeSpectra(0, numPairs + 1);
+      correlatePairs(chunkStart, chunkEnd);
+    }
+  }
+
+  // Subpixel shifts are accumulated before rounding so the rounding error of each pair does not
+  // build up through the stack
+  float xTotal = 0.0f;
+  float yTotal = 0.0f;
+  for(int64_t iter = 1; iter < dims[2]; iter++)
+  {
+    int64_t slice = (dims[2] - 1) - iter;
+    xTotal += pairXShifts[iter];
+    yTotal += pairYShifts[iter];
+    xshifts[iter] = static_cast<int64_t>(std::round(xTotal));
+    yshifts[iter] = static_cast<int64_t>(std::round(yTotal));
+    if(getWriteAlignmentShifts())
+    {
+      outFile << slice << "	" << slice + 1 << "	" << pairXShifts[iter] << "	" << pairYShifts[iter] << "	" << xshifts[iter] << "	" << yshifts[iter] << "\n";
+    }
+  }
+  if(getWriteAlignmentShifts())
+  {
+    outFile.close();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void AlignSectionsPhaseCorrelation::execute()
+{
+  clearErrorCode();
+  clearWarningCode();
+  dataCheck();
+  if(getErrorCode() < 0)
+  {
+    return;
+  }
+
+  AlignSections::execute();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+AbstractFilter::Pointer AlignSectionsPhaseCorrelation::newFilterInstance(bool copyFilterParameters) const
+{
+  AlignSectionsPhaseCorrelation::Pointer filter = AlignSectionsPhaseCorrelation::New();
+  if(copyFilterParameters)
+  {
+    copyFilterParameterInstanceVariables(filter.get());
+  }
+  return filter;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QString AlignSectionsPhaseCorrelation::getCompiledLibraryName() const
+{
+  return ReconstructionConstants::ReconstructionBaseName;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QString AlignSectionsPhaseCorrelation::getBrandingString() const
+{
+  return "Reconstruction";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QString AlignSectionsPhaseCorrelation::getFilterVersion() const
+{
+  QString version;
+  QTextStream vStream(&version);
+  vStream << Reconstruction::Version::Major() << "." << Reconstruction::Version::Minor() << "." << Reconstruction::Version::Patch();
+  return version;
+}
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QString AlignSectionsPhaseCorrelation::getGroupName() const
+{
+  return SIMPL::FilterGroups::ReconstructionFilters;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QUuid AlignSectionsPhaseCorrelation::getUuid()
+{
+  return QUuid("{a1d52a49-b31a-54bd-831e-c53495f6366f}");
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QString AlignSectionsPhaseCorrelation::getSubGroupName() const
+{
+  return SIMPL::FilterSubGroups::AlignmentFilters;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QString AlignSectionsPhaseCorrelation::getHumanLabel() const
+{
+  return "Align Sections (Phase Correlation)";
+}
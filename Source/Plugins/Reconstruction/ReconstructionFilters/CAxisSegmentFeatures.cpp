@@ -40,6 +40,7 @@
 
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/FloatFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
@@ -57,6 +58,73 @@
 #include "Reconstruction/ReconstructionConstants.h"
 #include "Reconstruction/ReconstructionVersion.h"
 
+namespace
+{
+/**
+ * @brief The CAxisGrouping class groups neighboring Cells of the same phase whose c-axes are within the tolerance
+ */
+class CAxisGrouping
+{
+public:
+  CAxisGrouping(float* quats, int32_t* cellPhases, bool* goodVoxels, float misoTolerance)
+  : m_Quats(reinterpret_cast<QuatF*>(quats))
+  , m_CellPhases(cellPhases)
+  , m_GoodVoxels(goodVoxels)
+  , m_MisoTolerance(misoTolerance)
+  {
+  }
+
+  bool isSeed(int64_t point) const
+  {
+    return (nullptr == m_GoodVoxels || m_GoodVoxels[point]) && m_CellPhases[point] > 0;
+  }
+
+  bool operator()(int64_t referencepoint, int64_t neighborpoint) const
+  {
+    if(m_CellPhases[referencepoint] != m_CellPhases[neighborpoint])
+    {
+      return false;
+    }
+    float c1[3] = {0.0f, 0.0f, 0.0f};
+    float c2[3] = {0.0f, 0.0f, 0.0f};
+    cAxis(m_Quats[referencepoint], c1);
+    cAxis(m_Quats[neighborpoint], c2);
+
+    float w = ((c1[0] * c2[0]) + (c1[1] * c2[1]) + (c1[2] * c2[2]));
+    w = acosf(w);
+    return w <= m_MisoTolerance || (SIMPLib::Constants::k_Pi - w) <= m_MisoTolerance;
+  }
+
+private:
+  /**
+   * @brief cAxis Finds the normalized sample direction that the c-axis of the orientation is along
+   */
+  static void cAxis(const QuatF& q, float c[3])
+  {
+    float g[3][3] = {{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}};
+    float gt[3][3] = {{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}};
+    float caxis[3] = {0.0f, 0.0f, 1.0f};
+    FOrientArrayType om(9);
+    FOrientTransformsType::qu2om(FOrientArrayType(q), om);
+    om.toGMatrix(g);
+
+    // transpose the g matrix so when caxis is multiplied by it
+    // it will give the sample direction that the caxis is along
+    MatrixMath::Transpose3x3(g, gt);
+    MatrixMath::Multiply3x3with3x1(gt, caxis, c);
+
+    // normalize so that the dot product can be taken without
+    // dividing by the magnitudes (they would be 1)
+    MatrixMath::Normalize3x1(c);
+  }
+
+  QuatF* m_Quats = nullptr;
+  int32_t* m_CellPhases = nullptr;
+  bool* m_GoodVoxels = nullptr;
+  float m_MisoTolerance = 0.0f;
+};
+} // namespace
+
 /* Create Enumerations to allow the created Attribute Arrays to take part in renaming */
 enum createdPathID : RenameDataPath::DataID_t
 {
@@ -103,6 +171,7 @@ void CAxisSegmentFeatures::setupFilterParameters()
   parameters.push_back(SIMPL_NEW_FLOAT_FP("C-Axis Misorientation Tolerance (Degrees)", MisorientationTolerance, FilterParameter::Parameter, CAxisSegmentFeatures));
   QStringList linkedProps("GoodVoxelsArrayPath");
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Use Mask Array", UseGoodVoxels, FilterParameter::Parameter, CAxisSegmentFeatures, linkedProps));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Deterministic Feature Ids", DeterministicFeatureIds, FilterParameter::Parameter, CAxisSegmentFeatures));
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req = DataArraySelectionFilterParameter::CreateRequirement(SIMPL::TypeNames::Float, 4, AttributeMatrix::Type::Cell, IGeometry::Type::Image);
@@ -145,6 +214,7 @@ void CAxisSegmentFeatures::readFilterParameters(AbstractFilterParametersReader*
   setCellPhasesArrayPath(reader->readDataArrayPath("CellPhasesArrayPath", getCellPhasesArrayPath()));
   setGoodVoxelsArrayPath(reader->readDataArrayPath("GoodVoxelsArrayPath", getGoodVoxelsArrayPath()));
   setUseGoodVoxels(reader->readValue("UseGoodVoxels", getUseGoodVoxels()));
+  setDeterministicFeatureIds(reader->readValue("DeterministicFeatureIds", getDeterministicFeatureIds()));
   setMisorientationTolerance(reader->readValue("MisorientationTolerance", getMisorientationTolerance()));
   reader->closeFilterGroup();
 }
@@ -319,102 +389,6 @@ void CAxisSegmentFeatures::randomizeFeatureIds(int64_t totalPoints, int64_t tota
   }
 }
 
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-int64_t CAxisSegmentFeatures::getSeed(int32_t gnum, int64_t nextSeed)
-{
-  clearErrorCode();
-  clearWarningCode();
-  DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getDataContainerName());
-
-  size_t totalPoints = m_FeatureIdsPtr.lock()->getNumberOfTuples();
-  int64_t seed = -1;
-  // start with the next voxel after the last seed
-  size_t randpoint = static_cast<size_t>(nextSeed);
-  while(seed == -1 && randpoint < totalPoints)
-  {
-    if(m_FeatureIds[randpoint] == 0) // If the GrainId of the voxel is ZERO then we can use this as a seed point
-    {
-      if((!m_UseGoodVoxels || m_GoodVoxels[randpoint]) && m_CellPhases[randpoint] > 0)
-      {
-        seed = randpoint;
-      }
-      else
-      {
-        randpoint += 1;
-      }
-    }
-    else
-    {
-      randpoint += 1;
-    }
-  }
-  if(seed >= 0)
-  {
-    m_FeatureIds[seed] = gnum;
-    QVector<size_t> tDims(1, gnum + 1);
-    m->getAttributeMatrix(getCellFeatureAttributeMatrixName())->resizeAttributeArrays(tDims);
-    updateFeatureInstancePointers();
-  }
-  return seed;
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-bool CAxisSegmentFeatures::determineGrouping(int64_t referencepoint, int64_t neighborpoint, int32_t gnum)
-{
-  bool group = false;
-  float w = std::numeric_limits<float>::max();
-  QuatF q1 = QuaternionMathF::New();
-  QuatF q2 = QuaternionMathF::New();
-  QuatF* quats = reinterpret_cast<QuatF*>(m_Quats);
-  float g1[3][3] = {{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}};
-  float g2[3][3] = {{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}};
-  float g1t[3][3] = {{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}};
-  float g2t[3][3] = {{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}};
-  float caxis[3] = {0.0f, 0.0f, 1.0f};
-  float c1[3] = {0.0f, 0.0f, 0.0f};
-  float c2[3] = {0.0f, 0.0f, 0.0f};
-
-  if(m_FeatureIds[neighborpoint] == 0 && (!m_UseGoodVoxels || m_GoodVoxels[neighborpoint]))
-  {
-    QuaternionMathF::Copy(quats[referencepoint], q1);
-    QuaternionMathF::Copy(quats[neighborpoint], q2);
-
-    if(m_CellPhases[referencepoint] == m_CellPhases[neighborpoint])
-    {
-      FOrientArrayType om(9);
-      FOrientTransformsType::qu2om(FOrientArrayType(q1), om);
-      om.toGMatrix(g1);
-      FOrientTransformsType::qu2om(FOrientArrayType(q2), om);
-      om.toGMatrix(g2);
-
-      // transpose the g matricies so when caxis is multiplied by it
-      // it will give the sample direction that the caxis is along
-      MatrixMath::Transpose3x3(g1, g1t);
-      MatrixMath::Transpose3x3(g2, g2t);
-      MatrixMath::Multiply3x3with3x1(g1t, caxis, c1);
-      MatrixMath::Multiply3x3with3x1(g2t, caxis, c2);
-
-      // normalize so that the dot product can be taken below without
-      // dividing by the magnitudes (they would be 1)
-      MatrixMath::Normalize3x1(c1);
-      MatrixMath::Normalize3x1(c2);
-
-      w = ((c1[0] * c2[0]) + (c1[1] * c2[1]) + (c1[2] * c2[2]));
-      w = acosf(w);
-      if(w <= m_MisoTolerance || (SIMPLib::Constants::k_Pi - w) <= m_MisoTolerance)
-      {
-        group = true;
-        m_FeatureIds[neighborpoint] = gnum;
-      }
-    }
-  }
-  return group;
-}
-
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -449,12 +423,16 @@ void CAxisSegmentFeatures::execute()
   // Convert user defined tolerance to radians.
   m_MisoTolerance = m_MisorientationTolerance * SIMPLib::Constants::k_Pi / 180.0f;
 
-  // Generate the random voxel indices that will be used for the seed points to start a new grain growth/agglomeration
-  const int64_t rangeMin = 0;
-  const int64_t rangeMax = totalPoints - 1;
-  initializeVoxelSeedGenerator(rangeMin, rangeMax);
+  CAxisGrouping grouping(m_Quats, m_CellPhases, m_UseGoodVoxels ? m_GoodVoxels : nullptr, m_MisoTolerance);
+  int32_t numTuples = segmentVoxels(m_FeatureIds, grouping);
+  if(getCancel())
+  {
+    return;
+  }
 
-  SegmentFeatures::execute();
+  QVector<size_t> fDims(1, numTuples);
+  m->getAttributeMatrix(getCellFeatureAttributeMatrixName())->resizeAttributeArrays(fDims);
+  updateFeatureInstancePointers();
 
   int64_t totalFeatures = static_cast<int64_t>(m_ActivePtr.lock()->getNumberOfTuples());
   if(totalFeatures < 2)
@@ -463,8 +441,8 @@ void CAxisSegmentFeatures::execute()
     return;
   }
 
-  // By default we randomize grains
-  if(m_RandomizeFeatureIds)
+  // By default we randomize grains unless the user asked for Deterministic Feature Ids
+  if(m_RandomizeFeatureIds && !getDeterministicFeatureIds())
   {
     totalPoints = static_cast<int64_t>(m->getGeometryAs<ImageGeom>()->getNumberOfElements());
     randomizeFeatureIds(totalPoints, totalFeatures);
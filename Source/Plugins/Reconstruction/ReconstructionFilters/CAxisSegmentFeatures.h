@@ -56,6 +56,7 @@ class Reconstruction_EXPORT CAxisSegmentFeatures : public SegmentFeatures
     PYB11_PROPERTY(QString CellFeatureAttributeMatrixName READ getCellFeatureAttributeMatrixName WRITE setCellFeatureAttributeMatrixName)
     PYB11_PROPERTY(float MisorientationTolerance READ getMisorientationTolerance WRITE setMisorientationTolerance)
     PYB11_PROPERTY(bool UseGoodVoxels READ getUseGoodVoxels WRITE setUseGoodVoxels)
+    PYB11_PROPERTY(bool DeterministicFeatureIds READ getDeterministicFeatureIds WRITE setDeterministicFeatureIds)
     PYB11_PROPERTY(DataArrayPath CellPhasesArrayPath READ getCellPhasesArrayPath WRITE setCellPhasesArrayPath)
     PYB11_PROPERTY(DataArrayPath CrystalStructuresArrayPath READ getCrystalStructuresArrayPath WRITE setCrystalStructuresArrayPath)
     PYB11_PROPERTY(DataArrayPath QuatsArrayPath READ getQuatsArrayPath WRITE setQuatsArrayPath)
@@ -175,16 +176,6 @@ protected:
    */
   void initialize();
 
-  /**
-   * @brief getSeed Reimplemented from @see SegmentFeatures class
-   */
-  virtual int64_t getSeed(int32_t gnum, int64_t nextSeed);
-
-  /**
-   * @brief determineGrouping Reimplemented from @see SegmentFeatures class
-   */
-  virtual bool determineGrouping(int64_t referencepoint, int64_t neighborpoint, int32_t gnum);
-
 private:
   QVector<LaueOps::Pointer> m_OrientationOps;
 
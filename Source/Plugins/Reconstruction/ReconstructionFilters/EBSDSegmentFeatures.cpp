@@ -41,6 +41,7 @@
 
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/FloatFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
@@ -52,6 +53,59 @@
 #include "Reconstruction/ReconstructionConstants.h"
 #include "Reconstruction/ReconstructionVersion.h"
 
+namespace
+{
+/**
+ * @brief The EbsdGrouping class groups neighboring Cells of the same phase whose misorientation is below the tolerance
+ */
+class EbsdGrouping
+{
+public:
+  EbsdGrouping(float* quats, int32_t* cellPhases, bool* goodVoxels, uint32_t* crystalStructures, QVector<LaueOps::Pointer>& orientationOps, float misoTolerance)
+  : m_Quats(reinterpret_cast<QuatF*>(quats))
+  , m_CellPhases(cellPhases)
+  , m_GoodVoxels(goodVoxels)
+  , m_CrystalStructures(crystalStructures)
+  , m_OrientationOps(orientationOps)
+  , m_MisoTolerance(misoTolerance)
+  {
+  }
+
+  bool isSeed(int64_t point) const
+  {
+    return (nullptr == m_GoodVoxels || m_GoodVoxels[point]) && m_CellPhases[point] > 0;
+  }
+
+  bool operator()(int64_t referencepoint, int64_t neighborpoint) const
+  {
+    if(m_CellPhases[referencepoint] != m_CellPhases[neighborpoint])
+    {
+      return false;
+    }
+    uint32_t phase = m_CrystalStructures[m_CellPhases[referencepoint]];
+    // If the phase is 999 then we bail out now.
+    if(phase >= static_cast<uint32_t>(m_OrientationOps.size()))
+    {
+      return false;
+    }
+
+    QuatF q1 = m_Quats[referencepoint];
+    QuatF q2 = m_Quats[neighborpoint];
+    float n1 = 0.0f, n2 = 0.0f, n3 = 0.0f;
+    float w = m_OrientationOps[phase]->getMisoQuat(q1, q2, n1, n2, n3);
+    return w < m_MisoTolerance;
+  }
+
+private:
+  QuatF* m_Quats = nullptr;
+  int32_t* m_CellPhases = nullptr;
+  bool* m_GoodVoxels = nullptr;
+  uint32_t* m_CrystalStructures = nullptr;
+  QVector<LaueOps::Pointer>& m_OrientationOps;
+  float m_MisoTolerance = 0.0f;
+};
+} // namespace
+
 /* Create Enumerations to allow the created Attribute Arrays to take part in renaming */
 enum createdPathID : RenameDataPath::DataID_t
 {
@@ -97,6 +151,7 @@ void EBSDSegmentFeatures::setupFilterParameters()
   parameters.push_back(SIMPL_NEW_FLOAT_FP("Misorientation Tolerance (Degrees)", MisorientationTolerance, FilterParameter::Parameter, EBSDSegmentFeatures));
   QStringList linkedProps("GoodVoxelsArrayPath");
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Use Mask Array", UseGoodVoxels, FilterParameter::Parameter, EBSDSegmentFeatures, linkedProps));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Deterministic Feature Ids", DeterministicFeatureIds, FilterParameter::Parameter, EBSDSegmentFeatures));
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req = DataArraySelectionFilterParameter::CreateRequirement(SIMPL::TypeNames::Float, 4, AttributeMatrix::Type::Cell, IGeometry::Type::Image);
@@ -139,6 +194,7 @@ void EBSDSegmentFeatures::readFilterParameters(AbstractFilterParametersReader* r
   setCellPhasesArrayPath(reader->readDataArrayPath("CellPhasesArrayPath", getCellPhasesArrayPath()));
   setGoodVoxelsArrayPath(reader->readDataArrayPath("GoodVoxelsArrayPath", getGoodVoxelsArrayPath()));
   setUseGoodVoxels(reader->readValue("UseGoodVoxels", getUseGoodVoxels()));
+  setDeterministicFeatureIds(reader->readValue("DeterministicFeatureIds", getDeterministicFeatureIds()));
   setMisorientationTolerance(reader->readValue("MisorientationTolerance", getMisorientationTolerance()));
   reader->closeFilterGroup();
 }
@@ -312,87 +368,6 @@ void EBSDSegmentFeatures::randomizeFeatureIds(int64_t totalPoints, int64_t total
   }
 }
 
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-int64_t EBSDSegmentFeatures::getSeed(int32_t gnum, int64_t nextSeed)
-{
-  clearErrorCode();
-  clearWarningCode();
-  DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getDataContainerName());
-
-  size_t totalPoints = m_FeatureIdsPtr.lock()->getNumberOfTuples();
-  int64_t seed = -1;
-  // start with the next voxel after the last seed
-  size_t randpoint = static_cast<size_t>(nextSeed);
-  while(seed == -1 && randpoint < totalPoints)
-  {
-    if(m_FeatureIds[randpoint] == 0) // If the GrainId of the voxel is ZERO then we can use this as a seed point
-    {
-      if((!m_UseGoodVoxels || m_GoodVoxels[randpoint]) && m_CellPhases[randpoint] > 0)
-      {
-        seed = randpoint;
-      }
-      else
-      {
-        randpoint += 1;
-      }
-    }
-    else
-    {
-      randpoint += 1;
-    }
-  }
-  if(seed >= 0)
-  {
-    m_FeatureIds[seed] = gnum;
-    QVector<size_t> tDims(1, gnum + 1);
-    m->getAttributeMatrix(getCellFeatureAttributeMatrixName())->resizeAttributeArrays(tDims);
-    updateFeatureInstancePointers();
-  }
-  return seed;
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-bool EBSDSegmentFeatures::determineGrouping(int64_t referencepoint, int64_t neighborpoint, int32_t gnum)
-{
-  bool group = false;
-
-  // Get the phases for each voxel
-  int32_t phase1 = m_CrystalStructures[m_CellPhases[referencepoint]];
-  int32_t phase2 = m_CrystalStructures[m_CellPhases[neighborpoint]];
-  // If either of the phases is 999 then we bail out now.
-  if(phase1 >= m_OrientationOps.size() || phase2 >= m_OrientationOps.size())
-  {
-    return group;
-  }
-
-  if(m_FeatureIds[neighborpoint] == 0 && (!m_UseGoodVoxels || m_GoodVoxels[neighborpoint]))
-  {
-    float w = std::numeric_limits<float>::max();
-    QuatF q1 = QuaternionMathF::New();
-    QuatF q2 = QuaternionMathF::New();
-    QuatF* quats = reinterpret_cast<QuatF*>(m_Quats);
-    float n1 = 0.0f, n2 = 0.0f, n3 = 0.0f;
-
-    QuaternionMathF::Copy(quats[referencepoint], q1);
-    QuaternionMathF::Copy(quats[neighborpoint], q2);
-
-    if(m_CellPhases[referencepoint] == m_CellPhases[neighborpoint])
-    {
-      w = m_OrientationOps[phase1]->getMisoQuat(q1, q2, n1, n2, n3);
-    }
-    if(w < m_MisoTolerance)
-    {
-      group = true;
-      m_FeatureIds[neighborpoint] = gnum;
-    }
-  }
-  return group;
-}
-
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -426,12 +401,17 @@ void EBSDSegmentFeatures::execute()
   // Convert user defined tolerance to radians.
   m_MisoTolerance = m_MisorientationTolerance * SIMPLib::Constants::k_Pi / 180.0f;
 
-  // Generate the random voxel indices that will be used for the seed points to start a new grain growth/agglomeration
-  const int64_t rangeMin = 0;
-  const int64_t rangeMax = totalPoints - 1;
-  initializeVoxelSeedGenerator(rangeMin, rangeMax);
+  EbsdGrouping grouping(m_Quats, m_CellPhases, m_UseGoodVoxels ? m_GoodVoxels : nullptr, m_CrystalStructures, m_OrientationOps, m_MisoTolerance);
+  int32_t numTuples = segmentVoxels(m_FeatureIds, grouping);
 
-  SegmentFeatures::execute();
+  if(getCancel())
+  {
+    return;
+  }
+
+  QVector<size_t> fDims(1, numTuples);
+  m->getAttributeMatrix(getCellFeatureAttributeMatrixName())->resizeAttributeArrays(fDims);
+  updateFeatureInstancePointers();
 
   int64_t totalFeatures = static_cast<int64_t>(m_ActivePtr.lock()->getNumberOfTuples());
   if(totalFeatures < 2)
@@ -440,8 +420,8 @@ void EBSDSegmentFeatures::execute()
     return;
   }
 
-  // By default we randomize grains
-  if(getRandomizeFeatureIds())
+  // By default we randomize grains unless the user asked for Deterministic Feature Ids
+  if(getRandomizeFeatureIds() && !getDeterministicFeatureIds())
   {
     totalPoints = static_cast<int64_t>(m->getGeometryAs<ImageGeom>()->getNumberOfElements());
     randomizeFeatureIds(totalPoints, totalFeatures);
@@ -57,6 +57,7 @@ class Reconstruction_EXPORT EBSDSegmentFeatures : public SegmentFeatures
     PYB11_PROPERTY(QString CellFeatureAttributeMatrixName READ getCellFeatureAttributeMatrixName WRITE setCellFeatureAttributeMatrixName)
     PYB11_PROPERTY(float MisorientationTolerance READ getMisorientationTolerance WRITE setMisorientationTolerance)
     PYB11_PROPERTY(bool UseGoodVoxels READ getUseGoodVoxels WRITE setUseGoodVoxels)
+    PYB11_PROPERTY(bool DeterministicFeatureIds READ getDeterministicFeatureIds WRITE setDeterministicFeatureIds)
     PYB11_PROPERTY(DataArrayPath GoodVoxelsArrayPath READ getGoodVoxelsArrayPath WRITE setGoodVoxelsArrayPath)
     PYB11_PROPERTY(DataArrayPath CellPhasesArrayPath READ getCellPhasesArrayPath WRITE setCellPhasesArrayPath)
     PYB11_PROPERTY(DataArrayPath CrystalStructuresArrayPath READ getCrystalStructuresArrayPath WRITE setCrystalStructuresArrayPath)
@@ -177,16 +178,6 @@ protected:
    */
   void initialize();
 
-  /**
-   * @brief getSeed Reimplemented from @see SegmentFeatures class
-   */
-  virtual int64_t getSeed(int32_t gnum, int64_t nextSeed);
-
-  /**
-   * @brief determineGrouping Reimplemented from @see SegmentFeatures class
-   */
-  virtual bool determineGrouping(int64_t referencepoint, int64_t neighborpoint, int32_t gnum);
-
 private:
   DEFINE_DATAARRAY_VARIABLE(float, Quats)
   DEFINE_DATAARRAY_VARIABLE(int32_t, CellPhases)
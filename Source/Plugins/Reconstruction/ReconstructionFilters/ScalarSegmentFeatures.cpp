@@ -41,6 +41,7 @@
 
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/FloatFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
@@ -61,112 +62,81 @@ enum createdPathID : RenameDataPath::DataID_t
   DataArrayID31 = 31,
 };
 
-/* from http://www.newty.de/fpt/functor.html */
+namespace
+{
 /**
- * @brief The CompareFunctor class serves as a functor superclass for specific implementations
- * of performing scalar comparisons
+ * @brief The UngroupedCells class makes every Cell a Feature of its own. It is used for scalar arrays with more than one component.
  */
-class CompareFunctor
+class UngroupedCells
 {
 public:
-  virtual ~CompareFunctor() = default;
+  explicit UngroupedCells(bool* goodVoxels)
+  : m_GoodVoxels(goodVoxels)
+  {
+  }
+
+  bool isSeed(int64_t point) const
+  {
+    return nullptr == m_GoodVoxels || m_GoodVoxels[point];
+  }
 
-  virtual bool operator()(int64_t index, int64_t neighIndex, int32_t gnum) // call using () operator
+  bool operator()(int64_t referencepoint, int64_t neighborpoint) const
   {
     return false;
   }
+
+private:
+  bool* m_GoodVoxels = nullptr;
 };
 
 /**
- * @brief The TSpecificCompareFunctorBool class extends @see CompareFunctor to compare boolean data
+ * @brief The ScalarGrouping class groups neighboring Cells whose scalar values differ by no more than the tolerance
  */
-class TSpecificCompareFunctorBool : public CompareFunctor
+template <typename T> class ScalarGrouping : public UngroupedCells
 {
 public:
-  TSpecificCompareFunctorBool(void* data, int64_t length, bool tolerance, int32_t* featureIds)
-  : m_Length(length)
-  , m_FeatureIds(featureIds)
+  ScalarGrouping(void* data, T tolerance, bool* goodVoxels)
+  : UngroupedCells(goodVoxels)
+  , m_Data(reinterpret_cast<T*>(data))
+  , m_Tolerance(tolerance)
   {
-    m_Data = reinterpret_cast<bool*>(data);
   }
-  virtual ~TSpecificCompareFunctorBool() = default;
 
-  bool operator()(int64_t referencepoint, int64_t neighborpoint, int32_t gnum) override
+  bool operator()(int64_t referencepoint, int64_t neighborpoint) const
   {
-    // Sanity check the indices that are being passed in.
-    if(referencepoint >= m_Length || neighborpoint >= m_Length)
-    {
-      return false;
-    }
-
-    if(m_Data[neighborpoint] == m_Data[referencepoint])
+    if(m_Data[referencepoint] >= m_Data[neighborpoint])
     {
-      m_FeatureIds[neighborpoint] = gnum;
-      return true;
+      return (m_Data[referencepoint] - m_Data[neighborpoint]) <= m_Tolerance;
     }
-    return false;
+    return (m_Data[neighborpoint] - m_Data[referencepoint]) <= m_Tolerance;
   }
 
-protected:
-  TSpecificCompareFunctorBool() = default;
-
 private:
-  bool* m_Data = nullptr;          // The data that is being compared
-  int64_t m_Length = 0;      // Length of the Data Array
-  int32_t* m_FeatureIds = nullptr; // The Feature Ids
+  T* m_Data = nullptr;               // The data that is being compared
+  T m_Tolerance = static_cast<T>(0); // The tolerance of the comparison
 };
 
 /**
- * @brief The TSpecificCompareFunctor class extens @see CompareFunctor to compare templated data
+ * @brief The ScalarGrouping<bool> class groups neighboring Cells with the same boolean value
  */
-template <class T> class TSpecificCompareFunctor : public CompareFunctor
+template <> class ScalarGrouping<bool> : public UngroupedCells
 {
 public:
-  TSpecificCompareFunctor(void* data, int64_t length, T tolerance, int32_t* featureIds)
-  : m_Length(length)
-  , m_Tolerance(tolerance)
-  , m_FeatureIds(featureIds)
+  ScalarGrouping(void* data, bool tolerance, bool* goodVoxels)
+  : UngroupedCells(goodVoxels)
+  , m_Data(reinterpret_cast<bool*>(data))
   {
-    m_Data = reinterpret_cast<T*>(data);
   }
-  virtual ~TSpecificCompareFunctor() = default;
 
-  bool operator()(int64_t referencepoint, int64_t neighborpoint, int32_t gnum) override
+  bool operator()(int64_t referencepoint, int64_t neighborpoint) const
   {
-    // Sanity check the indices that are being passed in.
-    if(referencepoint >= m_Length || neighborpoint >= m_Length)
-    {
-      return false;
-    }
-
-    if(m_Data[referencepoint] >= m_Data[neighborpoint])
-    {
-      if((m_Data[referencepoint] - m_Data[neighborpoint]) <= m_Tolerance)
-      {
-        m_FeatureIds[neighborpoint] = gnum;
-        return true;
-      }
-    }
-    else
-    {
-      if((m_Data[neighborpoint] - m_Data[referencepoint]) <= m_Tolerance)
-      {
-        m_FeatureIds[neighborpoint] = gnum;
-        return true;
-      }
-    }
-    return false;
+    return m_Data[neighborpoint] == m_Data[referencepoint];
   }
 
-protected:
-  TSpecificCompareFunctor() = default;
-
 private:
-  T* m_Data = nullptr;             // The data that is being compared
-  int64_t m_Length = 0;      // Length of the Data Array
-  T m_Tolerance = static_cast<T>(0);         // The tolerance of the comparison
-  int32_t* m_FeatureIds = nullptr; // The Feature Ids
+  bool* m_Data = nullptr; // The data that is being compared
 };
+} // namespace
 
 // -----------------------------------------------------------------------------
 //
@@ -198,6 +168,7 @@ void ScalarSegmentFeatures::setupFilterParameters()
   QStringList linkedProps("GoodVoxelsArrayPath");
   parameters.push_back(SIMPL_NEW_FLOAT_FP("Scalar Tolerance", ScalarTolerance, FilterParameter::Parameter, ScalarSegmentFeatures));
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Use Mask Array", UseGoodVoxels, FilterParameter::Parameter, ScalarSegmentFeatures, linkedProps));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Deterministic Feature Ids", DeterministicFeatureIds, FilterParameter::Parameter, ScalarSegmentFeatures));
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req = DataArraySelectionFilterParameter::CreateRequirement(SIMPL::Defaults::AnyPrimitive, 1, AttributeMatrix::Type::Cell, IGeometry::Type::Any);
@@ -230,6 +201,7 @@ void ScalarSegmentFeatures::readFilterParameters(AbstractFilterParametersReader*
   setFeatureIdsArrayName(reader->readString("FeatureIdsArrayName", getFeatureIdsArrayName()));
   setGoodVoxelsArrayPath(reader->readDataArrayPath("GoodVoxelsArrayPath", getGoodVoxelsArrayPath()));
   setUseGoodVoxels(reader->readValue("UseGoodVoxels", getUseGoodVoxels()));
+  setDeterministicFeatureIds(reader->readValue("DeterministicFeatureIds", getDeterministicFeatureIds()));
   setScalarArrayPath(reader->readDataArrayPath("ScalarArrayPath", getScalarArrayPath()));
   setScalarTolerance(reader->readValue("ScalarTolerance", getScalarTolerance()));
   reader->closeFilterGroup();
@@ -391,62 +363,6 @@ void ScalarSegmentFeatures::randomizeFeatureIds(int64_t totalPoints, int64_t tot
   }
 }
 
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-int64_t ScalarSegmentFeatures::getSeed(int32_t gnum, int64_t nextSeed)
-{
-  clearErrorCode();
-  clearWarningCode();
-  DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getDataContainerName());
-
-  size_t totalPoints = m_FeatureIdsPtr.lock()->getNumberOfTuples();
-  int64_t seed = -1;
-  // start with the next voxel after the last seed
-  size_t randpoint = static_cast<size_t>(nextSeed);
-  while(seed == -1 && randpoint < totalPoints)
-  {
-    if(m_FeatureIds[randpoint] == 0) // If the GrainId of the voxel is ZERO then we can use this as a seed point
-    {
-      if(!m_UseGoodVoxels || m_GoodVoxels[randpoint])
-      {
-        seed = randpoint;
-      }
-      else
-      {
-        randpoint += 1;
-      }
-    }
-    else
-    {
-      randpoint += 1;
-    }
-  }
-  if(seed >= 0)
-  {
-    m_FeatureIds[seed] = gnum;
-    QVector<size_t> tDims(1, gnum + 1);
-    m->getAttributeMatrix(getCellFeatureAttributeMatrixName())->resizeAttributeArrays(tDims);
-    updateFeatureInstancePointers();
-  }
-  return seed;
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-bool ScalarSegmentFeatures::determineGrouping(int64_t referencepoint, int64_t neighborpoint, int32_t gnum)
-{
-  if(m_FeatureIds[neighborpoint] == 0 && (!m_UseGoodVoxels || m_GoodVoxels[neighborpoint]))
-  {
-    CompareFunctor* func = m_Compare.get();
-    return (*func)((size_t)(referencepoint), (size_t)(neighborpoint), gnum);
-    //     | Functor  ||calling the operator() method of the CompareFunctor Class |
-  }
-
-    return false;
-}
-
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -479,64 +395,66 @@ void ScalarSegmentFeatures::execute()
   updateFeatureInstancePointers();
 
   int64_t totalPoints = static_cast<int64_t>(m_FeatureIdsPtr.lock()->getNumberOfTuples());
-  int64_t inDataPoints = static_cast<int64_t>(m_InputDataPtr.lock()->getNumberOfTuples());
 
   QString dType = m_InputDataPtr.lock()->getTypeAsString();
+  bool* goodVoxels = m_UseGoodVoxels ? m_GoodVoxels : nullptr;
+  int32_t numTuples = 1;
   if(m_InputDataPtr.lock()->getNumberOfComponents() != 1)
   {
-    m_Compare = std::shared_ptr<CompareFunctor>(new CompareFunctor()); // The default CompareFunctor which ALWAYS returns false for the comparison
+    numTuples = segmentVoxels(m_FeatureIds, UngroupedCells(goodVoxels)); // Scalar arrays with more than one component are never grouped
   }
   else if(dType.compare("int8_t") == 0)
   {
-    m_Compare = std::shared_ptr<TSpecificCompareFunctor<int8_t>>(new TSpecificCompareFunctor<int8_t>(m_InputData, inDataPoints, static_cast<int8_t>(m_ScalarTolerance), m_FeatureIds));
+    numTuples = segmentVoxels(m_FeatureIds, ScalarGrouping<int8_t>(m_InputData, static_cast<int8_t>(m_ScalarTolerance), goodVoxels));
   }
   else if(dType.compare("uint8_t") == 0)
   {
-    m_Compare = std::shared_ptr<TSpecificCompareFunctor<uint8_t>>(new TSpecificCompareFunctor<uint8_t>(m_InputData, inDataPoints, static_cast<uint8_t>(m_ScalarTolerance), m_FeatureIds));
+    numTuples = segmentVoxels(m_FeatureIds, ScalarGrouping<uint8_t>(m_InputData, static_cast<uint8_t>(m_ScalarTolerance), goodVoxels));
   }
   else if(dType.compare("bool") == 0)
   {
-    m_Compare = std::shared_ptr<TSpecificCompareFunctorBool>(new TSpecificCompareFunctorBool(m_InputData, inDataPoints, static_cast<bool>(m_ScalarTolerance), m_FeatureIds));
+    numTuples = segmentVoxels(m_FeatureIds, ScalarGrouping<bool>(m_InputData, static_cast<bool>(m_ScalarTolerance), goodVoxels));
   }
   else if(dType.compare("int16_t") == 0)
   {
-    m_Compare = std::shared_ptr<TSpecificCompareFunctor<int16_t>>(new TSpecificCompareFunctor<int16_t>(m_InputData, inDataPoints, static_cast<int16_t>(m_ScalarTolerance), m_FeatureIds));
+    numTuples = segmentVoxels(m_FeatureIds, ScalarGrouping<int16_t>(m_InputData, static_cast<int16_t>(m_ScalarTolerance), goodVoxels));
   }
   else if(dType.compare("uint16_t") == 0)
   {
-    m_Compare = std::shared_ptr<TSpecificCompareFunctor<uint16_t>>(new TSpecificCompareFunctor<uint16_t>(m_InputData, inDataPoints, static_cast<uint16_t>(m_ScalarTolerance), m_FeatureIds));
+    numTuples = segmentVoxels(m_FeatureIds, ScalarGrouping<uint16_t>(m_InputData, static_cast<uint16_t>(m_ScalarTolerance), goodVoxels));
   }
   else if(dType.compare("int32_t") == 0)
   {
-    m_Compare = std::shared_ptr<TSpecificCompareFunctor<int32_t>>(new TSpecificCompareFunctor<int32_t>(m_InputData, inDataPoints, static_cast<int32_t>(m_ScalarTolerance), m_FeatureIds));
+    numTuples = segmentVoxels(m_FeatureIds, ScalarGrouping<int32_t>(m_InputData, static_cast<int32_t>(m_ScalarTolerance), goodVoxels));
   }
   else if(dType.compare("uint32_t") == 0)
   {
-    m_Compare = std::shared_ptr<TSpecificCompareFunctor<uint32_t>>(new TSpecificCompareFunctor<uint32_t>(m_InputData, inDataPoints, static_cast<uint32_t>(m_ScalarTolerance), m_FeatureIds));
+    numTuples = segmentVoxels(m_FeatureIds, ScalarGrouping<uint32_t>(m_InputData, static_cast<uint32_t>(m_ScalarTolerance), goodVoxels));
   }
   else if(dType.compare("int64_t") == 0)
   {
-    m_Compare = std::shared_ptr<TSpecificCompareFunctor<int64_t>>(new TSpecificCompareFunctor<int64_t>(m_InputData, inDataPoints, static_cast<int64_t>(m_ScalarTolerance), m_FeatureIds));
+    numTuples = segmentVoxels(m_FeatureIds, ScalarGrouping<int64_t>(m_InputData, static_cast<int64_t>(m_ScalarTolerance), goodVoxels));
   }
   else if(dType.compare("uint64_t") == 0)
   {
-    m_Compare = std::shared_ptr<TSpecificCompareFunctor<uint64_t>>(new TSpecificCompareFunctor<uint64_t>(m_InputData, inDataPoints, static_cast<uint64_t>(m_ScalarTolerance), m_FeatureIds));
+    numTuples = segmentVoxels(m_FeatureIds, ScalarGrouping<uint64_t>(m_InputData, static_cast<uint64_t>(m_ScalarTolerance), goodVoxels));
   }
   else if(dType.compare("float") == 0)
   {
-    m_Compare = std::shared_ptr<TSpecificCompareFunctor<float>>(new TSpecificCompareFunctor<float>(m_InputData, inDataPoints, m_ScalarTolerance, m_FeatureIds));
+    numTuples = segmentVoxels(m_FeatureIds, ScalarGrouping<float>(m_InputData, m_ScalarTolerance, goodVoxels));
   }
   else if(dType.compare("double") == 0)
   {
-    m_Compare = std::shared_ptr<TSpecificCompareFunctor<double>>(new TSpecificCompareFunctor<double>(m_InputData, inDataPoints, static_cast<double>(m_ScalarTolerance), m_FeatureIds));
+    numTuples = segmentVoxels(m_FeatureIds, ScalarGrouping<double>(m_InputData, static_cast<double>(m_ScalarTolerance), goodVoxels));
+  }
+  if(getCancel())
+  {
+    return;
   }
 
-  // Generate the random voxel indices that will be used for the seed points to start a new grain growth/agglomeration
-  const int64_t rangeMin = 0;
-  const int64_t rangeMax = totalPoints - 1;
-  initializeVoxelSeedGenerator(rangeMin, rangeMax);
-
-  SegmentFeatures::execute();
+  QVector<size_t> fDims(1, numTuples);
+  m->getAttributeMatrix(getCellFeatureAttributeMatrixName())->resizeAttributeArrays(fDims);
+  updateFeatureInstancePointers();
 
   int64_t totalFeatures = static_cast<int64_t>(m_ActivePtr.lock()->getNumberOfTuples());
   if(totalFeatures < 2)
@@ -545,8 +463,8 @@ void ScalarSegmentFeatures::execute()
     return;
   }
   
-  // By default we randomize grains
-  if(m_RandomizeFeatureIds)
+  // By default we randomize grains unless the user asked for Deterministic Feature Ids
+  if(m_RandomizeFeatureIds && !getDeterministicFeatureIds())
   {
     totalPoints = static_cast<int64_t>(m->getGeometry()->getNumberOfElements());
     randomizeFeatureIds(totalPoints, totalFeatures);
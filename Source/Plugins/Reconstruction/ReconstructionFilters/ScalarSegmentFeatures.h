@@ -42,8 +42,6 @@
 
 #include "Reconstruction/ReconstructionFilters/SegmentFeatures.h"
 
-class CompareFunctor;
-
 #include "Reconstruction/ReconstructionDLLExport.h"
 
 /**
@@ -57,6 +55,7 @@ class Reconstruction_EXPORT ScalarSegmentFeatures : public SegmentFeatures
     PYB11_PROPERTY(DataArrayPath ScalarArrayPath READ getScalarArrayPath WRITE setScalarArrayPath)
     PYB11_PROPERTY(float ScalarTolerance READ getScalarTolerance WRITE setScalarTolerance)
     PYB11_PROPERTY(bool UseGoodVoxels READ getUseGoodVoxels WRITE setUseGoodVoxels)
+    PYB11_PROPERTY(bool DeterministicFeatureIds READ getDeterministicFeatureIds WRITE setDeterministicFeatureIds)
     PYB11_PROPERTY(DataArrayPath GoodVoxelsArrayPath READ getGoodVoxelsArrayPath WRITE setGoodVoxelsArrayPath)
     PYB11_PROPERTY(QString FeatureIdsArrayName READ getFeatureIdsArrayName WRITE setFeatureIdsArrayName)
     PYB11_PROPERTY(QString ActiveArrayName READ getActiveArrayName WRITE setActiveArrayName)
@@ -167,16 +166,6 @@ protected:
    */
   void initialize();
 
-  /**
-   * @brief getSeed Reimplemented from @see SegmentFeatures class
-   */
-  virtual int64_t getSeed(int32_t gnum, int64_t nextSeed);
-
-  /**
-   * @brief determineGrouping Reimplemented from @see SegmentFeatures class
-   */
-  virtual bool determineGrouping(int64_t referencepoint, int64_t neighborpoint, int32_t gnum);
-
 private:
   DEFINE_DATAARRAY_VARIABLE(bool, GoodVoxels)
   DEFINE_IDATAARRAY_VARIABLE(InputData)
@@ -184,8 +173,6 @@ private:
   DEFINE_DATAARRAY_VARIABLE(int32_t, FeatureIds)
   DEFINE_DATAARRAY_VARIABLE(bool, Active)
 
-  std::shared_ptr<CompareFunctor> m_Compare;
-
   std::random_device m_RandomDevice;
   std::mt19937_64 m_Generator;
   std::uniform_int_distribution<int64_t> m_Distribution;
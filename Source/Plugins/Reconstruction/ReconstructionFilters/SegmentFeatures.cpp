@@ -47,6 +47,7 @@
 // -----------------------------------------------------------------------------
 SegmentFeatures::SegmentFeatures()
 : m_DataContainerName(SIMPL::Defaults::ImageDataContainerName)
+, m_DeterministicFeatureIds(false)
 {
 }
 
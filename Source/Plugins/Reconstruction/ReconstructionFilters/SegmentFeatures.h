@@ -35,8 +35,21 @@
 
 #pragma once
 
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_scheduler_init.h>
+#endif
+
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/Geometry/IGeometryGrid.h"
 #include "SIMPLib/SIMPLib.h"
 
 #include "Reconstruction/ReconstructionConstants.h"
@@ -60,6 +73,9 @@ public:
 
   SIMPL_INSTANCE_STRING_PROPERTY(DataContainerName)
 
+  SIMPL_FILTER_PARAMETER(bool, DeterministicFeatureIds)
+  Q_PROPERTY(bool DeterministicFeatureIds READ getDeterministicFeatureIds WRITE setDeterministicFeatureIds)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -172,6 +188,25 @@ protected:
    */
   virtual bool determineGrouping(int64_t referencepoint, int64_t neighborpoint, int32_t gnum);
 
+  /**
+   * @brief segmentVoxels Labels the Features of the grid without going through the virtual getSeed and
+   * determineGrouping methods. The grid is split into slabs of whole planes (or whole rows for a single plane)
+   * that are flood filled at the same time, and the Features that cross a slab boundary are merged afterwards
+   * with a union-find over the slab labels. Features are numbered in the order of their lowest voxel index,
+   * which is the numbering the serial burn algorithm in execute() produces.
+   *
+   * The Grouping type must provide bool isSeed(int64_t point) const, which is true for the voxels that can be
+   * part of a Feature, and bool operator()(int64_t point, int64_t neighbor) const, which is true if two face
+   * neighbors that are both seeds belong to the same Feature. It is always called with point < neighbor.
+   * @param featureIds Feature Ids to fill in. Voxels that are not part of any Feature are set to 0
+   * @param grouping Grouping predicate
+   * @param slabCount Number of slabs to split the grid into. 0 picks one from the number of threads, or a single
+   * slab when the parallel algorithms are not available. The result does not depend on it
+   * @return Number of Features plus one, which is the number of tuples of the Feature Attribute Matrix
+   */
+  template <typename Grouping>
+  int32_t segmentVoxels(int32_t* featureIds, const Grouping& grouping, int64_t slabCount = 0);
+
 public:
   SegmentFeatures(const SegmentFeatures&) = delete; // Copy Constructor Not Implemented
   SegmentFeatures(SegmentFeatures&&) = delete;      // Move Constructor Not Implemented
@@ -179,3 +214,263 @@ public:
   SegmentFeatures& operator=(SegmentFeatures&&) = delete;      // Move Assignment Not Implemented
 };
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename Grouping>
+int32_t SegmentFeatures::segmentVoxels(int32_t* featureIds, const Grouping& grouping, int64_t slabCount)
+{
+  DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getDataContainerName());
+  SizeVec3Type udims = m->getGeometryAs<IGeometryGrid>()->getDimensions();
+  int64_t dims[3] = {static_cast<int64_t>(udims[0]), static_cast<int64_t>(udims[1]), static_cast<int64_t>(udims[2])};
+  int64_t totalPoints = dims[0] * dims[1] * dims[2];
+  if(totalPoints == 0)
+  {
+    return 1;
+  }
+
+  // Slabs are made of whole layers so that a voxel and its in-layer neighbors are always in the same slab
+  int64_t layerSize = dims[2] > 1 ? dims[0] * dims[1] : dims[0];
+  int64_t numLayers = totalPoints / layerSize;
+  int64_t numSlabs = 1;
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  numSlabs = 4 * tbb::task_scheduler_init::default_num_threads();
+#endif
+  if(slabCount > 0)
+  {
+    numSlabs = slabCount;
+  }
+  numSlabs = std::min<int64_t>(numLayers, numSlabs);
+  int64_t layersPerSlab = (numLayers + numSlabs - 1) / numSlabs;
+  numSlabs = (numLayers + layersPerSlab - 1) / layersPerSlab;
+  int64_t slabSize = layersPerSlab * layerSize;
+
+  // Runs body(block) for every block, at the same time if there is more than one block
+  auto forEachBlock = [](int64_t numBlocks, const std::function<void(int64_t)>& body) {
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    if(numBlocks > 1)
+    {
+      tbb::parallel_for(tbb::blocked_range<int64_t>(0, numBlocks, 1), [&body](const tbb::blocked_range<int64_t>& r) {
+        for(int64_t block = r.begin(); block < r.end(); block++)
+        {
+          body(block);
+        }
+      });
+      return;
+    }
+#endif
+    for(int64_t block = 0; block < numBlocks; block++)
+    {
+      body(block);
+    }
+  };
+
+  // Flood fill each slab on its own. The labels of a slab start at 1 and follow the lowest voxel index of each piece.
+  std::vector<int64_t> slabFeatureCounts(numSlabs, 0);
+  auto fillSlab = [&](int64_t slab) {
+    if(getCancel())
+    {
+      return;
+    }
+    int64_t begin = slab * slabSize;
+    int64_t end = std::min(begin + slabSize, totalPoints);
+    std::fill(featureIds + begin, featureIds + end, 0);
+    std::vector<int64_t> voxelsList;
+    int32_t label = 0;
+    for(int64_t seed = begin; seed < end; seed++)
+    {
+      if(featureIds[seed] != 0 || !grouping.isSeed(seed))
+      {
+        continue;
+      }
+      label++;
+      featureIds[seed] = label;
+      voxelsList.push_back(seed);
+      while(!voxelsList.empty())
+      {
+        int64_t currentpoint = voxelsList.back();
+        voxelsList.pop_back();
+        int64_t col = currentpoint % dims[0];
+        int64_t row = (currentpoint / dims[0]) % dims[1];
+        int64_t plane = currentpoint / (dims[0] * dims[1]);
+        int64_t neighbors[6] = {-1, -1, -1, -1, -1, -1};
+        if(plane > 0)
+        {
+          neighbors[0] = currentpoint - dims[0] * dims[1];
+        }
+        if(row > 0)
+        {
+          neighbors[1] = currentpoint - dims[0];
+        }
+        if(col > 0)
+        {
+          neighbors[2] = currentpoint - 1;
+        }
+        if(col < dims[0] - 1)
+        {
+          neighbors[3] = currentpoint + 1;
+        }
+        if(row < dims[1] - 1)
+        {
+          neighbors[4] = currentpoint + dims[0];
+        }
+        if(plane < dims[2] - 1)
+        {
+          neighbors[5] = currentpoint + dims[0] * dims[1];
+        }
+        for(int64_t neighbor : neighbors)
+        {
+          if(neighbor < begin || neighbor >= end || featureIds[neighbor] != 0 || !grouping.isSeed(neighbor))
+          {
+            continue;
+          }
+          if(grouping(std::min(currentpoint, neighbor), std::max(currentpoint, neighbor)))
+          {
+            featureIds[neighbor] = label;
+            voxelsList.push_back(neighbor);
+          }
+        }
+      }
+    }
+    slabFeatureCounts[slab] = label;
+  };
+
+  forEachBlock(numSlabs, fillSlab);
+
+  if(getCancel())
+  {
+    return 1;
+  }
+
+  // The slab labels are made unique by offsetting them with the number of labels in all the slabs before
+  std::vector<int64_t> slabOffsets(numSlabs, 0);
+  int64_t totalLabels = 0;
+  for(int64_t slab = 0; slab < numSlabs; slab++)
+  {
+    slabOffsets[slab] = totalLabels;
+    totalLabels += slabFeatureCounts[slab];
+  }
+
+  // Find the pairs of labels that touch across each slab boundary
+  std::vector<std::vector<std::pair<int64_t, int64_t>>> boundaryPairs(numSlabs - 1);
+  auto mergeBoundary = [&](int64_t slab) {
+    int64_t boundary = (slab + 1) * slabSize;
+    std::vector<std::pair<int64_t, int64_t>>& pairs = boundaryPairs[slab];
+    for(int64_t point = boundary - layerSize; point < boundary; point++)
+    {
+      int64_t neighbor = point + layerSize;
+      if(featureIds[point] == 0 || featureIds[neighbor] == 0 || !grouping(point, neighbor))
+      {
+        continue;
+      }
+      std::pair<int64_t, int64_t> labels(slabOffsets[slab] + featureIds[point], slabOffsets[slab + 1] + featureIds[neighbor]);
+      if(pairs.empty() || pairs.back() != labels)
+      {
+        pairs.push_back(labels);
+      }
+    }
+  };
+  forEachBlock(numSlabs - 1, mergeBoundary);
+
+  // Union-find over the labels. Each set is rooted at its lowest label, which is the piece holding the lowest voxel index.
+  std::vector<int64_t> parents(totalLabels + 1);
+  for(int64_t label = 0; label <= totalLabels; label++)
+  {
+    parents[label] = label;
+  }
+  auto findRoot = [&parents](int64_t label) {
+    while(parents[label] != label)
+    {
+      parents[label] = parents[parents[label]];
+      label = parents[label];
+    }
+    return label;
+  };
+  for(const std::vector<std::pair<int64_t, int64_t>>& pairs : boundaryPairs)
+  {
+    for(const std::pair<int64_t, int64_t>& labels : pairs)
+    {
+      int64_t root1 = findRoot(labels.first);
+      int64_t root2 = findRoot(labels.second);
+      if(root1 < root2)
+      {
+        parents[root2] = root1;
+      }
+      else if(root2 < root1)
+      {
+        parents[root1] = root2;
+      }
+    }
+  }
+  std::vector<std::vector<std::pair<int64_t, int64_t>>>().swap(boundaryPairs);
+
+  // Number the roots in increasing order with a prefix sum over blocks of labels. A set is rooted at its lowest
+  // label, so the Features are numbered in the order of their lowest voxel index.
+  int64_t labelsPerBlock = std::max<int64_t>(1, (totalLabels + numSlabs - 1) / numSlabs);
+  int64_t numLabelBlocks = (totalLabels + labelsPerBlock - 1) / labelsPerBlock;
+  std::vector<int64_t> blockOffsets(numLabelBlocks, 0);
+  std::vector<int32_t> newIds(totalLabels + 1, 0);
+  forEachBlock(numLabelBlocks, [&](int64_t block) {
+    int64_t begin = 1 + block * labelsPerBlock;
+    int64_t end = std::min(begin + labelsPerBlock, totalLabels + 1);
+    for(int64_t label = begin; label < end; label++)
+    {
+      blockOffsets[block] += (parents[label] == label) ? 1 : 0;
+    }
+  });
+  int64_t numFeatures = 0;
+  for(int64_t& blockOffset : blockOffsets)
+  {
+    int64_t numRoots = blockOffset;
+    blockOffset = numFeatures;
+    numFeatures += numRoots;
+  }
+  forEachBlock(numLabelBlocks, [&](int64_t block) {
+    int64_t begin = 1 + block * labelsPerBlock;
+    int64_t end = std::min(begin + labelsPerBlock, totalLabels + 1);
+    int32_t featureId = static_cast<int32_t>(blockOffsets[block]);
+    for(int64_t label = begin; label < end; label++)
+    {
+      if(parents[label] == label)
+      {
+        newIds[label] = ++featureId;
+      }
+    }
+  });
+  // Every other label takes the number of its root. The parents are only read from here on so this is safe to run in parallel.
+  forEachBlock(numLabelBlocks, [&](int64_t block) {
+    int64_t begin = 1 + block * labelsPerBlock;
+    int64_t end = std::min(begin + labelsPerBlock, totalLabels + 1);
+    for(int64_t label = begin; label < end; label++)
+    {
+      if(parents[label] == label)
+      {
+        continue;
+      }
+      int64_t root = label;
+      while(parents[root] != root)
+      {
+        root = parents[root];
+      }
+      newIds[label] = newIds[root];
+    }
+  });
+  std::vector<int64_t>().swap(parents);
+
+  auto relabelSlab = [&](int64_t slab) {
+    int64_t begin = slab * slabSize;
+    int64_t end = std::min(begin + slabSize, totalPoints);
+    const int32_t* slabIds = newIds.data() + slabOffsets[slab];
+    for(int64_t point = begin; point < end; point++)
+    {
+      if(featureIds[point] != 0)
+      {
+        featureIds[point] = slabIds[featureIds[point]];
+      }
+    }
+  };
+  forEachBlock(numSlabs, relabelSlab);
+
+  return static_cast<int32_t>(numFeatures + 1);
+}
@@ -39,6 +39,7 @@
 
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
@@ -48,6 +49,46 @@
 #include "SIMPLib/Math/SIMPLibMath.h"
 #include "SIMPLib/Math/SIMPLibRandom.h"
 
+namespace
+{
+/**
+ * @brief The SineParamsGrouping class groups neighboring Cells whose sine curves differ by less than 7 on average
+ */
+class SineParamsGrouping
+{
+public:
+  SineParamsGrouping(float* sineParams, bool* goodVoxels)
+  : m_SineParams(sineParams)
+  , m_GoodVoxels(goodVoxels)
+  {
+  }
+
+  bool isSeed(int64_t point) const
+  {
+    return nullptr == m_GoodVoxels || m_GoodVoxels[point];
+  }
+
+  bool operator()(int64_t referencepoint, int64_t neighborpoint) const
+  {
+    float step = 45.0f * SIMPLib::Constants::k_PiOver180;
+    float avgDiff = 0;
+    for(int i = 0; i < 8; i++)
+    {
+      float shift = float(i) * step;
+      float v1 = m_SineParams[3 * referencepoint] * sin(2.0 * (shift + m_SineParams[3 * referencepoint + 2])) + m_SineParams[3 * referencepoint + 1];
+      float v2 = m_SineParams[3 * neighborpoint] * sin(2.0 * (shift + m_SineParams[3 * neighborpoint + 2])) + m_SineParams[3 * neighborpoint + 1];
+      avgDiff += fabs(v1 - v2);
+    }
+    avgDiff /= 8.0;
+    return avgDiff < 7;
+  }
+
+private:
+  float* m_SineParams = nullptr;
+  bool* m_GoodVoxels = nullptr;
+};
+} // namespace
+
 /* Create Enumerations to allow the created Attribute Arrays to take part in renaming */
 enum createdPathID : RenameDataPath::DataID_t
 {
@@ -90,6 +131,7 @@ void SineParamsSegmentFeatures::setupFilterParameters()
 
   QStringList linkedProps("GoodVoxelsArrayPath");
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Use Good Voxels Array", UseGoodVoxels, FilterParameter::Parameter, SineParamsSegmentFeatures, linkedProps));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Deterministic Feature Ids", DeterministicFeatureIds, FilterParameter::Parameter, SineParamsSegmentFeatures));
 
   {
     DataArraySelectionFilterParameter::RequirementType req;
@@ -118,6 +160,7 @@ void SineParamsSegmentFeatures::readFilterParameters(AbstractFilterParametersRea
   setFeatureIdsArrayName(reader->readString("FeatureIdsArrayName", getFeatureIdsArrayName()));
   setGoodVoxelsArrayPath(reader->readDataArrayPath("GoodVoxelsArrayPath", getGoodVoxelsArrayPath()));
   setUseGoodVoxels(reader->readValue("UseGoodVoxels", getUseGoodVoxels()));
+  setDeterministicFeatureIds(reader->readValue("DeterministicFeatureIds", getDeterministicFeatureIds()));
   setSineParamsArrayPath(reader->readDataArrayPath("SineParamsArrayPath", getSineParamsArrayPath()));
   // setAngleTolerance( reader->readValue("AngleTolerance", getAngleTolerance()) );
   reader->closeFilterGroup();
@@ -252,19 +295,14 @@ void SineParamsSegmentFeatures::execute()
   // Tell the user we are starting the filter
   notifyStatusMessage("Starting");
 
-  // Convert user defined tolerance to radians.
-  // angleTolerance = m_AngleTolerance * SIMPLib::Constants::k_Pi / 180.0f;
-  for(int64_t i = 0; i < totalPoints; i++)
+  SineParamsGrouping grouping(m_SineParams, m_UseGoodVoxels ? m_GoodVoxels : nullptr);
+  tDims[0] = segmentVoxels(m_FeatureIds, grouping);
+  if(getCancel())
   {
-    m_FeatureIds[i] = 0;
+    return;
   }
-
-  // Generate the random voxel indices that will be used for the seed points to start a new grain growth/agglomeration
-  const size_t rangeMin = 0;
-  const size_t rangeMax = totalPoints - 1;
-  initializeVoxelSeedGenerator(rangeMin, rangeMax);
-
-  SegmentFeatures::execute();
+  m->getAttributeMatrix(getCellFeatureAttributeMatrixName())->resizeAttributeArrays(tDims);
+  updateFeatureInstancePointers();
 
   size_t totalFeatures = m->getAttributeMatrix(getCellFeatureAttributeMatrixName())->getNumberOfTuples();
   if(totalFeatures < 2)
@@ -273,8 +311,8 @@ void SineParamsSegmentFeatures::execute()
     return;
   }
 
-  // By default we randomize grains
-  if(m_RandomizeFeatureIds)
+  // By default we randomize grains unless the user asked for Deterministic Feature Ids
+  if(m_RandomizeFeatureIds && !getDeterministicFeatureIds())
   {
     randomizeFeatureIds(totalPoints, totalFeatures);
   }
@@ -325,78 +363,6 @@ void SineParamsSegmentFeatures::randomizeFeatureIds(int64_t totalPoints, size_t
   }
 }
 
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-int64_t SineParamsSegmentFeatures::getSeed(int32_t gnum, int64_t nextSeed)
-{
-  clearErrorCode();
-  clearWarningCode();
-  DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getDataContainerName());
-
-  size_t totalPoints = m_FeatureIdsPtr.lock()->getNumberOfTuples();
-  int64_t seed = -1;
-  // start with the next voxel after the last seed
-  size_t randpoint = static_cast<size_t>(nextSeed);
-  while(seed == -1 && randpoint < totalPoints)
-  {
-    if(m_FeatureIds[randpoint] == 0) // If the GrainId of the voxel is ZERO then we can use this as a seed point
-    {
-      if(!m_UseGoodVoxels || m_GoodVoxels[randpoint])
-      {
-        seed = randpoint;
-      }
-      else
-      {
-        randpoint += 1;
-      }
-    }
-    else
-    {
-      randpoint += 1;
-    }
-  }
-  if(seed >= 0)
-  {
-    m_FeatureIds[seed] = gnum;
-    QVector<size_t> tDims(1, gnum + 1);
-    m->getAttributeMatrix(getCellFeatureAttributeMatrixName())->resizeAttributeArrays(tDims);
-    updateFeatureInstancePointers();
-  }
-  return seed;
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-bool SineParamsSegmentFeatures::determineGrouping(int64_t referencepoint, int64_t neighborpoint, int32_t gnum)
-{
-  bool group = false;
-  float v1;
-  float v2;
-  float shift;
-  float step = 45.0f * SIMPLib::Constants::k_PiOver180;
-  float avgDiff = 0;
-  if(m_FeatureIds[neighborpoint] == 0 && (!m_UseGoodVoxels || m_GoodVoxels[neighborpoint]))
-  {
-    for(int i = 0; i < 8; i++)
-    {
-      shift = float(i) * step;
-      v1 = m_SineParams[3 * referencepoint] * sin(2.0 * (shift + m_SineParams[3 * referencepoint + 2])) + m_SineParams[3 * referencepoint + 1];
-      v2 = m_SineParams[3 * neighborpoint] * sin(2.0 * (shift + m_SineParams[3 * neighborpoint + 2])) + m_SineParams[3 * neighborpoint + 1];
-      avgDiff += fabs(v1 - v2);
-    }
-    avgDiff /= 8.0;
-    if(avgDiff < 7)
-    {
-      group = true;
-      m_FeatureIds[neighborpoint] = gnum;
-    }
-  }
-
-  return group;
-}
-
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -20,6 +20,7 @@ set(_PublicFilters
   AlignSectionsList
   AlignSectionsMisorientation
   AlignSectionsMutualInformation
+  AlignSectionsPhaseCorrelation
   CAxisSegmentFeatures
   EBSDSegmentFeatures
   MergeColonies
@@ -63,5 +64,8 @@ foreach(f ${_PrivateFilters} )
                         ${${PLUGIN_NAME}_SOURCE_DIR}/Documentation/${_filterGroupName}/${f}.md FALSE ${${PLUGIN_NAME}_BINARY_DIR})
 endforeach()
 
+ADD_SIMPL_SUPPORT_CLASS(${${PLUGIN_NAME}_SOURCE_DIR} ${_filterGroupName}/util FastFourierTransform)
+
+
 SIMPL_END_FILTER_GROUP(${Reconstruction_BINARY_DIR} "${_filterGroupName}" "Reconstruction Filters")
 
@@ -41,6 +41,7 @@
 
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/FloatFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
@@ -53,6 +54,54 @@
 #include "Reconstruction/ReconstructionConstants.h"
 #include "Reconstruction/ReconstructionVersion.h"
 
+namespace
+{
+/**
+ * @brief The VectorGrouping class groups neighboring Cells whose axial vectors are within the angle tolerance
+ */
+class VectorGrouping
+{
+public:
+  VectorGrouping(float* vectors, bool* goodVoxels, float angleToleranceRad)
+  : m_Vectors(vectors)
+  , m_GoodVoxels(goodVoxels)
+  , m_AngleToleranceRad(angleToleranceRad)
+  {
+  }
+
+  bool isSeed(int64_t point) const
+  {
+    return nullptr == m_GoodVoxels || m_GoodVoxels[point];
+  }
+
+  bool operator()(int64_t referencepoint, int64_t neighborpoint) const
+  {
+    float v1[3] = {m_Vectors[3 * referencepoint + 0], m_Vectors[3 * referencepoint + 1], m_Vectors[3 * referencepoint + 2]};
+    float v2[3] = {m_Vectors[3 * neighborpoint + 0], m_Vectors[3 * neighborpoint + 1], m_Vectors[3 * neighborpoint + 2]};
+    if(v1[2] < 0)
+    {
+      MatrixMath::Multiply3x1withConstant(v1, -1);
+    }
+    if(v2[2] < 0)
+    {
+      MatrixMath::Multiply3x1withConstant(v2, -1);
+    }
+    float w = GeometryMath::CosThetaBetweenVectors(v1, v2);
+    w = acosf(w);
+    if(w > SIMPLib::Constants::k_PiOver2)
+    {
+      w = SIMPLib::Constants::k_Pi - w;
+    }
+    return w < m_AngleToleranceRad;
+  }
+
+private:
+  float* m_Vectors = nullptr;
+  bool* m_GoodVoxels = nullptr;
+  float m_AngleToleranceRad = 0.0f;
+};
+} // namespace
+
 /* Create Enumerations to allow the created Attribute Arrays to take part in renaming */
 enum createdPathID : RenameDataPath::DataID_t
 {
@@ -94,6 +143,7 @@ void VectorSegmentFeatures::setupFilterParameters()
   parameters.push_back(SIMPL_NEW_FLOAT_FP("Angle Tolerance", AngleTolerance, FilterParameter::Parameter, VectorSegmentFeatures));
   QStringList linkedProps("GoodVoxelsArrayPath");
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Use Mask Array", UseGoodVoxels, FilterParameter::Parameter, VectorSegmentFeatures, linkedProps));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Deterministic Feature Ids", DeterministicFeatureIds, FilterParameter::Parameter, VectorSegmentFeatures));
 
   {
     DataArraySelectionFilterParameter::RequirementType req;
@@ -122,6 +172,7 @@ void VectorSegmentFeatures::readFilterParameters(AbstractFilterParametersReader*
   setFeatureIdsArrayName(reader->readString("FeatureIdsArrayName", getFeatureIdsArrayName()));
   setGoodVoxelsArrayPath(reader->readDataArrayPath("GoodVoxelsArrayPath", getGoodVoxelsArrayPath()));
   setUseGoodVoxels(reader->readValue("UseGoodVoxels", getUseGoodVoxels()));
+  setDeterministicFeatureIds(reader->readValue("DeterministicFeatureIds", getDeterministicFeatureIds()));
   setSelectedVectorArrayPath(reader->readDataArrayPath("SelectedVectorArrayPath", getSelectedVectorArrayPath()));
   setAngleTolerance(reader->readValue("AngleTolerance", getAngleTolerance()));
   reader->closeFilterGroup();
@@ -281,86 +332,6 @@ void VectorSegmentFeatures::randomizeFeatureIds(int64_t totalPoints, int64_t tot
   }
 }
 
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-int64_t VectorSegmentFeatures::getSeed(int32_t gnum, int64_t nextSeed)
-{
-  clearErrorCode();
-  clearWarningCode();
-  DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getDataContainerName());
-
-  size_t totalPoints = m_FeatureIdsPtr.lock()->getNumberOfTuples();
-  int64_t seed = -1;
-  // start with the next voxel after the last seed
-  size_t randpoint = static_cast<size_t>(nextSeed);
-  while(seed == -1 && randpoint < totalPoints)
-  {
-    if(m_FeatureIds[randpoint] == 0) // If the GrainId of the voxel is ZERO then we can use this as a seed point
-    {
-      if(!m_UseGoodVoxels || m_GoodVoxels[randpoint])
-      {
-        seed = randpoint;
-      }
-      else
-      {
-        randpoint += 1;
-      }
-    }
-    else
-    {
-      randpoint += 1;
-    }
-  }
-  if(seed >= 0)
-  {
-    m_FeatureIds[seed] = gnum;
-    QVector<size_t> tDims(1, gnum + 1);
-    m->getAttributeMatrix(getCellFeatureAttributeMatrixName())->resizeAttributeArrays(tDims);
-    updateFeatureInstancePointers();
-  }
-  return seed;
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-bool VectorSegmentFeatures::determineGrouping(int64_t referencepoint, int64_t neighborpoint, int32_t gnum)
-{
-  bool group = false;
-  float v1[3] = {0.0f, 0.0f, 0.0f};
-  float v2[3] = {0.0f, 0.0f, 0.0f};
-  if(m_FeatureIds[neighborpoint] == 0 && (!m_UseGoodVoxels || m_GoodVoxels[neighborpoint]))
-  {
-    v1[0] = m_Vectors[3 * referencepoint + 0];
-    v1[1] = m_Vectors[3 * referencepoint + 1];
-    v1[2] = m_Vectors[3 * referencepoint + 2];
-    v2[0] = m_Vectors[3 * neighborpoint + 0];
-    v2[1] = m_Vectors[3 * neighborpoint + 1];
-    v2[2] = m_Vectors[3 * neighborpoint + 2];
-    if(v1[2] < 0)
-    {
-      MatrixMath::Multiply3x1withConstant(v1, -1);
-    }
-    if(v2[2] < 0)
-    {
-      MatrixMath::Multiply3x1withConstant(v2, -1);
-    }
-    float w = GeometryMath::CosThetaBetweenVectors(v1, v2);
-    w = acosf(w);
-    if(w > SIMPLib::Constants::k_PiOver2)
-    {
-      w = SIMPLib::Constants::k_Pi - w;
-    }
-    if(w < m_AngleToleranceRad)
-    {
-      group = true;
-      m_FeatureIds[neighborpoint] = gnum;
-    }
-  }
-  return group;
-}
-
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -397,12 +368,16 @@ void VectorSegmentFeatures::execute()
   // Convert user defined tolerance to radians.
   m_AngleToleranceRad = m_AngleTolerance * SIMPLib::Constants::k_Pi / 180.0f;
 
-  // Generate the random voxel indices that will be used for the seed points to start a new grain growth/agglomeration
-  const int64_t rangeMin = 0;
-  const int64_t rangeMax = totalPoints - 1;
-  initializeVoxelSeedGenerator(rangeMin, rangeMax);
+  VectorGrouping grouping(m_Vectors, m_UseGoodVoxels ? m_GoodVoxels : nullptr, m_AngleToleranceRad);
+  int32_t numTuples = segmentVoxels(m_FeatureIds, grouping);
+  if(getCancel())
+  {
+    return;
+  }
 
-  SegmentFeatures::execute();
+  QVector<size_t> fDims(1, numTuples);
+  m->getAttributeMatrix(getCellFeatureAttributeMatrixName())->resizeAttributeArrays(fDims);
+  updateFeatureInstancePointers();
 
   int32_t totalFeatures = static_cast<int32_t>(m->getAttributeMatrix(getCellFeatureAttributeMatrixName())->getNumberOfTuples());
   if(totalFeatures < 2)
@@ -411,8 +386,8 @@ void VectorSegmentFeatures::execute()
     return;
   }
 
-  // By default we randomize grains
-  if(m_RandomizeFeatureIds)
+  // By default we randomize grains unless the user asked for Deterministic Feature Ids
+  if(m_RandomizeFeatureIds && !getDeterministicFeatureIds())
   {
     randomizeFeatureIds(totalPoints, totalFeatures);
   }
@@ -55,6 +55,7 @@ class Reconstruction_EXPORT VectorSegmentFeatures : public SegmentFeatures
     PYB11_PROPERTY(DataArrayPath SelectedVectorArrayPath READ getSelectedVectorArrayPath WRITE setSelectedVectorArrayPath)
     PYB11_PROPERTY(float AngleTolerance READ getAngleTolerance WRITE setAngleTolerance)
     PYB11_PROPERTY(bool UseGoodVoxels READ getUseGoodVoxels WRITE setUseGoodVoxels)
+    PYB11_PROPERTY(bool DeterministicFeatureIds READ getDeterministicFeatureIds WRITE setDeterministicFeatureIds)
     PYB11_PROPERTY(DataArrayPath GoodVoxelsArrayPath READ getGoodVoxelsArrayPath WRITE setGoodVoxelsArrayPath)
     PYB11_PROPERTY(QString FeatureIdsArrayName READ getFeatureIdsArrayName WRITE setFeatureIdsArrayName)
     PYB11_PROPERTY(QString ActiveArrayName READ getActiveArrayName WRITE setActiveArrayName)
@@ -165,16 +166,6 @@ protected:
    */
   void initialize();
 
-  /**
-   * @brief getSeed Reimplemented from @see SegmentFeatures class
-   */
-  virtual int64_t getSeed(int32_t gnum, int64_t nextSeed);
-
-  /**
-   * @brief determineGrouping Reimplemented from @see SegmentFeatures class
-   */
-  virtual bool determineGrouping(int64_t referencepoint, int64_t neighborpoint, int32_t gnum);
-
 private:
   DEFINE_DATAARRAY_VARIABLE(float, Vectors)
   DEFINE_DATAARRAY_VARIABLE(int32_t, FeatureIds)
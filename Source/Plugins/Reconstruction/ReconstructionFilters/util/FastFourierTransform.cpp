@@ -0,0 +1,171 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "FastFourierTransform.h"
+
+#include <cmath>
+#include <utility>
+
+#include "SIMPLib/Common/Constants.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FastFourierTransform::FastFourierTransform(size_t n)
+: m_Size(n)
+, m_BitReversed(n, 0)
+, m_Twiddles(n / 2)
+{
+  size_t numBits = 0;
+  while((static_cast<size_t>(1) << numBits) < n)
+  {
+    numBits++;
+  }
+  for(size_t i = 0; i < n; i++)
+  {
+    size_t reversed = 0;
+    for(size_t b = 0; b < numBits; b++)
+    {
+      reversed |= ((i >> b) & 1) << (numBits - 1 - b);
+    }
+    m_BitReversed[i] = reversed;
+  }
+  // The twiddles are computed in double precision so the rounding error does not grow with n
+  for(size_t k = 0; k < n / 2; k++)
+  {
+    double angle = -2.0 * SIMPLib::Constants::k_Pi * static_cast<double>(k) / static_cast<double>(n);
+    m_Twiddles[k] = ComplexType(static_cast<float>(std::cos(angle)), static_cast<float>(std::sin(angle)));
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FastFourierTransform::~FastFourierTransform() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t FastFourierTransform::NextPowerOfTwo(size_t n)
+{
+  size_t p = 1;
+  while(p < n)
+  {
+    p <<= 1;
+  }
+  return p;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t FastFourierTransform::getSize() const
+{
+  return m_Size;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FastFourierTransform::transform(ComplexType* data, bool inverse, size_t stride) const
+{
+  const size_t n = m_Size;
+  for(size_t i = 0; i < n; i++)
+  {
+    size_t j = m_BitReversed[i];
+    if(i < j)
+    {
+      std::swap(data[i * stride], data[j * stride]);
+    }
+  }
+
+  for(size_t half = 1; half < n; half <<= 1)
+  {
+    const size_t twiddleStep = n / (half * 2);
+    for(size_t start = 0; start < n; start += half * 2)
+    {
+      for(size_t k = 0; k < half; k++)
+      {
+        ComplexType w = m_Twiddles[k * twiddleStep];
+        if(inverse)
+        {
+          w = std::conj(w);
+        }
+        ComplexType& a = data[(start + k) * stride];
+        ComplexType& b = data[(start + k + half) * stride];
+        ComplexType t = w * b;
+        b = a - t;
+        a = a + t;
+      }
+    }
+  }
+
+  if(inverse)
+  {
+    const float scale = 1.0f / static_cast<float>(n);
+    for(size_t i = 0; i < n; i++)
+    {
+      data[i * stride] *= scale;
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FastFourierTransform::Transform2D(ComplexType* data, size_t width, size_t height, bool inverse)
+{
+  FastFourierTransform rowTransform(width);
+  for(size_t y = 0; y < height; y++)
+  {
+    rowTransform.transform(data + y * width, inverse);
+  }
+
+  // Columns are copied into a contiguous buffer so the butterflies do not stride through the whole image
+  FastFourierTransform columnTransform(height);
+  std::vector<ComplexType> column(height);
+  for(size_t x = 0; x < width; x++)
+  {
+    for(size_t y = 0; y < height; y++)
+    {
+      column[y] = data[y * width + x];
+    }
+    columnTransform.transform(column.data(), inverse);
+    for(size_t y = 0; y < height; y++)
+    {
+      data[y * width + x] = column[y];
+    }
+  }
+}
@@ -0,0 +1,97 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <complex>
+#include <cstddef>
+#include <vector>
+
+#include "Reconstruction/ReconstructionDLLExport.h"
+
+/**
+ * @brief The FastFourierTransform class is a small, self contained radix-2 Cooley-Tukey FFT used by
+ * the alignment filters. Only power of two lengths are supported; callers are expected to zero pad
+ * their data to NextPowerOfTwo() of the extent they need.
+ */
+class Reconstruction_EXPORT FastFourierTransform
+{
+public:
+  using ComplexType = std::complex<float>;
+
+  /**
+   * @brief FastFourierTransform Precomputes the bit reversal table and twiddle factors for transforms of length n
+   * @param n Transform length. Must be a power of two
+   */
+  explicit FastFourierTransform(size_t n);
+  virtual ~FastFourierTransform();
+
+  /**
+   * @brief NextPowerOfTwo Returns the smallest power of two that is >= n
+   * @param n
+   * @return
+   */
+  static size_t NextPowerOfTwo(size_t n);
+
+  /**
+   * @brief getSize Returns the transform length
+   * @return
+   */
+  size_t getSize() const;
+
+  /**
+   * @brief transform Computes the in place DFT of n values spaced stride elements apart. The inverse
+   * transform is scaled by 1/n so that a forward transform followed by an inverse one is the identity.
+   * @param data
+   * @param inverse
+   * @param stride
+   */
+  void transform(ComplexType* data, bool inverse, size_t stride = 1) const;
+
+  /**
+   * @brief Transform2D Computes the in place 2D DFT of a row major array of width x height values.
+   * Both extents must be powers of two.
+   * @param data
+   * @param width
+   * @param height
+   * @param inverse
+   */
+  static void Transform2D(ComplexType* data, size_t width, size_t height, bool inverse);
+
+private:
+  size_t m_Size = 0;
+  std::vector<size_t> m_BitReversed;
+  std::vector<ComplexType> m_Twiddles;
+};
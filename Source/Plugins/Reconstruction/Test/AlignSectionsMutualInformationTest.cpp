@@ -0,0 +1,344 @@
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <QtCore/QCoreApplication>
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/SIMPLib.h"
+#include "UnitTestSupport.hpp"
+
+#include "EbsdLib/EbsdConstants.h"
+
+#include "Reconstruction/ReconstructionFilters/AlignSectionsMutualInformation.h"
+
+/**
+ * @brief The AlignSectionsMutualInformationTestFilter class gives the test access to the shifts found by
+ * AlignSectionsMutualInformation before they are applied to the Cell data. It also carries the serial search
+ * of earlier versions so that both can be run on the same section Features.
+ */
+class AlignSectionsMutualInformationTestFilter : public AlignSectionsMutualInformation
+{
+public:
+  AlignSectionsMutualInformationTestFilter() = default;
+  ~AlignSectionsMutualInformationTestFilter() override = default;
+
+  void findShifts(std::vector<int64_t>& xshifts, std::vector<int64_t>& yshifts)
+  {
+    dataCheck();
+    if(getErrorCode() < 0)
+    {
+      return;
+    }
+    find_shifts(xshifts, yshifts);
+  }
+
+  /**
+   * @brief findBaselineShifts Runs the search of earlier versions on the section Features of the last
+   * findShifts() call. It scores one candidate at a time on one set of histograms that is cleared after
+   * every candidate. The only change is that the table of tried positions is not read for a negative Y
+   * index, which earlier versions did when the search wandered below -dims[1] / 2.
+   */
+  void findBaselineShifts(std::vector<int64_t>& xshifts, std::vector<int64_t>& yshifts)
+  {
+    DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getDataContainerName());
+    SizeVec3Type udims = m->getGeometryAs<ImageGeom>()->getDimensions();
+    int64_t dims[3] = {
+        static_cast<int64_t>(udims[0]), static_cast<int64_t>(udims[1]), static_cast<int64_t>(udims[2]),
+    };
+
+    int32_t* miFeatureIds = m_MIFeaturesPtr->getPointer(0);
+    int32_t* counts = getFeatureCounts()->getPointer(0);
+
+    std::vector<std::vector<float>> misorients(dims[0], std::vector<float>(dims[1], 0.0f));
+    for(int64_t iter = 1; iter < dims[2]; iter++)
+    {
+      float mindisorientation = std::numeric_limits<float>::max();
+      int64_t slice = (dims[2] - 1) - iter;
+      int32_t featurecount1 = counts[slice];
+      int32_t featurecount2 = counts[slice + 1];
+      std::vector<std::vector<float>> mutualinfo12(featurecount1, std::vector<float>(featurecount2, 0.0f));
+      std::vector<float> mutualinfo1(featurecount1, 0.0f);
+      std::vector<float> mutualinfo2(featurecount2, 0.0f);
+      int64_t oldxshift = -1;
+      int64_t oldyshift = -1;
+      int64_t newxshift = 0;
+      int64_t newyshift = 0;
+      for(std::vector<float>& column : misorients)
+      {
+        std::fill(column.begin(), column.end(), 0.0f);
+      }
+      while(newxshift != oldxshift || newyshift != oldyshift)
+      {
+        oldxshift = newxshift;
+        oldyshift = newyshift;
+        for(int32_t j = -3; j < 4; j++)
+        {
+          for(int32_t k = -3; k < 4; k++)
+          {
+            float disorientation = 0.0f;
+            float count = 0.0f;
+            if(llabs(k + oldxshift) < (dims[0] / 2) && (j + oldyshift) < (dims[1] / 2) && (j + oldyshift + dims[1] / 2) >= 0 &&
+               misorients[k + oldxshift + dims[0] / 2][j + oldyshift + dims[1] / 2] == 0)
+            {
+              for(int64_t l = 0; l < dims[1]; l = l + 4)
+              {
+                for(int64_t n = 0; n < dims[0]; n = n + 4)
+                {
+                  if((l + j + oldyshift) >= 0 && (l + j + oldyshift) < dims[1] && (n + k + oldxshift) >= 0 && (n + k + oldxshift) < dims[0])
+                  {
+                    int64_t refposition = ((slice + 1) * dims[0] * dims[1]) + (l * dims[0]) + n;
+                    int64_t curposition = (slice * dims[0] * dims[1]) + ((l + j + oldyshift) * dims[0]) + (n + k + oldxshift);
+                    int32_t refgnum = miFeatureIds[refposition];
+                    int32_t curgnum = miFeatureIds[curposition];
+                    if(curgnum >= 0 && refgnum >= 0)
+                    {
+                      mutualinfo12[curgnum][refgnum]++;
+                      mutualinfo1[curgnum]++;
+                      mutualinfo2[refgnum]++;
+                      count++;
+                    }
+                  }
+                  else
+                  {
+                    mutualinfo12[0][0]++;
+                    mutualinfo1[0]++;
+                    mutualinfo2[0]++;
+                  }
+                }
+              }
+              for(int32_t b = 0; b < featurecount1; b++)
+              {
+                mutualinfo1[b] = mutualinfo1[b] / count;
+              }
+              for(int32_t c = 0; c < featurecount2; c++)
+              {
+                mutualinfo2[c] = mutualinfo2[c] / float(count);
+              }
+              for(int32_t b = 0; b < featurecount1; b++)
+              {
+                for(int32_t c = 0; c < featurecount2; c++)
+                {
+                  mutualinfo12[b][c] = mutualinfo12[b][c] / count;
+                  float value = 0.0f;
+                  if(mutualinfo1[b] > 0 && mutualinfo2[c] > 0)
+                  {
+                    value = (mutualinfo12[b][c] / (mutualinfo1[b] * mutualinfo2[c]));
+                  }
+                  if(value != 0)
+                  {
+                    disorientation = disorientation + (mutualinfo12[b][c] * logf(value));
+                  }
+                }
+              }
+              for(int32_t b = 0; b < featurecount1; b++)
+              {
+                for(int32_t c = 0; c < featurecount2; c++)
+                {
+                  mutualinfo12[b][c] = 0.0f;
+                  mutualinfo1[b] = 0.0f;
+                  mutualinfo2[c] = 0.0f;
+                }
+              }
+              disorientation = 1.0f / disorientation;
+              misorients[k + oldxshift + dims[0] / 2][j + oldyshift + dims[1] / 2] = disorientation;
+              if(disorientation < mindisorientation)
+              {
+                newxshift = k + oldxshift;
+                newyshift = j + oldyshift;
+                mindisorientation = disorientation;
+              }
+            }
+          }
+        }
+      }
+      xshifts[iter] = xshifts[iter - 1] + newxshift;
+      yshifts[iter] = yshifts[iter - 1] + newyshift;
+    }
+  }
+};
+
+class AlignSectionsMutualInformationTest
+{
+
+public:
+  AlignSectionsMutualInformationTest() = default;
+  virtual ~AlignSectionsMutualInformationTest() = default;
+
+  // -----------------------------------------------------------------------------
+  // Every section is a window of the same Voronoi tessellation, moved by (xSteps[z], ySteps[z]) Cells
+  // from section z to section z + 1. Each grain has its own random orientation and all Cells are in
+  // the one cubic phase.
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer CreateTestData(size_t dims[3], const std::vector<int64_t>& xSteps, const std::vector<int64_t>& ySteps)
+  {
+    std::vector<int64_t> xOffsets(dims[2], 0);
+    std::vector<int64_t> yOffsets(dims[2], 0);
+    for(size_t z = 1; z < dims[2]; z++)
+    {
+      xOffsets[z] = xOffsets[z - 1] + xSteps[z - 1];
+      yOffsets[z] = yOffsets[z - 1] + ySteps[z - 1];
+    }
+    int64_t xMin = *std::min_element(xOffsets.begin(), xOffsets.end());
+    int64_t yMin = *std::min_element(yOffsets.begin(), yOffsets.end());
+    for(size_t z = 0; z < dims[2]; z++)
+    {
+      xOffsets[z] -= xMin;
+      yOffsets[z] -= yMin;
+    }
+    int64_t imageWidth = static_cast<int64_t>(dims[0]) + *std::max_element(xOffsets.begin(), xOffsets.end());
+    int64_t imageHeight = static_cast<int64_t>(dims[1]) + *std::max_element(yOffsets.begin(), yOffsets.end());
+
+    std::mt19937 generator(5489u);
+    const size_t numGrains = 40;
+    std::uniform_real_distribution<float> xDistribution(0.0f, static_cast<float>(imageWidth));
+    std::uniform_real_distribution<float> yDistribution(0.0f, static_cast<float>(imageHeight));
+    std::normal_distribution<float> quatDistribution(0.0f, 1.0f);
+    std::vector<float> seedX(numGrains);
+    std::vector<float> seedY(numGrains);
+    std::vector<float> grainQuats(numGrains * 4);
+    for(size_t g = 0; g < numGrains; g++)
+    {
+      seedX[g] = xDistribution(generator);
+      seedY[g] = yDistribution(generator);
+      float norm = 0.0f;
+      for(size_t c = 0; c < 4; c++)
+      {
+        grainQuats[g * 4 + c] = quatDistribution(generator);
+        norm += grainQuats[g * 4 + c] * grainQuats[g * 4 + c];
+      }
+      norm = std::sqrt(norm);
+      for(size_t c = 0; c < 4; c++)
+      {
+        grainQuats[g * 4 + c] /= norm;
+      }
+    }
+
+    std::vector<size_t> image(imageWidth * imageHeight, 0);
+    for(int64_t y = 0; y < imageHeight; y++)
+    {
+      for(int64_t x = 0; x < imageWidth; x++)
+      {
+        float minDistance = std::numeric_limits<float>::max();
+        for(size_t g = 0; g < numGrains; g++)
+        {
+          float dx = static_cast<float>(x) - seedX[g];
+          float dy = static_cast<float>(y) - seedY[g];
+          if(dx * dx + dy * dy < minDistance)
+          {
+            minDistance = dx * dx + dy * dy;
+            image[y * imageWidth + x] = g;
+          }
+        }
+      }
+    }
+
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("Test");
+    dca->addOrReplaceDataContainer(dc);
+
+    ImageGeom::Pointer igeom = ImageGeom::New();
+    igeom->setDimensions(dims);
+    dc->setGeometry(igeom);
+
+    QVector<size_t> tDims(3, 0);
+    tDims[0] = dims[0];
+    tDims[1] = dims[1];
+    tDims[2] = dims[2];
+    AttributeMatrix::Pointer cellAM = AttributeMatrix::New(tDims, "CellData", AttributeMatrix::Type::Cell);
+    dc->addOrReplaceAttributeMatrix(cellAM);
+
+    size_t totalPoints = dims[0] * dims[1] * dims[2];
+    QVector<size_t> cDims(1, 4);
+    FloatArrayType::Pointer quats = FloatArrayType::CreateArray(totalPoints, cDims, "Quats", true);
+    Int32ArrayType::Pointer phases = Int32ArrayType::CreateArray(totalPoints, "Phases", true);
+    for(size_t z = 0; z < dims[2]; z++)
+    {
+      for(size_t y = 0; y < dims[1]; y++)
+      {
+        for(size_t x = 0; x < dims[0]; x++)
+        {
+          size_t index = (z * dims[1] + y) * dims[0] + x;
+          size_t grain = image[(y + yOffsets[z]) * imageWidth + x + xOffsets[z]];
+          for(size_t c = 0; c < 4; c++)
+          {
+            quats->setComponent(index, c, grainQuats[grain * 4 + c]);
+          }
+          phases->setValue(index, 1);
+        }
+      }
+    }
+    cellAM->insertOrAssign(quats);
+    cellAM->insertOrAssign(phases);
+
+    QVector<size_t> eDims(1, 2);
+    AttributeMatrix::Pointer ensembleAM = AttributeMatrix::New(eDims, "EnsembleData", AttributeMatrix::Type::CellEnsemble);
+    dc->addOrReplaceAttributeMatrix(ensembleAM);
+    UInt32ArrayType::Pointer crystalStructures = UInt32ArrayType::CreateArray(2, "CrystalStructures", true);
+    crystalStructures->setValue(0, Ebsd::CrystalStructure::UnknownCrystalStructure);
+    crystalStructures->setValue(1, Ebsd::CrystalStructure::Cubic_High);
+    ensembleAM->insertOrAssign(crystalStructures);
+
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestBaselineShifts()
+  {
+    size_t dims[3] = {48, 40, 7};
+    const std::vector<int64_t> xSteps = {2, -3, 1, 0, 4, -2};
+    const std::vector<int64_t> ySteps = {-1, 2, -4, 3, 0, 1};
+    DataContainerArray::Pointer dca = CreateTestData(dims, xSteps, ySteps);
+
+    AlignSectionsMutualInformationTestFilter filter;
+    filter.setDataContainerArray(dca);
+    filter.setQuatsArrayPath(DataArrayPath("Test", "CellData", "Quats"));
+    filter.setCellPhasesArrayPath(DataArrayPath("Test", "CellData", "Phases"));
+    filter.setCrystalStructuresArrayPath(DataArrayPath("Test", "EnsembleData", "CrystalStructures"));
+    filter.setUseGoodVoxels(false);
+
+    std::vector<int64_t> xshifts(dims[2], 0);
+    std::vector<int64_t> yshifts(dims[2], 0);
+    filter.findShifts(xshifts, yshifts);
+    DREAM3D_REQUIRE(filter.getErrorCode() >= 0)
+
+    // The section Features are seeded at random, so the search of earlier versions is run on the
+    // ones the Filter just made
+    std::vector<int64_t> baselineXShifts(dims[2], 0);
+    std::vector<int64_t> baselineYShifts(dims[2], 0);
+    filter.findBaselineShifts(baselineXShifts, baselineYShifts);
+    for(size_t iter = 0; iter < dims[2]; iter++)
+    {
+      DREAM3D_REQUIRE_EQUAL(xshifts[iter], baselineXShifts[iter])
+      DREAM3D_REQUIRE_EQUAL(yshifts[iter], baselineYShifts[iter])
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestBaselineShifts())
+  }
+
+private:
+  AlignSectionsMutualInformationTest(const AlignSectionsMutualInformationTest&); // Copy Constructor Not Implemented
+  void operator=(const AlignSectionsMutualInformationTest&);                     // Move assignment Not Implemented
+};
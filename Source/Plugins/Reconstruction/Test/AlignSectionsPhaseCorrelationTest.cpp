@@ -0,0 +1,184 @@
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <QtCore/QCoreApplication>
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/SIMPLib.h"
+#include "UnitTestSupport.hpp"
+
+#include "Reconstruction/ReconstructionFilters/AlignSectionsPhaseCorrelation.h"
+
+/**
+ * @brief The AlignSectionsPhaseCorrelationTestFilter class gives the test access to the shifts found by
+ * AlignSectionsPhaseCorrelation before they are applied to the Cell data
+ */
+class AlignSectionsPhaseCorrelationTestFilter : public AlignSectionsPhaseCorrelation
+{
+public:
+  AlignSectionsPhaseCorrelationTestFilter() = default;
+  ~AlignSectionsPhaseCorrelationTestFilter() override = default;
+
+  void findShifts(std::vector<int64_t>& xshifts, std::vector<int64_t>& yshifts)
+  {
+    dataCheck();
+    if(getErrorCode() < 0)
+    {
+      return;
+    }
+    find_shifts(xshifts, yshifts);
+  }
+};
+
+class AlignSectionsPhaseCorrelationTest
+{
+
+public:
+  AlignSectionsPhaseCorrelationTest() = default;
+  virtual ~AlignSectionsPhaseCorrelationTest() = default;
+
+  // -----------------------------------------------------------------------------
+  // Every section is a window of the same random image, moved by (xSteps[z], ySteps[z]) Cells from
+  // section z to section z + 1. The steps are both positive and negative and most are well beyond
+  // the 3 Cells one step of the 7x7 search of the other alignment Filters covers.
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer CreateTestData(size_t dims[3], const std::vector<int64_t>& xSteps, const std::vector<int64_t>& ySteps)
+  {
+    std::vector<int64_t> xOffsets(dims[2], 0);
+    std::vector<int64_t> yOffsets(dims[2], 0);
+    for(size_t z = 1; z < dims[2]; z++)
+    {
+      xOffsets[z] = xOffsets[z - 1] + xSteps[z - 1];
+      yOffsets[z] = yOffsets[z - 1] + ySteps[z - 1];
+    }
+    int64_t xMin = *std::min_element(xOffsets.begin(), xOffsets.end());
+    int64_t yMin = *std::min_element(yOffsets.begin(), yOffsets.end());
+    for(size_t z = 0; z < dims[2]; z++)
+    {
+      xOffsets[z] -= xMin;
+      yOffsets[z] -= yMin;
+    }
+    int64_t imageWidth = static_cast<int64_t>(dims[0]) + *std::max_element(xOffsets.begin(), xOffsets.end());
+    int64_t imageHeight = static_cast<int64_t>(dims[1]) + *std::max_element(yOffsets.begin(), yOffsets.end());
+
+    std::mt19937 generator(5489u);
+    std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+    std::vector<float> image(imageWidth * imageHeight);
+    for(float& value : image)
+    {
+      value = distribution(generator);
+    }
+
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("Test");
+    dca->addOrReplaceDataContainer(dc);
+
+    ImageGeom::Pointer igeom = ImageGeom::New();
+    igeom->setDimensions(dims);
+    dc->setGeometry(igeom);
+
+    QVector<size_t> tDims(3, 0);
+    tDims[0] = dims[0];
+    tDims[1] = dims[1];
+    tDims[2] = dims[2];
+    AttributeMatrix::Pointer cellAM = AttributeMatrix::New(tDims, "CellData", AttributeMatrix::Type::Cell);
+    dc->addOrReplaceAttributeMatrix(cellAM);
+
+    FloatArrayType::Pointer data = FloatArrayType::CreateArray(dims[0] * dims[1] * dims[2], "Data", true);
+    for(size_t z = 0; z < dims[2]; z++)
+    {
+      for(size_t y = 0; y < dims[1]; y++)
+      {
+        for(size_t x = 0; x < dims[0]; x++)
+        {
+          size_t index = (z * dims[1] + y) * dims[0] + x;
+          data->setValue(index, image[(y + yOffsets[z]) * imageWidth + x + xOffsets[z]]);
+        }
+      }
+    }
+    cellAM->insertOrAssign(data);
+
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestKnownShifts(size_t dims[3], bool subpixelShifts)
+  {
+    const std::vector<int64_t> xSteps = {0, 5, -7, 12, -4, 1, -13};
+    const std::vector<int64_t> ySteps = {0, -2, 9, -11, -6, 3, 4};
+    DataContainerArray::Pointer dca = CreateTestData(dims, xSteps, ySteps);
+
+    AlignSectionsPhaseCorrelationTestFilter filter;
+    filter.setDataContainerArray(dca);
+    filter.setSelectedArrayPath(DataArrayPath("Test", "CellData", "Data"));
+    filter.setSubpixelShifts(subpixelShifts);
+
+    std::vector<int64_t> xshifts(dims[2], 0);
+    std::vector<int64_t> yshifts(dims[2], 0);
+    filter.findShifts(xshifts, yshifts);
+    DREAM3D_REQUIRE(filter.getErrorCode() >= 0)
+
+    // Shifts are summed from the top section down. Pair iter moves section (dims[2] - 1) - iter
+    // back onto the section above it, which is the step between them
+    int64_t xExpected = 0;
+    int64_t yExpected = 0;
+    for(int64_t iter = 1; iter < static_cast<int64_t>(dims[2]); iter++)
+    {
+      int64_t slice = (static_cast<int64_t>(dims[2]) - 1) - iter;
+      xExpected += xSteps[slice];
+      yExpected += ySteps[slice];
+      DREAM3D_REQUIRE_EQUAL(xshifts[iter], xExpected)
+      DREAM3D_REQUIRE_EQUAL(yshifts[iter], yExpected)
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestPowerOfTwoSections()
+  {
+    size_t dims[3] = {64, 48, 8};
+    DREAM3D_REQUIRE_EQUAL(TestKnownShifts(dims, false), EXIT_SUCCESS)
+    DREAM3D_REQUIRE_EQUAL(TestKnownShifts(dims, true), EXIT_SUCCESS)
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestOddSizedSections()
+  {
+    size_t dims[3] = {50, 37, 8};
+    DREAM3D_REQUIRE_EQUAL(TestKnownShifts(dims, false), EXIT_SUCCESS)
+    DREAM3D_REQUIRE_EQUAL(TestKnownShifts(dims, true), EXIT_SUCCESS)
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestPowerOfTwoSections())
+    DREAM3D_REGISTER_TEST(TestOddSizedSections())
+  }
+
+private:
+  AlignSectionsPhaseCorrelationTest(const AlignSectionsPhaseCorrelationTest&); // Copy Constructor Not Implemented
+  void operator=(const AlignSectionsPhaseCorrelationTest&);                    // Move assignment Not Implemented
+};
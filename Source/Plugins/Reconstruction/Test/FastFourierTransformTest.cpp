@@ -0,0 +1,169 @@
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include <cmath>
+#include <complex>
+#include <random>
+#include <vector>
+
+#include <QtCore/QCoreApplication>
+
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/SIMPLib.h"
+#include "UnitTestSupport.hpp"
+
+#include "Reconstruction/ReconstructionFilters/util/FastFourierTransform.h"
+
+class FastFourierTransformTest
+{
+
+public:
+  using ComplexType = FastFourierTransform::ComplexType;
+
+  FastFourierTransformTest() = default;
+  virtual ~FastFourierTransformTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  std::vector<ComplexType> CreateRandomData(size_t count, uint32_t seed)
+  {
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+    std::vector<ComplexType> data(count);
+    for(ComplexType& value : data)
+    {
+      value = ComplexType(distribution(generator), distribution(generator));
+    }
+    return data;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestNextPowerOfTwo()
+  {
+    DREAM3D_REQUIRE_EQUAL(FastFourierTransform::NextPowerOfTwo(0), 1)
+    DREAM3D_REQUIRE_EQUAL(FastFourierTransform::NextPowerOfTwo(1), 1)
+    DREAM3D_REQUIRE_EQUAL(FastFourierTransform::NextPowerOfTwo(2), 2)
+    DREAM3D_REQUIRE_EQUAL(FastFourierTransform::NextPowerOfTwo(3), 4)
+    DREAM3D_REQUIRE_EQUAL(FastFourierTransform::NextPowerOfTwo(64), 64)
+    DREAM3D_REQUIRE_EQUAL(FastFourierTransform::NextPowerOfTwo(96), 128)
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestRoundTrip()
+  {
+    // A forward transform followed by an inverse one gives back the input
+    const size_t sizes[] = {1, 2, 8, 256};
+    for(size_t n : sizes)
+    {
+      const std::vector<ComplexType> input = CreateRandomData(n, 5489u);
+      std::vector<ComplexType> data = input;
+      FastFourierTransform fft(n);
+      DREAM3D_REQUIRE_EQUAL(fft.getSize(), n)
+      fft.transform(data.data(), false);
+      fft.transform(data.data(), true);
+      for(size_t i = 0; i < n; i++)
+      {
+        DREAM3D_REQUIRE(std::abs(data[i] - input[i]) < 1.0E-5f)
+      }
+    }
+
+    // Strided transforms only touch every stride-th value
+    {
+      const size_t n = 16;
+      const size_t stride = 3;
+      const std::vector<ComplexType> input = CreateRandomData(n * stride, 1234u);
+      std::vector<ComplexType> data = input;
+      FastFourierTransform fft(n);
+      fft.transform(data.data() + 1, false, stride);
+      fft.transform(data.data() + 1, true, stride);
+      for(size_t i = 0; i < n * stride; i++)
+      {
+        DREAM3D_REQUIRE(std::abs(data[i] - input[i]) < 1.0E-5f)
+      }
+    }
+
+    // 2D, with different extents in X and Y
+    {
+      const size_t width = 32;
+      const size_t height = 8;
+      const std::vector<ComplexType> input = CreateRandomData(width * height, 42u);
+      std::vector<ComplexType> data = input;
+      FastFourierTransform::Transform2D(data.data(), width, height, false);
+      FastFourierTransform::Transform2D(data.data(), width, height, true);
+      for(size_t i = 0; i < width * height; i++)
+      {
+        DREAM3D_REQUIRE(std::abs(data[i] - input[i]) < 1.0E-5f)
+      }
+    }
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestImpulse()
+  {
+    // The transform of a unit impulse at k is exp(-2 pi i j k / n) and the inverse transform of
+    // that brings the impulse back
+    const size_t n = 32;
+    const size_t impulse = 5;
+    FastFourierTransform fft(n);
+    std::vector<ComplexType> data(n, ComplexType(0.0f, 0.0f));
+    data[impulse] = ComplexType(1.0f, 0.0f);
+    fft.transform(data.data(), false);
+    for(size_t j = 0; j < n; j++)
+    {
+      double angle = -2.0 * SIMPLib::Constants::k_Pi * static_cast<double>(j * impulse) / static_cast<double>(n);
+      ComplexType expected(static_cast<float>(std::cos(angle)), static_cast<float>(std::sin(angle)));
+      DREAM3D_REQUIRE(std::abs(data[j] - expected) < 1.0E-5f)
+    }
+    fft.transform(data.data(), true);
+    for(size_t j = 0; j < n; j++)
+    {
+      float expected = (j == impulse) ? 1.0f : 0.0f;
+      DREAM3D_REQUIRE(std::abs(data[j] - ComplexType(expected, 0.0f)) < 1.0E-5f)
+    }
+
+    // In 2D an impulse at (x, y) transforms to exp(-2 pi i (u x / width + v y / height))
+    const size_t width = 16;
+    const size_t height = 8;
+    const size_t impulseX = 3;
+    const size_t impulseY = 6;
+    std::vector<ComplexType> image(width * height, ComplexType(0.0f, 0.0f));
+    image[impulseY * width + impulseX] = ComplexType(1.0f, 0.0f);
+    FastFourierTransform::Transform2D(image.data(), width, height, false);
+    for(size_t v = 0; v < height; v++)
+    {
+      for(size_t u = 0; u < width; u++)
+      {
+        double angle = -2.0 * SIMPLib::Constants::k_Pi * (static_cast<double>(u * impulseX) / static_cast<double>(width) + static_cast<double>(v * impulseY) / static_cast<double>(height));
+        ComplexType expected(static_cast<float>(std::cos(angle)), static_cast<float>(std::sin(angle)));
+        DREAM3D_REQUIRE(std::abs(image[v * width + u] - expected) < 1.0E-5f)
+      }
+    }
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestNextPowerOfTwo())
+    DREAM3D_REGISTER_TEST(TestRoundTrip())
+    DREAM3D_REGISTER_TEST(TestImpulse())
+  }
+
+private:
+  FastFourierTransformTest(const FastFourierTransformTest&); // Copy Constructor Not Implemented
+  void operator=(const FastFourierTransformTest&);           // Move assignment Not Implemented
+};
@@ -0,0 +1,309 @@
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <QtCore/QCoreApplication>
+
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/SIMPLib.h"
+#include "UnitTestSupport.hpp"
+
+#include "Reconstruction/ReconstructionFilters/SegmentFeatures.h"
+
+namespace SegmentFeaturesTestConsts
+{
+const int32_t k_ColumnValue = 7;
+const int32_t k_LoopValue = 8;
+} // namespace SegmentFeaturesTestConsts
+
+/**
+ * @brief The SegmentFeaturesTestFilter class groups face neighbors that have the same value. Cells that are masked
+ * out or have a phase of 0 are never part of a Feature. It can label the grid with either the virtual getSeed and
+ * determineGrouping methods of the burn algorithm in SegmentFeatures::execute() or with segmentVoxels().
+ */
+class SegmentFeaturesTestFilter : public SegmentFeatures
+{
+public:
+  SegmentFeaturesTestFilter(const std::vector<int32_t>& values, const std::vector<bool>& mask, const std::vector<int32_t>& phases)
+  : m_Values(values)
+  , m_Mask(mask)
+  , m_Phases(phases)
+  , m_FeatureIds(values.size(), 0)
+  {
+  }
+  ~SegmentFeaturesTestFilter() override = default;
+
+  std::vector<int32_t>& featureIds()
+  {
+    return m_FeatureIds;
+  }
+
+  bool isGood(int64_t point) const
+  {
+    return m_Mask[point] && m_Phases[point] > 0;
+  }
+
+  /**
+   * @brief executeBurn Labels the grid with the burn algorithm of SegmentFeatures::execute()
+   * @return Number of Features plus one
+   */
+  int32_t executeBurn()
+  {
+    std::fill(m_FeatureIds.begin(), m_FeatureIds.end(), 0);
+    m_NumFeatures = 0;
+    SegmentFeatures::execute();
+    return m_NumFeatures + 1;
+  }
+
+  /**
+   * @brief executeSlabs Labels the grid with segmentVoxels()
+   * @param slabCount Number of slabs, 0 lets segmentVoxels pick it
+   * @return Number of Features plus one
+   */
+  int32_t executeSlabs(int64_t slabCount)
+  {
+    // Start from garbage so that every cell has to be written
+    std::fill(m_FeatureIds.begin(), m_FeatureIds.end(), -1);
+    return segmentVoxels(m_FeatureIds.data(), ValueGrouping(this), slabCount);
+  }
+
+protected:
+  int64_t getSeed(int32_t gnum, int64_t nextSeed) override
+  {
+    int64_t totalPoints = static_cast<int64_t>(m_FeatureIds.size());
+    for(int64_t seed = nextSeed; seed < totalPoints; seed++)
+    {
+      if(m_FeatureIds[seed] == 0 && isGood(seed))
+      {
+        m_FeatureIds[seed] = gnum;
+        m_NumFeatures = gnum;
+        return seed;
+      }
+    }
+    return -1;
+  }
+
+  bool determineGrouping(int64_t referencepoint, int64_t neighborpoint, int32_t gnum) override
+  {
+    if(m_FeatureIds[neighborpoint] == 0 && isGood(neighborpoint) && m_Values[referencepoint] == m_Values[neighborpoint])
+    {
+      m_FeatureIds[neighborpoint] = gnum;
+      return true;
+    }
+    return false;
+  }
+
+private:
+  class ValueGrouping
+  {
+  public:
+    explicit ValueGrouping(const SegmentFeaturesTestFilter* filter)
+    : m_Filter(filter)
+    {
+    }
+
+    bool isSeed(int64_t point) const
+    {
+      return m_Filter->isGood(point);
+    }
+
+    bool operator()(int64_t point, int64_t neighbor) const
+    {
+      return m_Filter->m_Values[point] == m_Filter->m_Values[neighbor];
+    }
+
+  private:
+    const SegmentFeaturesTestFilter* m_Filter;
+  };
+
+  std::vector<int32_t> m_Values;
+  std::vector<bool> m_Mask;
+  std::vector<int32_t> m_Phases;
+  std::vector<int32_t> m_FeatureIds;
+  int32_t m_NumFeatures = 0;
+};
+
+class SegmentFeaturesTest
+{
+
+public:
+  SegmentFeaturesTest() = default;
+  virtual ~SegmentFeaturesTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer CreateDataContainerArray(size_t dims[3])
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("Test");
+    dca->addOrReplaceDataContainer(dc);
+
+    ImageGeom::Pointer igeom = ImageGeom::New();
+    igeom->setDimensions(dims);
+    dc->setGeometry(igeom);
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Fills the grid with random values in [0, 2] and masks out or zeroes the phase of about one cell in ten. Two
+  // Features are drawn on top that no random cell can join: a straight column (value 7) through every layer at
+  // x = y = 0, and a loop (value 8) made of two columns through every layer that only meet in the last layer, so
+  // each of its legs is a separate piece in every slab until the slabs are merged.
+  // -----------------------------------------------------------------------------
+  void CreateTestGrid(size_t dims[3], std::vector<int32_t>& values, std::vector<bool>& mask, std::vector<int32_t>& phases)
+  {
+    int64_t totalPoints = static_cast<int64_t>(dims[0] * dims[1] * dims[2]);
+    values.assign(totalPoints, 0);
+    mask.assign(totalPoints, true);
+    phases.assign(totalPoints, 1);
+
+    std::mt19937 generator(5489u);
+    std::uniform_int_distribution<int32_t> valueDistribution(0, 2);
+    std::uniform_int_distribution<int32_t> cellDistribution(0, 19);
+    for(int64_t i = 0; i < totalPoints; i++)
+    {
+      values[i] = valueDistribution(generator);
+      int32_t cell = cellDistribution(generator);
+      if(cell == 0)
+      {
+        mask[i] = false;
+      }
+      else if(cell == 1)
+      {
+        phases[i] = 0;
+      }
+    }
+
+    // The layers are planes for a 3D grid and rows for a single plane
+    bool singlePlane = (dims[2] == 1);
+    int64_t layerStride = singlePlane ? dims[0] : dims[0] * dims[1];
+    int64_t numLayers = singlePlane ? dims[1] : dims[2];
+    int64_t lastCol = dims[0] - 1;
+    for(int64_t layer = 0; layer < numLayers; layer++)
+    {
+      int64_t layerStart = layer * layerStride;
+      setGood(layerStart, SegmentFeaturesTestConsts::k_ColumnValue, values, mask, phases);
+      setGood(layerStart + lastCol - 2, SegmentFeaturesTestConsts::k_LoopValue, values, mask, phases);
+      setGood(layerStart + lastCol, SegmentFeaturesTestConsts::k_LoopValue, values, mask, phases);
+      // Keep the legs of the loop apart until the last layer
+      setGood(layerStart + lastCol - 1, 0, values, mask, phases);
+    }
+    setGood((numLayers - 1) * layerStride + lastCol - 1, SegmentFeaturesTestConsts::k_LoopValue, values, mask, phases);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void setGood(int64_t point, int32_t value, std::vector<int32_t>& values, std::vector<bool>& mask, std::vector<int32_t>& phases)
+  {
+    values[point] = value;
+    mask[point] = true;
+    phases[point] = 1;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestGrid(size_t dims[3])
+  {
+    std::vector<int32_t> values;
+    std::vector<bool> mask;
+    std::vector<int32_t> phases;
+    CreateTestGrid(dims, values, mask, phases);
+
+    SegmentFeaturesTestFilter filter(values, mask, phases);
+    filter.setDataContainerArray(CreateDataContainerArray(dims));
+    filter.setDataContainerName("Test");
+
+    int32_t burnTuples = filter.executeBurn();
+    DREAM3D_REQUIRE(filter.getErrorCode() >= 0)
+    std::vector<int32_t> burnIds = filter.featureIds();
+
+    // Masked and phase 0 cells are left out, everything else is in a Feature
+    int64_t totalPoints = static_cast<int64_t>(burnIds.size());
+    int32_t maxId = 0;
+    for(int64_t i = 0; i < totalPoints; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(burnIds[i] == 0, !filter.isGood(i))
+      maxId = std::max(maxId, burnIds[i]);
+    }
+    DREAM3D_REQUIRE_EQUAL(burnTuples, maxId + 1)
+
+    // The column and both legs of the loop are one Feature each, across every layer
+    bool singlePlane = (dims[2] == 1);
+    int64_t layerStride = singlePlane ? dims[0] : dims[0] * dims[1];
+    int64_t numLayers = singlePlane ? dims[1] : dims[2];
+    int64_t lastCol = dims[0] - 1;
+    int32_t columnId = burnIds[0];
+    int32_t loopId = burnIds[lastCol];
+    DREAM3D_REQUIRE(columnId != loopId)
+    for(int64_t layer = 0; layer < numLayers; layer++)
+    {
+      int64_t layerStart = layer * layerStride;
+      DREAM3D_REQUIRE_EQUAL(burnIds[layerStart], columnId)
+      DREAM3D_REQUIRE_EQUAL(burnIds[layerStart + lastCol - 2], loopId)
+      DREAM3D_REQUIRE_EQUAL(burnIds[layerStart + lastCol], loopId)
+    }
+    for(int64_t i = 0; i < totalPoints; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(burnIds[i] == columnId, values[i] == SegmentFeaturesTestConsts::k_ColumnValue)
+      DREAM3D_REQUIRE_EQUAL(burnIds[i] == loopId, values[i] == SegmentFeaturesTestConsts::k_LoopValue)
+    }
+
+    // One slab, a few slabs, one slab per layer and the automatic choice all have to match the burn algorithm
+    std::vector<int64_t> slabCounts = {1, 2, 3, 5, numLayers, numLayers + 4, 0};
+    for(int64_t slabCount : slabCounts)
+    {
+      int32_t slabTuples = filter.executeSlabs(slabCount);
+      DREAM3D_REQUIRE(filter.getErrorCode() >= 0)
+      DREAM3D_REQUIRE_EQUAL(slabTuples, burnTuples)
+      const std::vector<int32_t>& slabIds = filter.featureIds();
+      for(int64_t i = 0; i < totalPoints; i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(slabIds[i], burnIds[i])
+      }
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestSegmentVoxels3D()
+  {
+    size_t dims[3] = {9, 7, 13};
+    return TestGrid(dims);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestSegmentVoxels2D()
+  {
+    size_t dims[3] = {23, 17, 1};
+    return TestGrid(dims);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestSegmentVoxels3D())
+    DREAM3D_REGISTER_TEST(TestSegmentVoxels2D())
+  }
+
+private:
+  SegmentFeaturesTest(const SegmentFeaturesTest&); // Copy Constructor Not Implemented
+  void operator=(const SegmentFeaturesTest&);      // Move assignment Not Implemented
+};
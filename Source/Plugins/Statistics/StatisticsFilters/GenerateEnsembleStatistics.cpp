@@ -54,6 +54,8 @@
 
 #include "OrientationLib/OrientationMath/OrientationArray.hpp"
 #include "OrientationLib/OrientationMath/OrientationTransforms.hpp"
+#include "OrientationLib/Texture/MdfAccumulator.h"
+#include "OrientationLib/Texture/OdfAccumulator.h"
 
 #include "Statistics/DistributionAnalysisOps/BetaOps.h"
 #include "Statistics/DistributionAnalysisOps/LogNormalOps.h"
@@ -1022,36 +1024,19 @@ void GenerateEnsembleStatistics::gatherODFStats()
 {
   StatsDataArray& statsDataArray = *(m_StatsDataArray);
 
-  size_t bin = 0;
   size_t numfeatures = m_FeatureEulerAnglesPtr.lock()->getNumberOfTuples();
   size_t numensembles = m_PhaseTypesPtr.lock()->getNumberOfTuples();
-  int32_t phase = 0;
   std::vector<float> totalvol;
-  std::vector<FloatArrayType::Pointer> eulerodf;
+  std::vector<OdfAccumulator::Pointer> odfAccumulators;
 
   totalvol.resize(numensembles);
-  eulerodf.resize(numensembles);
-  uint64_t dims = 0;
+  odfAccumulators.resize(numensembles);
   for(size_t i = 1; i < numensembles; i++)
   {
     totalvol[i] = 0;
-    if(m_CrystalStructures[i] == Ebsd::CrystalStructure::Hexagonal_High)
+    if(m_CrystalStructures[i] == Ebsd::CrystalStructure::Hexagonal_High || m_CrystalStructures[i] == Ebsd::CrystalStructure::Cubic_High)
     {
-      dims = 36 * 36 * 12;
-      eulerodf[i] = FloatArrayType::CreateArray(dims, SIMPL::StringConstants::ODF);
-      for(uint64_t j = 0; j < dims; j++)
-      {
-        eulerodf[i]->setValue(j, 0.0);
-      }
-    }
-    else if(m_CrystalStructures[i] == Ebsd::CrystalStructure::Cubic_High)
-    {
-      dims = 18 * 18 * 18;
-      eulerodf[i] = FloatArrayType::CreateArray(dims, SIMPL::StringConstants::ODF);
-      for(uint64_t j = 0; j < dims; j++)
-      {
-        eulerodf[i]->setValue(j, 0.0);
-      }
+      odfAccumulators[i] = OdfAccumulator::New(m_OrientationOps[m_CrystalStructures[i]]);
     }
   }
   for(size_t i = 1; i < numfeatures; i++)
@@ -1061,17 +1046,23 @@ void GenerateEnsembleStatistics::gatherODFStats()
       totalvol[m_FeaturePhases[i]] = totalvol[m_FeaturePhases[i]] + m_Volumes[i];
     }
   }
-  for(size_t i = 1; i < numfeatures; i++)
+
+  // Bin each ensemble in one parallel pass; features of other ensembles and surface features get a zero weight
+  std::vector<float> weights(numfeatures, 0.0f);
+  std::vector<FloatArrayType::Pointer> eulerodf(numensembles);
+  for(size_t e = 1; e < numensembles; e++)
   {
-    if(!m_SurfaceFeatures[i])
+    if(nullptr == odfAccumulators[e].get())
     {
-      phase = m_CrystalStructures[m_FeaturePhases[i]];
-      FOrientArrayType eu(&(m_FeatureEulerAngles[3 * i]), 3); // Wrap the pointer
-      FOrientArrayType rod(4);
-      OrientationTransforms<FOrientArrayType, float>::eu2ro(eu, rod);
-      bin = m_OrientationOps[phase]->getOdfBin(rod);
-      eulerodf[m_FeaturePhases[i]]->setValue(bin, (eulerodf[m_FeaturePhases[i]]->getValue(bin) + (m_Volumes[i] / totalvol[m_FeaturePhases[i]])));
+      continue;
     }
+    for(size_t i = 1; i < numfeatures; i++)
+    {
+      bool inEnsemble = !m_SurfaceFeatures[i] && static_cast<size_t>(m_FeaturePhases[i]) == e;
+      weights[i] = inEnsemble ? (m_Volumes[i] / totalvol[e]) : 0.0f;
+    }
+    odfAccumulators[e]->addEulers(m_FeatureEulerAngles, weights.data(), numfeatures);
+    eulerodf[e] = odfAccumulators[e]->toDataArray(SIMPL::StringConstants::ODF);
   }
   for(size_t i = 1; i < numensembles; i++)
   {
@@ -1107,78 +1098,50 @@ void GenerateEnsembleStatistics::gatherMDFStats()
   // And we do the same for the SharedSurfaceArea list
   NeighborList<float>& neighborsurfacearealist = *(m_SharedSurfaceAreaList.lock());
 
-  float n1 = 0.0f, n2 = 0.0f, n3 = 0.0f;
-  int32_t mbin = 0;
-  float w = 0.0f;
-  QuatF q1 = QuaternionMathF::New();
-  QuatF q2 = QuaternionMathF::New();
   QuatF* avgQuats = reinterpret_cast<QuatF*>(m_AvgQuats);
 
   size_t numfeatures = m_FeaturePhasesPtr.lock()->getNumberOfTuples();
   size_t numensembles = m_PhaseTypesPtr.lock()->getNumberOfTuples();
   uint32_t phase1 = 0, phase2 = 0;
   QVector<float> totalSurfaceArea;
-  QVector<FloatArrayType::Pointer> misobin;
-  int32_t numbins = 0;
+  QVector<MdfAccumulator::Pointer> mdfAccumulators;
 
-  misobin.resize(numensembles);
+  mdfAccumulators.resize(numensembles);
   totalSurfaceArea.resize(numensembles);
   for(size_t i = 1; i < numensembles; ++i)
   {
     totalSurfaceArea[i] = 0;
-    if(Ebsd::CrystalStructure::Hexagonal_High == m_CrystalStructures[i])
-    {
-      numbins = 36 * 36 * 12;
-      misobin[i] = FloatArrayType::CreateArray(numbins, SIMPL::StringConstants::MisorientationBins);
-    }
-    else if(Ebsd::CrystalStructure::Cubic_High == m_CrystalStructures[i])
-    {
-      numbins = 18 * 18 * 18;
-      misobin[i] = FloatArrayType::CreateArray(numbins, SIMPL::StringConstants::MisorientationBins);
-    }
-    // Now initialize all bins to 0.0
-    for(int32_t j = 0; j < numbins; j++)
+    if(Ebsd::CrystalStructure::Hexagonal_High == m_CrystalStructures[i] || Ebsd::CrystalStructure::Cubic_High == m_CrystalStructures[i])
     {
-      misobin[i]->setValue(j, 0.0);
+      mdfAccumulators[i] = MdfAccumulator::New(m_OrientationOps[m_CrystalStructures[i]]);
     }
   }
   int32_t nname = 0;
   float nsa = 0.0f;
   for(size_t i = 1; i < numfeatures; i++)
   {
-    QuaternionMathF::Copy(avgQuats[i], q1);
     phase1 = m_CrystalStructures[m_FeaturePhases[i]];
+    MdfAccumulator::Pointer mdf = mdfAccumulators[m_FeaturePhases[i]];
     for(size_t j = 0; j < neighborlist[i].size(); j++)
     {
-      w = 10000.0f;
       nname = neighborlist[i][j];
-      QuaternionMathF::Copy(avgQuats[nname], q2);
       phase2 = m_CrystalStructures[m_FeaturePhases[nname]];
-      if(phase1 == phase2)
+      if(nullptr != mdf.get() && phase1 == phase2 && (nname > i || m_SurfaceFeatures[nname]))
       {
-        w = m_OrientationOps[phase1]->getMisoQuat(q1, q2, n1, n2, n3);
-      }
-      if(phase1 == phase2)
-      {
-        FOrientArrayType rod(4);
-        FOrientTransformsType::ax2ro(FOrientArrayType(n1, n2, n3, w), rod);
-
-        if((nname > i || m_SurfaceFeatures[nname]))
-        {
-          mbin = m_OrientationOps[phase1]->getMisoBin(rod);
-          nsa = neighborsurfacearealist[i][j];
-          misobin[m_FeaturePhases[i]]->setValue(mbin, (misobin[m_FeaturePhases[i]]->getValue(mbin) + nsa));
-          totalSurfaceArea[m_FeaturePhases[i]] = totalSurfaceArea[m_FeaturePhases[i]] + nsa;
-        }
+        nsa = neighborsurfacearealist[i][j];
+        mdf->addMisorientation(avgQuats[i], avgQuats[nname], nsa);
+        totalSurfaceArea[m_FeaturePhases[i]] = totalSurfaceArea[m_FeaturePhases[i]] + nsa;
       }
     }
   }
 
+  QVector<FloatArrayType::Pointer> misobin(numensembles);
   for(size_t i = 1; i < numensembles; i++)
   {
-    for(size_t j = 0; j < misobin[i]->getSize(); j++)
+    if(nullptr != mdfAccumulators[i].get())
     {
-      misobin[i]->setValue(j, (misobin[i]->getValue(j) / totalSurfaceArea[i]));
+      mdfAccumulators[i]->scale(1.0f / totalSurfaceArea[i]);
+      misobin[i] = mdfAccumulators[i]->toDataArray(SIMPL::StringConstants::MisorientationBins);
     }
     if(m_PhaseTypes[i] == static_cast<PhaseType::EnumType>(PhaseType::Type::Primary))
     {
@@ -94,9 +94,9 @@ MatchCrystallography::MatchCrystallography()
   m_MdfChange = m_OdfChange = 0.0f;
 
   m_ActualOdf = FloatArrayType::NullPointer();
-  m_SimOdf = FloatArrayType::NullPointer();
+  m_SimOdf = OdfAccumulator::NullPointer();
   m_ActualMdf = FloatArrayType::NullPointer();
-  m_SimMdf = FloatArrayType::NullPointer();
+  m_SimMdf = MdfAccumulator::NullPointer();
 
   m_OrientationOps = LaueOps::getOrientationOpsQVector();
 
@@ -220,9 +220,9 @@ void MatchCrystallography::initialize()
   m_TotalSurfaceArea.clear();
 
   m_ActualOdf = FloatArrayType::NullPointer();
-  m_SimOdf = FloatArrayType::NullPointer();
+  m_SimOdf = OdfAccumulator::NullPointer();
   m_ActualMdf = FloatArrayType::NullPointer();
-  m_SimMdf = FloatArrayType::NullPointer();
+  m_SimMdf = MdfAccumulator::NullPointer();
   m_MisorientationLists.clear();
 
   m_OrientationOps = LaueOps::getOrientationOpsQVector();
@@ -486,16 +486,19 @@ void MatchCrystallography::initializeArrays(size_t ensem)
     return;
   }
 
-  m_SimOdf = FloatArrayType::CreateArray(m_ActualOdf->getSize(), SIMPL::StringConstants::ODF);
-  m_SimMdf = FloatArrayType::CreateArray(m_ActualMdf->getSize(), SIMPL::StringConstants::MisorientationBins);
-  for(size_t j = 0; j < m_SimOdf->getSize(); j++)
+  if(m_CrystalStructures[ensem] >= static_cast<uint32_t>(m_OrientationOps.size()))
   {
-    m_SimOdf->setValue(j, 0.0);
-  }
-  for(size_t j = 0; j < m_SimMdf->getSize(); j++)
-  {
-    m_SimMdf->setValue(j, 0.0);
+    QString ss = QObject::tr("Unknown crystal structure (%1) for phase %2").arg(m_CrystalStructures[ensem]).arg(ensem);
+    setErrorCondition(-55001, ss);
+    return;
   }
+
+  // The simulated distributions track their squared error against the goal distributions
+  // incrementally, so the Monte Carlo loop never has to rescan every bin
+  m_SimOdf = OdfAccumulator::New(m_OrientationOps[m_CrystalStructures[ensem]]);
+  m_SimOdf->setTarget(m_ActualOdf);
+  m_SimMdf = MdfAccumulator::New(m_OrientationOps[m_CrystalStructures[ensem]]);
+  m_SimMdf->setTarget(m_ActualMdf);
 }
 
 // -----------------------------------------------------------------------------
@@ -624,7 +627,7 @@ void MatchCrystallography::assign_eulers(size_t ensem)
       QuaternionMathF::Copy(q.toQuaternion(), avgQuats[i]);
       if(!m_SurfaceFeatures[i])
       {
-        m_SimOdf->setValue(choose, (m_SimOdf->getValue(choose) + m_Volumes[i] / m_UnbiasedVolume[ensem]));
+        m_SimOdf->addToBin(choose, m_Volumes[i] / m_UnbiasedVolume[ensem]);
       }
     }
   }
@@ -685,12 +688,8 @@ void MatchCrystallography::MC_LoopBody1(int32_t feature, size_t ensem, size_t j,
 
   FOrientTransformsType::ax2ro(FOrientArrayType(n1, n2, n3, w), rod);
   newmisobin = m_OrientationOps[sym]->getMisoBin(rod);
-  m_MdfChange = m_MdfChange + (((m_ActualMdf->getValue(curmisobin) - m_SimMdf->getValue(curmisobin)) * (m_ActualMdf->getValue(curmisobin) - m_SimMdf->getValue(curmisobin))) -
-                               ((m_ActualMdf->getValue(curmisobin) - (m_SimMdf->getValue(curmisobin) - (neighsurfarea / m_TotalSurfaceArea[ensem]))) *
-                                (m_ActualMdf->getValue(curmisobin) - (m_SimMdf->getValue(curmisobin) - (neighsurfarea / m_TotalSurfaceArea[ensem])))));
-  m_MdfChange = m_MdfChange + (((m_ActualMdf->getValue(newmisobin) - m_SimMdf->getValue(newmisobin)) * (m_ActualMdf->getValue(newmisobin) - m_SimMdf->getValue(newmisobin))) -
-                               ((m_ActualMdf->getValue(newmisobin) - (m_SimMdf->getValue(newmisobin) + (neighsurfarea / m_TotalSurfaceArea[ensem]))) *
-                                (m_ActualMdf->getValue(newmisobin) - (m_SimMdf->getValue(newmisobin) + (neighsurfarea / m_TotalSurfaceArea[ensem])))));
+  float weight = neighsurfarea / m_TotalSurfaceArea[ensem];
+  m_MdfChange = m_MdfChange - static_cast<float>(m_SimMdf->getErrorChange(curmisobin, -weight, newmisobin, weight));
 }
 
 // -----------------------------------------------------------------------------
@@ -730,8 +729,7 @@ void MatchCrystallography::MC_LoopBody2(int32_t feature, size_t ensem, size_t j,
   m_MisorientationLists[feature][3 * j] = miso1;
   m_MisorientationLists[feature][3 * j + 1] = miso2;
   m_MisorientationLists[feature][3 * j + 2] = miso3;
-  m_SimMdf->setValue(curmisobin, (m_SimMdf->getValue(curmisobin) - (neighsurfarea / m_TotalSurfaceArea[ensem])));
-  m_SimMdf->setValue(newmisobin, (m_SimMdf->getValue(newmisobin) + (neighsurfarea / m_TotalSurfaceArea[ensem])));
+  m_SimMdf->moveBetweenBins(curmisobin, newmisobin, neighsurfarea / m_TotalSurfaceArea[ensem]);
 }
 
 // -----------------------------------------------------------------------------
@@ -795,20 +793,8 @@ void MatchCrystallography::matchCrystallography(size_t ensem)
       millis = QDateTime::currentMSecsSinceEpoch();
       lastIteration = iterations;
     }
-    currentodferror = 0;
-    currentmdferror = 0;
-    float* actualOdfPtr = m_ActualOdf->getPointer(0);
-    float* simOdfPtr = m_SimOdf->getPointer(0);
-    float delta = 0.0f;
-    for(int32_t i = 0; i < numbins; i++)
-    {
-      delta = actualOdfPtr[i] - simOdfPtr[i];
-      currentodferror = currentodferror + (delta * delta);
-    }
-    for(int32_t i = 0; i < (numbins); i++)
-    {
-      currentmdferror = currentmdferror + ((m_ActualMdf->getValue(i) - m_SimMdf->getValue(i)) * (m_ActualMdf->getValue(i) - m_SimMdf->getValue(i)));
-    }
+    currentodferror = static_cast<float>(m_SimOdf->getError());
+    currentmdferror = static_cast<float>(m_SimMdf->getError());
     iterations++;
     badtrycount++;
     random = static_cast<float>(rg.genrand_res53());
@@ -863,12 +849,8 @@ void MatchCrystallography::matchCrystallography(size_t ensem)
         FOrientTransformsType::eu2qu(g1ea, quat);
         q1 = quat.toQuaternion();
 
-        m_OdfChange = ((m_ActualOdf->getValue(choose) - m_SimOdf->getValue(choose)) * (m_ActualOdf->getValue(choose) - m_SimOdf->getValue(choose))) -
-                      ((m_ActualOdf->getValue(choose) - (m_SimOdf->getValue(choose) + (m_Volumes[selectedfeature1] / m_UnbiasedVolume[ensem]))) *
-                       (m_ActualOdf->getValue(choose) - (m_SimOdf->getValue(choose) + (m_Volumes[selectedfeature1] / m_UnbiasedVolume[ensem]))));
-        m_OdfChange = m_OdfChange + (((m_ActualOdf->getValue(g1odfbin) - m_SimOdf->getValue(g1odfbin)) * (m_ActualOdf->getValue(g1odfbin) - m_SimOdf->getValue(g1odfbin))) -
-                                     ((m_ActualOdf->getValue(g1odfbin) - (m_SimOdf->getValue(g1odfbin) - (m_Volumes[selectedfeature1] / m_UnbiasedVolume[ensem]))) *
-                                      (m_ActualOdf->getValue(g1odfbin) - (m_SimOdf->getValue(g1odfbin) - (m_Volumes[selectedfeature1] / m_UnbiasedVolume[ensem])))));
+        float volumeFraction = m_Volumes[selectedfeature1] / m_UnbiasedVolume[ensem];
+        m_OdfChange = -static_cast<float>(m_SimOdf->getErrorChange(choose, volumeFraction, g1odfbin, -volumeFraction));
 
         m_MdfChange = 0;
         size_t size = 0;
@@ -893,8 +875,7 @@ void MatchCrystallography::matchCrystallography(size_t ensem)
           m_FeatureEulerAngles[3 * selectedfeature1 + 1] = g1ea2;
           m_FeatureEulerAngles[3 * selectedfeature1 + 2] = g1ea3;
           QuaternionMathF::Copy(q1, avgQuats[selectedfeature1]);
-          m_SimOdf->setValue(choose, (m_SimOdf->getValue(choose) + (m_Volumes[selectedfeature1] / m_UnbiasedVolume[ensem])));
-          m_SimOdf->setValue(g1odfbin, (m_SimOdf->getValue(g1odfbin) - (m_Volumes[selectedfeature1] / m_UnbiasedVolume[ensem])));
+          m_SimOdf->moveBetweenBins(g1odfbin, choose, volumeFraction);
           size = 0;
           if(!neighborlist[selectedfeature1].empty())
           {
@@ -984,16 +965,9 @@ void MatchCrystallography::matchCrystallography(size_t ensem)
           FOrientTransformsType::eu2ro(FOrientArrayType(&(m_FeatureEulerAngles[3 * selectedfeature2]), 3), rod);
           g2odfbin = m_OrientationOps[m_CrystalStructures[ensem]]->getOdfBin(rod);
 
-          m_OdfChange =
-              ((m_ActualOdf->getValue(g1odfbin) - m_SimOdf->getValue(g1odfbin)) * (m_ActualOdf->getValue(g1odfbin) - m_SimOdf->getValue(g1odfbin))) -
-              ((m_ActualOdf->getValue(g1odfbin) - (m_SimOdf->getValue(g1odfbin) - (m_Volumes[selectedfeature1] / m_UnbiasedVolume[ensem]) + (m_Volumes[selectedfeature2] / m_UnbiasedVolume[ensem]))) *
-               (m_ActualOdf->getValue(g1odfbin) - (m_SimOdf->getValue(g1odfbin) - (m_Volumes[selectedfeature1] / m_UnbiasedVolume[ensem]) + (m_Volumes[selectedfeature2] / m_UnbiasedVolume[ensem]))));
-          m_OdfChange =
-              m_OdfChange +
-              (((m_ActualOdf->getValue(g2odfbin) - m_SimOdf->getValue(g2odfbin)) * (m_ActualOdf->getValue(g2odfbin) - m_SimOdf->getValue(g2odfbin))) -
-               ((m_ActualOdf->getValue(g2odfbin) - (m_SimOdf->getValue(g2odfbin) - (m_Volumes[selectedfeature2] / m_UnbiasedVolume[ensem]) + (m_Volumes[selectedfeature1] / m_UnbiasedVolume[ensem]))) *
-                (m_ActualOdf->getValue(g2odfbin) -
-                 (m_SimOdf->getValue(g2odfbin) - (m_Volumes[selectedfeature2] / m_UnbiasedVolume[ensem]) + (m_Volumes[selectedfeature1] / m_UnbiasedVolume[ensem])))));
+          float volumeFraction1 = m_Volumes[selectedfeature1] / m_UnbiasedVolume[ensem];
+          float volumeFraction2 = m_Volumes[selectedfeature2] / m_UnbiasedVolume[ensem];
+          m_OdfChange = -static_cast<float>(m_SimOdf->getErrorChange(g1odfbin, volumeFraction2 - volumeFraction1, g2odfbin, volumeFraction1 - volumeFraction2));
 
           m_MdfChange = 0;
 
@@ -1049,8 +1023,8 @@ void MatchCrystallography::matchCrystallography(size_t ensem)
             m_FeatureEulerAngles[3 * selectedfeature2] = g1ea1;
             m_FeatureEulerAngles[3 * selectedfeature2 + 1] = g1ea2;
             m_FeatureEulerAngles[3 * selectedfeature2 + 2] = g1ea3;
-            m_SimOdf->setValue(g1odfbin, (m_SimOdf->getValue(g1odfbin) + (m_Volumes[selectedfeature2] / m_UnbiasedVolume[ensem]) - (m_Volumes[selectedfeature1] / m_UnbiasedVolume[ensem])));
-            m_SimOdf->setValue(g2odfbin, (m_SimOdf->getValue(g2odfbin) + (m_Volumes[selectedfeature1] / m_UnbiasedVolume[ensem]) - (m_Volumes[selectedfeature2] / m_UnbiasedVolume[ensem])));
+            m_SimOdf->addToBin(g1odfbin, volumeFraction2 - volumeFraction1);
+            m_SimOdf->addToBin(g2odfbin, volumeFraction1 - volumeFraction2);
 
             FOrientTransformsType::eu2qu(FOrientArrayType(g1ea1, g1ea2, g1ea3), quat);
             q1 = quat.toQuaternion();
@@ -1180,7 +1154,7 @@ void MatchCrystallography::measure_misorientations(size_t ensem)
           mbin = m_OrientationOps[crys1]->getMisoBin(rod);
           if(!m_SurfaceFeatures[i] && (nname > static_cast<int32_t>(i) || m_SurfaceFeatures[nname]))
           {
-            m_SimMdf->setValue(mbin, (m_SimMdf->getValue(mbin) + (neighsurfarea / m_TotalSurfaceArea[m_FeaturePhases[i]])));
+            m_SimMdf->addToBin(mbin, neighsurfarea / m_TotalSurfaceArea[m_FeaturePhases[i]]);
           }
         }
         else
@@ -36,6 +36,8 @@
 #pragma once
 
 #include "OrientationLib/LaueOps/LaueOps.h"
+#include "OrientationLib/Texture/MdfAccumulator.h"
+#include "OrientationLib/Texture/OdfAccumulator.h"
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/DataArrays/NeighborList.hpp"
 #include "SIMPLib/DataArrays/StatsDataArray.h"
@@ -318,9 +320,9 @@ private:
   std::vector<float> m_TotalSurfaceArea;
 
   FloatArrayType::Pointer m_ActualOdf;
-  FloatArrayType::Pointer m_SimOdf;
+  OdfAccumulator::Pointer m_SimOdf;
   FloatArrayType::Pointer m_ActualMdf;
-  FloatArrayType::Pointer m_SimMdf;
+  MdfAccumulator::Pointer m_SimMdf;
 
   std::vector<std::vector<float>> m_MisorientationLists;
 